@@ -0,0 +1,461 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include "GFChien.hpp"
+#include "GFModulus.hpp"
+#include "GFbase.hpp"
+#include "GFTPlinalg.hpp"
+
+namespace GFlinalg {
+namespace op {
+/**
+ * Cyclotomic cosets of 2 modulo <tt>2^m - 1</tt>: <tt>{i, 2i, 4i, ...}</tt>, each starting with its
+ * smallest element, ordered by it.
+ */
+inline std::vector<std::vector<size_t>> cyclotomicCosets(size_t m) {
+    const size_t n = (size_t(1) << m) - 1;
+    std::vector<bool> seen(n, false);
+    std::vector<std::vector<size_t>> res;
+
+    for (size_t i = 0; i < n; ++i) {
+        if (seen[i])
+            continue;
+
+        std::vector<size_t> coset;
+
+        for (size_t j = i; !seen[j]; j = (2 * j) % n) {
+            seen[j] = true;
+            coset.push_back(j);
+        }
+
+        res.push_back(std::move(coset));
+    }
+
+    return res;
+}
+
+/**
+ * @return Minimal polynomial over \c GF(2) of the powers <tt>a^j</tt>, \c j in \c coset, of the primitive
+ * element \c a described by \c tables; bit \c i is the coefficient of <tt>x^i</tt>.
+ */
+template <class T, T modPol>
+uint64_t minimalPolynomial(const LUTArrPair<T, modPol>& tables, const std::vector<size_t>& coset) {
+    // prod (x + a^j), the coefficients are field elements until the end
+    std::vector<size_t> poly{1};
+
+    auto mul = [&](size_t a, size_t b) -> size_t {
+        return a && b ? tables.indToPol[tables.polToInd[a] + tables.polToInd[b]] : 0;
+    };
+
+    for (size_t j : coset) {
+        size_t root = tables.indToPol[j];
+
+        poly.push_back(0);
+
+        for (size_t i = poly.size() - 1; i > 0; --i)
+            poly[i] = poly[i - 1] ^ mul(poly[i], root);
+
+        poly[0] = mul(poly[0], root);
+    }
+
+    uint64_t res = 0;
+
+    for (size_t i = 0; i < poly.size(); ++i) {
+        if (poly[i] > 1)
+            throw std::logic_error("Minimal polynomial is not binary");
+
+        res |= uint64_t(poly[i]) << i;
+    }
+
+    return res;
+}
+} // namespace op
+
+/**
+ * Binary BCH code over \c GF(2^m), \c m the degree of the primitive modulus \c modPol, correcting up to
+ * \c t errors in \c dataBytes bytes of data: the code of length <tt>2^m - 1</tt>, shortened.
+ *
+ * The generator is the product of the distinct minimal polynomials of <tt>a, a^2, ..., a^(2t)</tt>,
+ * one per cyclotomic coset; generators are computed once per \c t and shared between codes.
+ *
+ * Bits are taken MSB first: data bit \c p is the coefficient of <tt>x^(r + 8 * dataBytes - 1 - p)</tt>
+ * and the \c r parity bits follow it, packed into \c parityBytes() bytes. Encoding is the division by
+ * the generator eight bytes at a time through eight tables, or a byte at a time for parity shorter
+ * than a word. Decoding takes the remainder of the received word the same way, so an intact word costs
+ * no more than encoding; otherwise the syndromes are evaluated from the remainder, the error locator
+ * found by the simplified Berlekamp-Massey algorithm for binary codes (odd steps skipped) and its roots
+ * by the vectorised \c ChienSearch.
+ *
+ * A code is immutable after construction and may be shared between threads.
+ *
+ * Time complexity:
+ * <ul>
+ *   <li>encoding - O(dataBytes * r / 64)</li>
+ *   <li>decoding with errors - O(t * r + t^2) field operations and a Chien search over the shortened length</li>
+ * </ul>
+ */
+template <class T, T modPol>
+class BchCode {
+public:
+    static constexpr size_t fieldDegree = op::modPolDegree<T>(modPol);
+    static constexpr size_t length = (size_t(1) << fieldDegree) - 1;
+
+    static_assert(fieldDegree >= 8 && fieldDegree <= 16, "BCH field degree must be 8..16");
+
+    /**
+     * @throws std::invalid_argument if \c modPol is not primitive, \c t is zero or the code does not fit
+     * <tt>2^m - 1</tt> bits.
+     */
+    BchCode(size_t t, size_t dataBytes) :
+        mT(t), mDataBytes(dataBytes), mGenerator(generator(t)), mChien(modPol, t) {
+        mParityBits = op::modulus::degree64(mGenerator.back()) + 64 * (mGenerator.size() - 1);
+
+        if (8 * dataBytes + mParityBits > length || dataBytes == 0)
+            throw std::invalid_argument("Data does not fit the code length");
+
+        mWords = (mParityBits + 63) / 64;
+        mTable.assign(8 * 256 * mWords, 0);
+
+        // x^(r+k) mod g for k = 0..7, left-aligned like the register
+        std::vector<uint64_t> xk(mWords, 0);
+
+        for (size_t i = 0; i < mParityBits; ++i)
+            if ((mGenerator[i / 64] >> (i % 64)) & 1)
+                setBit(xk.data(), i);
+
+        for (size_t k = 0; k < 8; ++k) {
+            for (size_t b = 0; b < 256; ++b)
+                if ((b >> k) & 1)
+                    for (size_t w = 0; w < mWords; ++w)
+                        row(7, b)[w] ^= xk[w];
+
+            bool top = bit(xk.data(), mParityBits - 1);
+
+            shiftLeft(xk.data(), 1);
+
+            if (top)
+                for (size_t i = 0; i < mParityBits; ++i)
+                    if ((mGenerator[i / 64] >> (i % 64)) & 1)
+                        xk[wordOf(i)] ^= maskOf(i);
+        }
+
+        // Table k is table k + 1 times x^8
+        for (size_t k = 7; k-- > 0;) {
+            for (size_t b = 0; b < 256; ++b) {
+                uint64_t* dst = row(k, b);
+
+                std::copy(row(k + 1, b), row(k + 1, b) + mWords, dst);
+
+                const uint64_t* fold = row(7, dst[0] >> 56);
+
+                shiftLeft(dst, 8);
+
+                for (size_t w = 0; w < mWords; ++w)
+                    dst[w] ^= fold[w];
+            }
+        }
+    }
+
+    size_t correctable() const noexcept { return mT; }
+
+    size_t dataBytes() const noexcept { return mDataBytes; }
+
+    size_t parityBits() const noexcept { return mParityBits; }
+
+    size_t parityBytes() const noexcept { return (mParityBits + 7) / 8; }
+
+    /**
+     * @return Generator polynomial, bit \c i of the words is the coefficient of <tt>x^i</tt>.
+     */
+    const std::vector<uint64_t>& generatorPolynomial() const noexcept { return mGenerator; }
+
+    void encode(const uint8_t* data, uint8_t* parity) const {
+        std::vector<uint64_t> reg(mWords + 1, 0);
+
+        remainder(data, reg.data());
+        store(reg.data(), parity);
+    }
+
+    /**
+     * Corrects \c data and \c parity in place.
+     *
+     * @return Number of corrected bits, or -1 if the errors are not correctable; the input is then unchanged.
+     */
+    int decode(uint8_t* data, uint8_t* parity) const {
+        std::vector<uint64_t> reg(mWords + 1, 0), received(mWords + 1, 0);
+
+        remainder(data, reg.data());
+        load(parity, received.data());
+
+        bool clean = true;
+
+        for (size_t w = 0; w < mWords; ++w) {
+            reg[w] ^= received[w];
+            clean = clean && reg[w] == 0;
+        }
+
+        if (clean)
+            return 0;
+
+        const auto& lut = tables();
+        std::vector<size_t> syndromes = evaluate(reg.data(), lut);
+        std::vector<size_t> locator = errorLocator(syndromes, lut);
+        const size_t errors = locator.size() - 1;
+
+        if (errors > mT)
+            return -1;
+
+        std::vector<size_t> positions = chien(locator);
+
+        if (positions.size() != errors)
+            return -1;
+
+        for (size_t d : positions) {
+            if (d < mParityBits) {
+                size_t p = mParityBits - 1 - d;
+                parity[p / 8] ^= uint8_t(0x80 >> (p % 8));
+            } else {
+                size_t p = mParityBits + 8 * mDataBytes - 1 - d;
+                data[p / 8] ^= uint8_t(0x80 >> (p % 8));
+            }
+        }
+
+        return static_cast<int>(errors);
+    }
+
+    /**
+     * @return Generator of the code correcting \c t errors, bit \c i of the words is the coefficient of
+     * <tt>x^i</tt>. Computed on first use and cached.
+     */
+    static const std::vector<uint64_t>& generator(size_t t) {
+        static std::mutex mutex;
+        static std::map<size_t, std::vector<uint64_t>> cache;
+
+        if (t == 0 || 2 * t >= length)
+            throw std::invalid_argument("Number of correctable errors is out of range");
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = cache.find(t);
+
+        if (it != cache.end())
+            return it->second;
+
+        const auto& lut = tables();
+        std::vector<uint64_t> g{1};
+
+        for (const auto& coset : op::cyclotomicCosets(fieldDegree)) {
+            bool needed = false;
+
+            for (size_t j : coset)
+                needed = needed || (j >= 1 && j <= 2 * t);
+
+            if (!needed)
+                continue;
+
+            uint64_t m = op::minimalPolynomial(lut, coset);
+            std::vector<uint64_t> prod(g.size() + 1, 0);
+
+            for (size_t b = 0; b < 64; ++b) {
+                if (!((m >> b) & 1))
+                    continue;
+
+                for (size_t w = 0; w < g.size(); ++w) {
+                    prod[w + b / 64] ^= g[w] << (b % 64);
+
+                    if (b % 64)
+                        prod[w + b / 64 + 1] ^= g[w] >> (64 - b % 64);
+                }
+            }
+
+            while (prod.size() > 1 && prod.back() == 0)
+                prod.pop_back();
+
+            g = std::move(prod);
+        }
+
+        return cache.emplace(t, std::move(g)).first->second;
+    }
+
+private:
+    size_t mT, mDataBytes, mParityBits, mWords;
+    std::vector<uint64_t> mGenerator;
+    ChienSearch mChien;
+    std::vector<uint64_t> mTable;    /*!<Table k maps a byte b to b(x) * x^(r + 8 * (7 - k)) mod g, left-aligned*/
+
+    uint64_t* row(size_t k, size_t b) noexcept { return mTable.data() + (k * 256 + b) * mWords; }
+
+    const uint64_t* row(size_t k, size_t b) const noexcept { return mTable.data() + (k * 256 + b) * mWords; }
+
+    static const op::LUTArrPair<T, modPol>& tables() {
+        static const op::LUTArrPair<T, modPol> lut;
+        return lut;
+    }
+
+    // The register holds a polynomial of degree < r with x^(r-1) at the top bit of the first word
+    size_t wordOf(size_t degree) const noexcept { return (mParityBits - 1 - degree) / 64; }
+
+    uint64_t maskOf(size_t degree) const noexcept { return uint64_t(1) << (63 - (mParityBits - 1 - degree) % 64); }
+
+    bool bit(const uint64_t* reg, size_t degree) const noexcept { return (reg[wordOf(degree)] & maskOf(degree)) != 0; }
+
+    void setBit(uint64_t* reg, size_t degree) const noexcept { reg[wordOf(degree)] |= maskOf(degree); }
+
+    void shiftLeft(uint64_t* reg, size_t s) const noexcept {
+        for (size_t w = 0; w + 1 < mWords; ++w)
+            reg[w] = (reg[w] << s) | (reg[w + 1] >> (64 - s));
+
+        reg[mWords - 1] <<= s;
+    }
+
+    /**
+     * Register of <tt>data(x) * x^r mod g</tt>.
+     */
+    void remainder(const uint8_t* data, uint64_t* reg) const noexcept {
+        size_t i = 0;
+
+        // Eight bytes at a time when the first word holds no padding: the top word leaves the register
+        // and each of its bytes folds back through its own table
+        if (mParityBits >= 64) {
+            for (; i + 8 <= mDataBytes; i += 8) {
+                uint64_t x;
+
+                std::memcpy(&x, data + i, 8);
+                x = __builtin_bswap64(x) ^ reg[0];
+
+                std::copy(reg + 1, reg + mWords, reg);
+                reg[mWords - 1] = 0;
+
+                for (size_t k = 0; k < 8; ++k) {
+                    const uint64_t* r = row(k, uint8_t(x >> (56 - 8 * k)));
+
+                    for (size_t w = 0; w < mWords; ++w)
+                        reg[w] ^= r[w];
+                }
+            }
+        }
+
+        for (; i < mDataBytes; ++i) {
+            const uint64_t* r = row(7, uint8_t(reg[0] >> 56) ^ data[i]);
+
+            shiftLeft(reg, 8);
+
+            for (size_t w = 0; w < mWords; ++w)
+                reg[w] ^= r[w];
+        }
+    }
+
+    void store(const uint64_t* reg, uint8_t* out) const noexcept {
+        for (size_t i = 0; i < parityBytes(); ++i)
+            out[i] = uint8_t(reg[i / 8] >> (56 - 8 * (i % 8)));
+    }
+
+    void load(const uint8_t* in, uint64_t* reg) const noexcept {
+        for (size_t i = 0; i < parityBytes(); ++i)
+            reg[i / 8] |= uint64_t(in[i]) << (56 - 8 * (i % 8));
+
+        // Bits past x^0 in the last byte are not part of the code
+        if (mParityBits % 64)
+            reg[mWords - 1] &= ~uint64_t(0) << (64 - mParityBits % 64);
+    }
+
+    /**
+     * @return Syndromes <tt>S_1..S_2t</tt> as field values, <tt>S_j = rem(a^j)</tt>; the even ones are squares.
+     */
+    std::vector<size_t> evaluate(const uint64_t* reg, const op::LUTArrPair<T, modPol>& lut) const {
+        std::vector<size_t> degrees;
+        std::vector<size_t> s(2 * mT + 1, 0);
+
+        for (size_t d = 0; d < mParityBits; ++d)
+            if (bit(reg, d))
+                degrees.push_back(d);
+
+        for (size_t j = 1; j <= 2 * mT; j += 2) {
+            size_t v = 0;
+
+            for (size_t d : degrees)
+                v ^= lut.indToPol[(j * d) % length];
+
+            s[j] = v;
+        }
+
+        for (size_t j = 2; j <= 2 * mT; j += 2)
+            s[j] = s[j / 2] ? lut.indToPol[2 * lut.polToInd[s[j / 2]] % length] : 0;
+
+        return s;
+    }
+
+    /**
+     * Berlekamp-Massey over the syndromes; for a binary code every second discrepancy is zero.
+     *
+     * @return Error locator <tt>1 + l_1 x + ... + l_L x^L</tt>, its size is <tt>L + 1</tt>.
+     */
+    std::vector<size_t> errorLocator(const std::vector<size_t>& s, const op::LUTArrPair<T, modPol>& lut) const {
+        auto mul = [&](size_t a, size_t b) -> size_t {
+            return a && b ? lut.indToPol[lut.polToInd[a] + lut.polToInd[b]] : 0;
+        };
+
+        std::vector<size_t> c(2 * mT + 2, 0), b(2 * mT + 2, 0), prev;
+        size_t L = 0, m = 1, db = 1;
+
+        c[0] = b[0] = 1;
+
+        for (size_t n = 0; n < 2 * mT; n += 2, m += 1) {
+            size_t d = s[n + 1];
+
+            for (size_t i = 1; i <= L; ++i)
+                d ^= mul(c[i], s[n + 1 - i]);
+
+            if (d == 0) {
+                ++m;
+                continue;
+            }
+
+            // coef = d / db
+            size_t coef = lut.indToPol[(lut.polToInd[d] + length - lut.polToInd[db]) % length];
+            bool lengthen = 2 * L <= n;
+
+            if (lengthen)
+                prev = c;
+
+            for (size_t i = 0; i + m < c.size(); ++i)
+                c[i + m] ^= mul(coef, b[i]);
+
+            if (lengthen) {
+                L = n + 1 - L;
+                b = std::move(prev);
+                db = d;
+                m = 1;
+            } else
+                ++m;
+        }
+
+        c.resize(L + 1);
+
+        return c;
+    }
+
+    /**
+     * @return Degrees \c d below the shortened length with <tt>locator(a^-d) = 0</tt>.
+     */
+    std::vector<size_t> chien(const std::vector<size_t>& locator) const {
+        const size_t n = 8 * mDataBytes + mParityBits;
+        std::vector<uint16_t> values(locator.begin(), locator.end());
+
+        // a^-d = a^(length - d) for d = n - 1 .. 0
+        std::vector<size_t> positions = mChien.roots(values.data(), values.size(), length - n + 1, n, values.size() - 1);
+
+        for (size_t& i : positions)
+            i = (length - i) % length;
+
+        return positions;
+    }
+};
+
+} // namespace GFlinalg
@@ -0,0 +1,268 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+/**
+ * @defgroup BerlekampMassey
+ *
+ * Shortest linear recurrence of a sequence: the connection polynomial <tt>C(x) = 1 + c_1 x + ... + c_L x^L</tt>
+ * with <tt>s_n + c_1 s_(n-1) + ... + c_L s_(n-L) = 0</tt> and its linear complexity \c L, updated one term
+ * at a time so a sequence can be fed in chunks of any size.
+ *
+ * Time complexity: O(N * L) for \c N terms, over \c GF(2) divided by the word size.
+ */
+
+namespace GFlinalg {
+
+/**
+ * Berlekamp-Massey over \c GF(2) with the polynomials and the sequence packed in 64-bit words.
+ *
+ * The sequence is stored reversed, growing towards lower addresses, so the terms <tt>s_n..s_(n-L)</tt>
+ * are a contiguous run of bits starting at \c s_n and the discrepancy is the parity of a word-wise AND
+ * with the connection polynomial.
+ */
+class BerlekampMasseyGF2 {
+public:
+    /**
+     * \param recordProfile keep the positions where the linear complexity changed, see \c profile().
+     */
+    explicit BerlekampMasseyGF2(bool recordProfile = false) : mRecord(recordProfile) { reset(); }
+
+    void update(bool bit) {
+        if (mN > mBase)
+            grow();
+
+        if (bit)
+            mSeq[(mBase - mN) >> 6] |= uint64_t(1) << ((mBase - mN) & 63);
+
+        // d = s_n + c_1 s_(n-1) + ... + c_L s_(n-L)
+        const size_t start = mBase - mN;
+        uint64_t acc = 0;
+
+        for (size_t k = 0; k <= mL >> 6; ++k)
+            acc ^= mC[k] & extract(start + (k << 6));
+
+        if (__builtin_parityll(acc)) {
+            bool lengthen = 2 * mL <= mN;
+            size_t newL = lengthen ? mN + 1 - mL : mL;
+
+            std::vector<uint64_t> prev;
+
+            if (lengthen)
+                prev.assign(mC.begin(), mC.begin() + (mL >> 6) + 1);
+
+            mC.resize(std::max(mC.size(), (newL >> 6) + 2), 0);
+            addShifted(mC, mB, mM);
+
+            if (lengthen) {
+                mB = std::move(prev);
+                mL = newL;
+                mM = 1;
+
+                if (mRecord)
+                    mProfile.emplace_back(mN + 1, mL);
+            } else
+                ++mM;
+
+            mRun = 0;
+        } else {
+            ++mM;
+            ++mRun;
+        }
+
+        ++mN;
+    }
+
+    /**
+     * Appends \c bits bits at \c data, MSB first within a byte (the order of \c Lfsr::generate).
+     */
+    void update(const uint8_t* data, uint64_t bits) {
+        for (uint64_t i = 0; i < bits; ++i)
+            update(((data[i >> 3] >> (7 - (i & 7))) & 1) != 0);
+    }
+
+    //! Linear complexity of the terms seen so far
+    size_t complexity() const noexcept { return mL; }
+
+    //! Number of terms seen so far
+    uint64_t size() const noexcept { return mN; }
+
+    //! Number of latest terms the connection polynomial already predicted, for early termination
+    uint64_t agreeing() const noexcept { return mRun; }
+
+    /**
+     * @return Connection polynomial, bit \c i of the words is \c c_i.
+     */
+    std::vector<uint64_t> connection() const {
+        std::vector<uint64_t> res(mC.begin(), mC.begin() + (mL >> 6) + 1);
+
+        if ((mL & 63) != 63)
+            res.back() &= (uint64_t(2) << (mL & 63)) - 1;
+
+        return res;
+    }
+
+    /**
+     * @return Pairs <tt>(n, L)</tt>: the first \c n terms have the linear complexity \c L, one pair per change.
+     */
+    const std::vector<std::pair<uint64_t, size_t>>& profile() const noexcept { return mProfile; }
+
+    void reset() {
+        mSeq.assign(4, 0);
+        mBase = (mSeq.size() - 2) * 64 - 1;
+        mC.assign(2, 0);
+        mB.assign(1, 1);
+        mC[0] = 1;
+        mL = 0;
+        mN = 0;
+        mM = 1;
+        mRun = 0;
+        mProfile.clear();
+    }
+
+private:
+    bool mRecord;
+    std::vector<uint64_t> mSeq;   /*!<s_j is bit mBase - j, two zero words above s_0*/
+    size_t mBase;
+    std::vector<uint64_t> mC, mB; /*!<Current and previous connection polynomials*/
+    size_t mL;
+    uint64_t mN, mM;              /*!<Terms seen, steps since the last length change*/
+    uint64_t mRun;                /*!<Terms since the last nonzero discrepancy*/
+    std::vector<std::pair<uint64_t, size_t>> mProfile;
+
+    /**
+     * @return 64 bits of the stored sequence starting at bit \c pos.
+     */
+    uint64_t extract(size_t pos) const noexcept {
+        size_t w = pos >> 6, off = pos & 63;
+        return off ? (mSeq[w] >> off) | (mSeq[w + 1] << (64 - off)) : mSeq[w];
+    }
+
+    /**
+     * Doubles the storage, the stored bits move to the top.
+     */
+    void grow() {
+        size_t added = mSeq.size();
+
+        mSeq.insert(mSeq.begin(), added, 0);
+        mBase += added * 64;
+    }
+
+    /**
+     * <tt>c += b * x^shift</tt>, \c c is long enough.
+     */
+    static void addShifted(std::vector<uint64_t>& c, const std::vector<uint64_t>& b, uint64_t shift) {
+        size_t ws = shift >> 6, bs = shift & 63;
+
+        for (size_t k = 0; k < b.size(); ++k) {
+            if (!b[k])
+                continue;
+
+            c[k + ws] ^= b[k] << bs;
+
+            if (bs)
+                c[k + ws + 1] ^= b[k] >> (64 - bs);
+        }
+    }
+};
+
+/**
+ * Berlekamp-Massey over the field of \c Elem (\c BasicBinPolynomial, \c BasicGFElem and the other
+ * element classes). Zero and one are derived from the first term, so runtime modulus elements work too.
+ */
+template <class Elem>
+class BerlekampMassey {
+public:
+    void update(const Elem& s) {
+        if (!mOne) {
+            mOne = s;
+            mOne->val() = 1;
+            mZero = s;
+            mZero->val() = 0;
+
+            mC.assign(1, *mOne);
+            mB.assign(1, *mOne);
+            mPrev = mOne;
+        }
+
+        mSeq.push_back(s);
+
+        const size_t n = mSeq.size() - 1;
+        Elem d = s;
+
+        for (size_t i = 1; i <= mL && i < mC.size(); ++i)
+            d += mC[i] * mSeq[n - i];
+
+        if (d.val() == 0) {
+            ++mM;
+            ++mRun;
+            return;
+        }
+
+        mRun = 0;
+
+        const Elem coef = d / *mPrev;
+        bool lengthen = 2 * mL <= n;
+        std::vector<Elem> prev;
+
+        if (lengthen)
+            prev = mC;
+
+        if (mC.size() < mB.size() + mM)
+            mC.resize(mB.size() + mM, *mZero);
+
+        for (size_t i = 0; i < mB.size(); ++i)
+            mC[i + mM] += coef * mB[i];
+
+        if (lengthen) {
+            mL = n + 1 - mL;
+            mB = std::move(prev);
+            mPrev = d;
+            mM = 1;
+        } else
+            ++mM;
+    }
+
+    template <class Iter>
+    void update(Iter first, Iter last) {
+        for (; first != last; ++first)
+            update(*first);
+    }
+
+    //! Linear complexity of the terms seen so far
+    size_t complexity() const noexcept { return mL; }
+
+    //! Number of terms seen so far
+    size_t size() const noexcept { return mSeq.size(); }
+
+    //! Number of latest terms the connection polynomial already predicted, for early termination
+    size_t agreeing() const noexcept { return mRun; }
+
+    /**
+     * @return Coefficients <tt>c_0 = 1, c_1, ..., c_L</tt>, empty before the first term.
+     */
+    std::vector<Elem> connection() const {
+        if (!mOne)
+            return {};
+
+        std::vector<Elem> res(mC.begin(), mC.begin() + std::min(mC.size(), mL + 1));
+        res.resize(mL + 1, *mZero);
+
+        return res;
+    }
+
+    void reset() {
+        *this = BerlekampMassey();
+    }
+
+private:
+    std::vector<Elem> mSeq, mC, mB;
+    std::optional<Elem> mOne, mZero, mPrev;
+    size_t mL = 0, mM = 1, mRun = 0;
+};
+
+} // namespace GFlinalg
@@ -0,0 +1,427 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "GFView.hpp"
+#include "GFbase.hpp"
+
+/**
+ * @defgroup BitMatrix
+ *
+ * Dense matrices over \c GF(2) with bit-packed rows. The element classes cover \c GF(2) only as the
+ * degree 1 case, one element per entry; here an entry is one bit and whole rows are processed as
+ * 64-bit words, with the tables of the Method of Four Russians for products and elimination.
+ */
+
+namespace GFlinalg {
+
+/**
+ * Dense \c rows x \c cols matrix over \c GF(2). Row \c i is <tt>words()</tt> 64-bit words at \c row(i),
+ * column \c j is bit <tt>j % 64</tt> of word <tt>j / 64</tt>. The bits past the last column are kept zero.
+ *
+ * Products use M4RM: every group of 8 rows of the right factor is turned into a table of its 256 sums,
+ * then one byte of a row of the left factor selects a single table row. The columns of the product are
+ * processed in chunks so that the 8 tables of one word of the left factor stay in the L2 cache.
+ *
+ * Elimination uses M4RI: up to 8 pivots are found in a stripe of 8 columns, reduced against each other,
+ * and the stripe is cleared in all other rows with one table lookup per row.
+ *
+ * Time complexity:
+ * <ul>
+ *   <li>product - O(n^3 / (64 * 8)) word operations, plus O(n^2 * 256 / 64) for the tables</li>
+ *   <li>elimination - O(n^3 / (64 * 8)) word operations</li>
+ *   <li>transpose - O(n^2 / 64) word operations, 64 x 64 blocks at a time</li>
+ * </ul>
+ *
+ * Memory complexity: O(rows * cols / 64)
+ */
+class BitMatrix {
+public:
+    //! Columns of the product handled together, in words: the 8 tables of a chunk take 512 KiB
+    static constexpr size_t chunk = 32;
+
+    BitMatrix() : BitMatrix(0, 0) {}
+
+    //! Zero matrix
+    BitMatrix(size_t rows, size_t cols) : mRows(rows), mCols(cols), mWords((cols + 63) >> 6), mData(rows * mWords, 0) {}
+
+    static BitMatrix identity(size_t n) {
+        BitMatrix res(n, n);
+
+        for (size_t i = 0; i < n; ++i)
+            res.set(i, i, true);
+
+        return res;
+    }
+
+    /**
+     * Expansion of the row major matrix of \c GF(2^m) elements at \c data: entry \c a_ij becomes the
+     * \c m x \c m block of the multiplication by \c a_ij, column \c t of the block holding the bits of
+     * <tt>a_ij * x^t</tt>. The bits of a vector of elements, element after element and lowest bit first,
+     * are then multiplied by the expansion instead of the elements by the matrix.
+     */
+    template <class Elem>
+    static BitMatrix expand(const Elem* data, size_t rows, size_t cols) {
+        using Value = std::decay_t<decltype(std::declval<const Elem&>().val())>;
+
+        const size_t m = op::modPolDegree<Value>(Elem::getMod());
+        BitMatrix res(rows * m, cols * m);
+
+        for (size_t i = 0; i < rows; ++i) {
+            for (size_t j = 0; j < cols; ++j) {
+                const Elem a = data[i * cols + j];
+
+                if (a.val() == 0)
+                    continue;
+
+                for (size_t t = 0; t < m; ++t) {
+                    const Value v = (a * Elem(static_cast<Value>(Value(1) << t))).val();
+
+                    for (size_t s = 0; s < m; ++s)
+                        if ((v >> s) & 1)
+                            res.set(i * m + s, j * m + t, true);
+                }
+            }
+        }
+
+        return res;
+    }
+
+    template <class Elem>
+    static BitMatrix expand(const std::vector<Elem>& data, size_t rows, size_t cols) {
+        if (data.size() != rows * cols)
+            throw std::invalid_argument("Dense matrix size does not match its dimensions");
+
+        return expand(data.data(), rows, cols);
+    }
+
+    //! Expansion of the values of \c Elem seen through \c v
+    template <class Elem, class Layout, class Accessor>
+    static BitMatrix expand(const MatrixView<Layout, Accessor>& v) {
+        using Value = std::decay_t<decltype(std::declval<const Elem&>().val())>;
+
+        std::vector<Elem> data;
+
+        data.reserve(v.rows() * v.columns());
+
+        for (size_t i = 0; i < v.rows(); ++i)
+            for (size_t j = 0; j < v.columns(); ++j)
+                data.push_back(Elem(static_cast<Value>(op::viewValue(v(i, j)))));
+
+        return expand(data.data(), v.rows(), v.columns());
+    }
+
+    /**
+     * Inverse of \c expand: row major elements, read from the first column of every block.
+     *
+     * @throws std::invalid_argument if the dimensions are not multiples of the degree or a block is not a
+     * multiplication map.
+     */
+    template <class Elem>
+    std::vector<Elem> compress() const {
+        using Value = std::decay_t<decltype(std::declval<const Elem&>().val())>;
+
+        const size_t m = op::modPolDegree<Value>(Elem::getMod());
+
+        if (mRows % m || mCols % m)
+            throw std::invalid_argument("Bit matrix dimensions are not multiples of the degree");
+
+        const size_t rows = mRows / m, cols = mCols / m;
+        std::vector<Elem> res(rows * cols, Elem(0));
+
+        for (size_t i = 0; i < rows; ++i) {
+            for (size_t j = 0; j < cols; ++j) {
+                Value v = 0;
+
+                for (size_t s = 0; s < m; ++s)
+                    v |= static_cast<Value>(Value((*this)(i * m + s, j * m)) << s);
+
+                const Elem a(v);
+
+                for (size_t t = 1; t < m; ++t) {
+                    const Value w = (a * Elem(static_cast<Value>(Value(1) << t))).val();
+
+                    for (size_t s = 0; s < m; ++s)
+                        if ((*this)(i * m + s, j * m + t) != bool((w >> s) & 1))
+                            throw std::invalid_argument("Bit matrix block is not a multiplication map");
+                }
+
+                res[i * cols + j] = a;
+            }
+        }
+
+        return res;
+    }
+
+    [[nodiscard]] size_t rows() const noexcept { return mRows; }
+
+    [[nodiscard]] size_t columns() const noexcept { return mCols; }
+
+    //! Words per row
+    [[nodiscard]] size_t words() const noexcept { return mWords; }
+
+    uint64_t* row(size_t i) noexcept { return mData.data() + i * mWords; }
+
+    const uint64_t* row(size_t i) const noexcept { return mData.data() + i * mWords; }
+
+    bool operator()(size_t i, size_t j) const noexcept { return (row(i)[j >> 6] >> (j & 63)) & 1; }
+
+    void set(size_t i, size_t j, bool bit) noexcept {
+        const uint64_t mask = uint64_t(1) << (j & 63);
+
+        if (bit)
+            row(i)[j >> 6] |= mask;
+        else
+            row(i)[j >> 6] &= ~mask;
+    }
+
+    bool operator==(const BitMatrix& other) const noexcept {
+        return mRows == other.mRows && mCols == other.mCols && mData == other.mData;
+    }
+
+    bool operator!=(const BitMatrix& other) const noexcept { return !(*this == other); }
+
+    /**
+     * @throws std::invalid_argument if the dimensions differ.
+     */
+    BitMatrix& operator+=(const BitMatrix& other) {
+        if (mRows != other.mRows || mCols != other.mCols)
+            throw std::invalid_argument("Bit matrix dimensions do not match");
+
+        addWords(mData.data(), other.mData.data(), mData.size());
+        return *this;
+    }
+
+    friend BitMatrix operator+(BitMatrix a, const BitMatrix& b) { return a += b; }
+
+    /**
+     * M4RM product.
+     *
+     * @throws std::invalid_argument if <tt>a.columns() != b.rows()</tt>.
+     */
+    friend BitMatrix operator*(const BitMatrix& a, const BitMatrix& b) {
+        if (a.mCols != b.mRows)
+            throw std::invalid_argument("Bit matrix dimensions do not match");
+
+        BitMatrix c(a.mRows, b.mCols);
+        std::vector<uint64_t> tables(8 * 256 * chunk);
+
+        for (size_t cw = 0; cw < b.mWords; cw += chunk) {
+            const size_t width = std::min(chunk, b.mWords - cw);
+
+            for (size_t aw = 0; aw < a.mWords; ++aw) {
+                // Table g holds the sums of rows 64 * aw + 8 * g + 0..7 of b
+                for (size_t g = 0; g < 8; ++g) {
+                    uint64_t* table = tables.data() + g * 256 * chunk;
+
+                    std::fill(table, table + width, 0);
+
+                    for (size_t x = 1; x < 256; ++x) {
+                        const size_t k = (aw << 6) + (g << 3) + __builtin_ctzll(x);
+                        uint64_t* entry = table + x * chunk;
+
+                        std::memcpy(entry, table + (x & (x - 1)) * chunk, width * sizeof(uint64_t));
+
+                        if (k < b.mRows)
+                            addWords(entry, b.row(k) + cw, width);
+                    }
+                }
+
+                for (size_t i = 0; i < a.mRows; ++i) {
+                    const uint64_t bits = a.row(i)[aw];
+                    uint64_t* out = c.row(i) + cw;
+
+                    if (!bits)
+                        continue;
+
+                    for (size_t g = 0; g < 8; ++g) {
+                        const size_t x = (bits >> (g << 3)) & 0xFF;
+
+                        if (x)
+                            addWords(out, tables.data() + (g * 256 + x) * chunk, width);
+                    }
+                }
+            }
+        }
+
+        return c;
+    }
+
+    BitMatrix transpose() const {
+        BitMatrix res(mCols, mRows);
+        uint64_t block[64];
+
+        for (size_t bi = 0; bi < mWords; ++bi) {
+            for (size_t bj = 0; bj < res.mWords; ++bj) {
+                const size_t count = std::min<size_t>(64, mRows - (bj << 6));
+
+                for (size_t t = 0; t < count; ++t)
+                    block[t] = row((bj << 6) + t)[bi];
+
+                std::fill(block + count, block + 64, 0);
+                transpose64(block);
+
+                const size_t out = std::min<size_t>(64, mCols - (bi << 6));
+
+                for (size_t t = 0; t < out; ++t)
+                    res.row((bi << 6) + t)[bj] = block[t];
+            }
+        }
+
+        return res;
+    }
+
+    /**
+     * M4RI elimination in place into row echelon form, reduced if \c reduced: the pivot rows come
+     * first, in order of their pivot columns.
+     *
+     * @return Rank.
+     */
+    size_t echelonize(bool reduced = true) {
+        std::vector<uint64_t> table(256 * mWords);
+        size_t r = 0;
+
+        for (size_t c = 0; c < mCols && r < mRows; c += 8) {
+            const size_t stripe = std::min<size_t>(8, mCols - c);
+            const size_t first = c >> 6, shift = c & 63;
+            const size_t width = mWords - first;
+            size_t pivotColumns[8];
+            size_t found = 0;
+
+            for (size_t j = c; j < c + stripe; ++j) {
+                for (size_t p = r + found; p < mRows; ++p) {
+                    uint64_t* candidate = row(p) + first;
+
+                    // The candidate is reduced by the pivots of the stripe before its bit is read
+                    for (size_t q = 0; q < found; ++q)
+                        if ((*this)(p, pivotColumns[q]))
+                            addWords(candidate, row(r + q) + first, width);
+
+                    if ((*this)(p, j)) {
+                        swapRows(p, r + found);
+
+                        for (size_t q = 0; q < found; ++q)
+                            if ((*this)(r + q, j))
+                                addWords(row(r + q) + first, row(r + found) + first, width);
+
+                        pivotColumns[found++] = j;
+                        break;
+                    }
+                }
+            }
+
+            if (!found)
+                continue;
+
+            // Entry x clears the stripe bits x of a row: a sum of the pivot rows whose columns are set in x
+            std::fill(table.begin(), table.begin() + width, 0);
+
+            for (size_t x = 1; x < (size_t(1) << stripe); ++x) {
+                const size_t j = c + __builtin_ctzll(x);
+                uint64_t* entry = table.data() + x * width;
+
+                std::memcpy(entry, table.data() + (x & (x - 1)) * width, width * sizeof(uint64_t));
+
+                for (size_t q = 0; q < found; ++q)
+                    if (pivotColumns[q] == j)
+                        addWords(entry, row(r + q) + first, width);
+            }
+
+            const size_t mask = (size_t(1) << stripe) - 1;
+
+            for (size_t i = reduced ? 0 : r + found; i < mRows; ++i) {
+                if (i == r && reduced) {
+                    i += found - 1;
+                    continue;
+                }
+
+                const size_t x = (row(i)[first] >> shift) & mask;
+
+                if (x)
+                    addWords(row(i) + first, table.data() + x * width, width);
+            }
+
+            r += found;
+        }
+
+        return r;
+    }
+
+    [[nodiscard]] size_t rank() const {
+        BitMatrix copy(*this);
+        return copy.echelonize(false);
+    }
+
+    /**
+     * Inverse of a square matrix by elimination of <tt>[A | I]</tt>.
+     *
+     * @throws std::invalid_argument if the matrix is not square or is singular.
+     */
+    BitMatrix inverse() const {
+        if (mRows != mCols)
+            throw std::invalid_argument("Only square bit matrices are invertible");
+
+        const size_t n = mRows;
+        BitMatrix aug(n, 2 * n);
+
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < n; ++j)
+                aug.set(i, j, (*this)(i, j));
+
+            aug.set(i, n + i, true);
+        }
+
+        aug.echelonize(true);
+
+        BitMatrix res(n, n);
+
+        for (size_t i = 0; i < n; ++i) {
+            if (!aug(i, i))
+                throw std::invalid_argument("Bit matrix is singular");
+
+            for (size_t j = 0; j < n; ++j)
+                res.set(i, j, aug(i, n + j));
+        }
+
+        return res;
+    }
+
+private:
+    size_t mRows, mCols, mWords;
+    std::vector<uint64_t> mData;
+
+    static void addWords(uint64_t* out, const uint64_t* in, size_t n) noexcept {
+        for (size_t i = 0; i < n; ++i)
+            out[i] ^= in[i];
+    }
+
+    void swapRows(size_t a, size_t b) noexcept {
+        if (a != b)
+            std::swap_ranges(row(a), row(a) + mWords, row(b));
+    }
+
+    /**
+     * In place transpose of 64 words, bit \c s of word \c t moves to bit \c t of word \c s: the two
+     * off-diagonal quarters are exchanged at halving block sizes.
+     */
+    static void transpose64(uint64_t* a) noexcept {
+        uint64_t m = 0x00000000FFFFFFFFull;
+
+        for (size_t j = 32; j != 0; j >>= 1, m ^= m << j) {
+            for (size_t k = 0; k < 64; k = ((k | j) + 1) & ~j) {
+                const uint64_t t = ((a[k] >> j) ^ a[k | j]) & m;
+
+                a[k] ^= t << j;
+                a[k | j] ^= t;
+            }
+        }
+    }
+};
+
+} // namespace GFlinalg
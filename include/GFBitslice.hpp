@@ -0,0 +1,446 @@
+#pragma once
+
+#include <array>
+#include <cstring>
+
+#include "GFComposite.hpp"
+#include "GFbase.hpp"
+
+namespace GFlinalg {
+
+/**
+ * Bitsliced \c GF(2^8) engine for batches of independent operations.
+ *
+ * \c Lanes bytes (64, 128 or 256) are transposed into 8 bit planes, plane \c j holding bit \c j of
+ * every lane. Multiplication, squaring and inversion are then evaluated as Boolean circuits over whole
+ * planes (\c AND / \c XOR of machine words), so a single pass processes \c Lanes elements without any
+ * table lookups. The result is transposed back into bytes.
+ *
+ * Inversion runs in the tower field \c GF((2^4)^2) of \c CompositeGFElem: the planes are mapped to the
+ * composite basis by the matrices of \c CompositeIsomorphism, <tt>(hi y + lo)^(-1)</tt> is computed from
+ * one inversion and three multiplications in \c GF(2^4) (the \c GF(2^4) inversion is read from its
+ * algebraic normal form, 11 \c AND), and the result is mapped back. This is about a third of the gates
+ * of the polynomial basis chain <tt>a^254</tt>. With SSSE3 the bytes change basis before the
+ * transposition, through the shuffles of \c applyNibbleMap. Zero is mapped to zero.
+ *
+ * The modulus is \c modPol of degree 8 (e.g. \c 0x11d), which is the same field as
+ * \c BasicBinPolynomial<uint16_t, modPol>.
+ */
+template <uint16_t modPol, size_t Lanes = 64>
+class BitsliceGF256 {
+    static_assert(op::modPolDegree<uint16_t>(modPol) == 8, "Bitsliced engine requires a degree 8 modulus");
+    static_assert(Lanes == 64 || Lanes == 128 || Lanes == 256, "Supported lane counts are 64, 128 and 256");
+
+public:
+    static constexpr size_t lanes = Lanes;
+
+    /**
+     * One bit plane: bit \c i of the plane belongs to lane \c i.
+     */
+    struct Plane {
+        std::array<uint64_t, Lanes / 64> w;
+
+        friend Plane operator^(const Plane& a, const Plane& b) {
+            Plane res;
+            for (size_t i = 0; i < a.w.size(); ++i)
+                res.w[i] = a.w[i] ^ b.w[i];
+            return res;
+        }
+
+        friend Plane operator&(const Plane& a, const Plane& b) {
+            Plane res;
+            for (size_t i = 0; i < a.w.size(); ++i)
+                res.w[i] = a.w[i] & b.w[i];
+            return res;
+        }
+
+        Plane& operator^=(const Plane& other) {
+            for (size_t i = 0; i < w.size(); ++i)
+                w[i] ^= other.w[i];
+            return *this;
+        }
+    };
+
+    using Slice = std::array<Plane, 8>;
+
+    /**
+     * Transpose \c Lanes bytes into bit planes.
+     */
+    static Slice load(const uint8_t* in) {
+        Slice res;
+
+        for (size_t i = 0; i < Lanes / 64; ++i) {
+            uint64_t x[8];
+
+            for (size_t g = 0; g < 8; ++g)
+                x[g] = transpose8x8(readWord(in + (i << 6) + (g << 3)));
+
+            transposeBytes(x);
+
+            for (size_t j = 0; j < 8; ++j)
+                res[j].w[i] = x[j];
+        }
+
+        return res;
+    }
+
+    /**
+     * Transpose bit planes back into \c Lanes bytes.
+     */
+    static void store(const Slice& s, uint8_t* out) {
+        for (size_t i = 0; i < Lanes / 64; ++i) {
+            uint64_t x[8];
+
+            for (size_t j = 0; j < 8; ++j)
+                x[j] = s[j].w[i];
+
+            transposeBytes(x);
+
+            for (size_t g = 0; g < 8; ++g)
+                writeWord(out + (i << 6) + (g << 3), transpose8x8(x[g]));
+        }
+    }
+
+    static Slice mul(const Slice& a, const Slice& b) {
+        std::array<Plane, 15> p{};
+
+        for (size_t i = 0; i < 8; ++i)
+            for (size_t j = 0; j < 8; ++j)
+                p[i + j] ^= a[i] & b[j];
+
+        return reduce(p);
+    }
+
+    static Slice square(const Slice& a) {
+        std::array<Plane, 15> p{};
+
+        // Squaring is linear over GF(2): (sum a_i x^i)^2 = sum a_i x^(2i)
+        for (size_t i = 0; i < 8; ++i)
+            p[i << 1] = a[i];
+
+        return reduce(p);
+    }
+
+    /**
+     * @throws std::invalid_argument if \c modPol is reducible (on first use).
+     */
+    static Slice inverse(const Slice& a) {
+        const BasisMaps& maps = BasisMaps::get();
+
+        return maps.apply(maps.from, compositeInverse(maps.apply(maps.to, a)));
+    }
+
+    /**
+     * <tt>out[i] = a[i] * b[i]</tt> for \c n bytes.
+     */
+    static void mul(const uint8_t* a, const uint8_t* b, uint8_t* out, size_t n) {
+        apply(n, out, [](const uint8_t* const* in, uint8_t* res) { store(mul(load(in[0]), load(in[1])), res); }, a, b);
+    }
+
+    /**
+     * <tt>out[i] = a[i]^2</tt> for \c n bytes.
+     */
+    static void square(const uint8_t* a, uint8_t* out, size_t n) {
+        apply(n, out, [](const uint8_t* const* in, uint8_t* res) { store(square(load(in[0])), res); }, a);
+    }
+
+    /**
+     * <tt>out[i] = a[i]^(-1)</tt> for \c n bytes, zero is mapped to zero.
+     *
+     * @throws std::invalid_argument if \c modPol is reducible.
+     */
+    static void inverse(const uint8_t* a, uint8_t* out, size_t n) {
+#ifdef __SSSE3__
+        const auto& iso = CompositeIsomorphism<Composite, modPol>::get();
+
+        // The bytes change basis with the nibble tables, shuffles of registers rather than lookups
+        apply(n, out, [&iso](const uint8_t* const* in, uint8_t* res) {
+            iso.toComposite(in[0], res, Lanes);
+            store(compositeInverse(load(res)), res);
+            iso.fromComposite(res, res, Lanes);
+        }, a);
+#else
+        apply(n, out, [](const uint8_t* const* in, uint8_t* res) { store(inverse(load(in[0])), res); }, a);
+#endif
+    }
+
+private:
+    //! Element of \c GF(2^4) in 4 plane words, the modulus of the tower is <tt>x^4 + x + 1</tt>
+    using Nibble = std::array<uint64_t, 4>;
+
+    static constexpr uint8_t baseModulus = 0x13;
+    //! <tt>y^2 + y + x^3</tt> is irreducible over \c GF(2^4)
+    static constexpr uint8_t lambda = 0x8;
+
+    using Composite = CompositeGFElem<BasicBinPolynomial<uint8_t, baseModulus>, lambda>;
+
+    static constexpr uint8_t mulBase(uint8_t a, uint8_t b) {
+        uint8_t res = 0;
+
+        for (; b; b >>= 1) {
+            if (b & 1)
+                res ^= a;
+
+            a <<= 1;
+
+            if (a & 0x10)
+                a ^= baseModulus;
+        }
+
+        return res;
+    }
+
+    //! Columns of <tt>h -> lambda h^2</tt>
+    static constexpr std::array<uint8_t, 4> makeLambdaSquare() {
+        std::array<uint8_t, 4> res{};
+
+        for (uint8_t j = 0; j < 4; ++j)
+            res[j] = mulBase(lambda, mulBase(uint8_t(1) << j, uint8_t(1) << j));
+
+        return res;
+    }
+
+    /**
+     * Algebraic normal form of the \c GF(2^4) inversion: bit \c s of entry \c b is set if the monomial
+     * <tt>prod_(i in s) a_i</tt> appears in output bit \c b.
+     */
+    static constexpr std::array<uint16_t, 4> makeInverseAnf() {
+        std::array<uint8_t, 16> inv{};
+
+        for (uint8_t x = 1; x < 16; ++x)
+            for (uint8_t y = 1; y < 16; ++y)
+                if (mulBase(x, y) == 1)
+                    inv[x] = y;
+
+        std::array<uint16_t, 4> res{};
+
+        for (size_t b = 0; b < 4; ++b) {
+            std::array<uint8_t, 16> f{};
+
+            for (size_t x = 0; x < 16; ++x)
+                f[x] = (inv[x] >> b) & 1;
+
+            // Moebius transform of the truth table
+            for (size_t i = 1; i < 16; i <<= 1)
+                for (size_t x = 0; x < 16; ++x)
+                    if (x & i)
+                        f[x] ^= f[x ^ i];
+
+            for (size_t x = 0; x < 16; ++x)
+                res[b] |= static_cast<uint16_t>(f[x] << x);
+        }
+
+        return res;
+    }
+
+    static constexpr std::array<uint8_t, 4> lambdaSquare = makeLambdaSquare();
+    static constexpr std::array<uint16_t, 4> inverseAnf  = makeInverseAnf();
+
+    /**
+     * Basis change between the polynomial basis of \c modPol and the packed composite form, as the input
+     * planes summed into every output plane.
+     */
+    struct BasisMaps {
+        std::array<uint8_t, 8> to, from;
+
+        static const BasisMaps& get() {
+            static const BasisMaps maps = [] {
+                const auto& iso = CompositeIsomorphism<Composite, modPol>::get();
+                BasisMaps res{};
+
+                for (size_t j = 0; j < 8; ++j) {
+                    for (size_t i = 0; i < 8; ++i) {
+                        res.to[i] |= static_cast<uint8_t>(((iso.toCompositeMatrix()[j] >> i) & 1) << j);
+                        res.from[i] |= static_cast<uint8_t>(((iso.fromCompositeMatrix()[j] >> i) & 1) << j);
+                    }
+                }
+
+                return res;
+            }();
+
+            return maps;
+        }
+
+        static Slice apply(const std::array<uint8_t, 8>& rows, const Slice& a) {
+            Slice res{};
+
+            for (size_t i = 0; i < 8; ++i)
+                for (unsigned m = rows[i]; m; m &= m - 1)
+                    res[i] ^= a[__builtin_ctz(m)];
+
+            return res;
+        }
+    };
+
+    /**
+     * Inversion of planes in the packed composite form: planes 0..3 are \c lo, planes 4..7 are \c hi.
+     * The lanes are independent, so the circuit runs on one word of every plane at a time and its
+     * intermediate planes stay in registers.
+     */
+    static Slice compositeInverse(const Slice& c) {
+        Slice res;
+
+        for (size_t w = 0; w < Lanes / 64; ++w) {
+            const Nibble lo{c[0].w[w], c[1].w[w], c[2].w[w], c[3].w[w]};
+            const Nibble hi{c[4].w[w], c[5].w[w], c[6].w[w], c[7].w[w]};
+            const Nibble t = add4(hi, lo);
+
+            // (hi y + lo) (hi y + lo + hi) = lambda hi^2 + lo (lo + hi)
+            const Nibble d = add4(linear4(lambdaSquare, hi), mul4(lo, t));
+            const Nibble e = inverse4(d);
+            const Nibble rHi = mul4(hi, e), rLo = mul4(t, e);
+
+            for (size_t i = 0; i < 4; ++i) {
+                res[i].w[w]     = rLo[i];
+                res[i + 4].w[w] = rHi[i];
+            }
+        }
+
+        return res;
+    }
+
+    static Nibble add4(const Nibble& a, const Nibble& b) {
+        return {a[0] ^ b[0], a[1] ^ b[1], a[2] ^ b[2], a[3] ^ b[3]};
+    }
+
+    static Nibble mul4(const Nibble& a, const Nibble& b) {
+        std::array<uint64_t, 7> p{};
+
+        for (size_t i = 0; i < 4; ++i)
+            for (size_t j = 0; j < 4; ++j)
+                p[i + j] ^= a[i] & b[j];
+
+        // x^4 = x + 1
+        for (size_t d = 6; d >= 4; --d) {
+            p[d - 3] ^= p[d];
+            p[d - 4] ^= p[d];
+        }
+
+        return {p[0], p[1], p[2], p[3]};
+    }
+
+    //! Linear map of \c GF(2^4) given by its columns
+    static Nibble linear4(const std::array<uint8_t, 4>& columns, const Nibble& a) {
+        Nibble res{};
+
+        for (size_t j = 0; j < 4; ++j)
+            for (size_t i = 0; i < 4; ++i)
+                if ((columns[j] >> i) & 1)
+                    res[i] ^= a[j];
+
+        return res;
+    }
+
+    static Nibble inverse4(const Nibble& a) {
+        // m[s] = prod_(i in s) a_i, one AND for every monomial of degree 2 or more
+        std::array<uint64_t, 16> m;
+
+        for (unsigned s = 1; s < 16; ++s) {
+            const unsigned low = s & (0U - s);
+            const uint64_t x = a[__builtin_ctz(s)];
+
+            m[s] = s == low ? x : m[s ^ low] & x;
+        }
+
+        Nibble res{};
+
+        for (size_t b = 0; b < 4; ++b)
+            for (unsigned s = 1; s < 16; ++s)
+                if ((inverseAnf[b] >> s) & 1)
+                    res[b] ^= m[s];
+
+        return res;
+    }
+
+    static Slice reduce(std::array<Plane, 15>& p) {
+        // x^8 = modPol - x^8, fold the high planes from the top down
+        for (size_t d = 14; d >= 8; --d)
+            for (size_t k = 0; k < 8; ++k)
+                if ((modPol >> k) & 1)
+                    p[d - 8 + k] ^= p[d];
+
+        Slice res;
+        for (size_t i = 0; i < 8; ++i)
+            res[i] = p[i];
+
+        return res;
+    }
+
+    /**
+     * Transpose an 8x8 bit matrix stored row by row in bytes.
+     */
+    static uint64_t transpose8x8(uint64_t x) {
+        uint64_t t;
+
+        t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAULL;
+        x = x ^ t ^ (t << 7);
+        t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCULL;
+        x = x ^ t ^ (t << 14);
+        t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ULL;
+        x = x ^ t ^ (t << 28);
+
+        return x;
+    }
+
+    /**
+     * Transpose an 8x8 byte matrix stored in 8 words (byte \c j of word \c g is the element \c (g, j)).
+     */
+    static void transposeBytes(uint64_t* x) {
+        constexpr uint64_t mask[] = {0x00FF00FF00FF00FFULL, 0x0000FFFF0000FFFFULL, 0x00000000FFFFFFFFULL};
+
+        for (size_t k = 0; k < 3; ++k) {
+            size_t s = 1U << (2 - k);
+            uint64_t m = mask[2 - k];
+
+            for (size_t g = 0; g < 8; ++g) {
+                if (g & s)
+                    continue;
+
+                uint64_t a = x[g];
+                uint64_t b = x[g + s];
+
+                x[g]     = (a & m) | ((b & m) << (s << 3));
+                x[g + s] = ((a >> (s << 3)) & m) | (b & ~m);
+            }
+        }
+    }
+
+    static uint64_t readWord(const uint8_t* in) {
+        uint64_t x = 0;
+        for (size_t i = 0; i < 8; ++i)
+            x |= static_cast<uint64_t>(in[i]) << (i << 3);
+        return x;
+    }
+
+    static void writeWord(uint8_t* out, uint64_t x) {
+        for (size_t i = 0; i < 8; ++i)
+            out[i] = static_cast<uint8_t>(x >> (i << 3));
+    }
+
+    /**
+     * Run \c kernel over full blocks of \c Lanes bytes, the tail is padded with zeros.
+     */
+    template <class Kernel, class... Inputs>
+    static void apply(size_t n, uint8_t* out, Kernel kernel, const Inputs*... inputs) {
+        size_t full = n - n % Lanes;
+
+        for (size_t i = 0; i < full; i += Lanes) {
+            const uint8_t* in[] = {(inputs + i)...};
+            kernel(in, out + i);
+        }
+
+        if (full == n)
+            return;
+
+        std::array<std::array<uint8_t, Lanes>, sizeof...(Inputs)> pad{};
+        std::array<uint8_t, Lanes> res;
+        const uint8_t* in[sizeof...(Inputs)];
+
+        size_t k = 0;
+        ((std::memcpy(pad[k].data(), inputs + full, n - full), in[k] = pad[k].data(), ++k), ...);
+
+        kernel(in, res.data());
+        std::memcpy(out + full, res.data(), n - full);
+    }
+};
+}
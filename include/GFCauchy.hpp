@@ -0,0 +1,369 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#include "GFBitMatrix.hpp"
+#include "GFRegion.hpp"
+#include "GFTPlinalg.hpp"
+
+/**
+ * @defgroup Cauchy
+ *
+ * Erasure coding with XORs only. Every element of a Cauchy coding matrix over \c GF(2^w) is replaced by
+ * the \c w x \c w bit matrix of the multiplication by it, a device strip is cut into \c w packets, one
+ * per bit of the elements, and every coding packet becomes a sum of data packets.
+ */
+
+namespace GFlinalg {
+namespace op {
+
+/**
+ * Sequence of region copies and XORs that evaluates a bit matrix over packets: output \c i is the sum of
+ * the inputs \c j with <tt>a(i, j) = 1</tt>.
+ *
+ * Slots <tt>0..inputs-1</tt> are the inputs, the temporaries follow, then the outputs. With common
+ * subexpression elimination the pair of slots shared by most outputs is repeatedly summed once into a
+ * temporary and replaced by it (Paar's greedy heuristic), until no pair is shared.
+ */
+class XorSchedule {
+public:
+    //! Source of a copy that clears the destination
+    static constexpr uint32_t none = UINT32_MAX;
+
+    struct Step {
+        uint32_t dst, src;
+        bool copy; /*!<dst = src instead of dst ^= src*/
+    };
+
+    XorSchedule() = default;
+
+    explicit XorSchedule(const BitMatrix& a, bool eliminate = true) : mInputs(a.columns()), mOutputs(a.rows()) {
+        std::vector<std::vector<uint32_t>> terms(mOutputs);
+        std::vector<std::pair<uint32_t, uint32_t>> shared;
+
+        for (size_t i = 0; i < mOutputs; ++i)
+            for (size_t j = 0; j < mInputs; ++j)
+                if (a(i, j))
+                    terms[i].push_back(static_cast<uint32_t>(j));
+
+        // Every row stays sorted: a new temporary has the largest slot so far
+        for (size_t slots = mInputs; eliminate; ++slots) {
+            std::vector<uint32_t> counts(slots * slots, 0);
+
+            for (const auto& t : terms)
+                for (size_t p = 0; p < t.size(); ++p)
+                    for (size_t q = p + 1; q < t.size(); ++q)
+                        ++counts[t[p] * slots + t[q]];
+
+            const size_t best = std::max_element(counts.begin(), counts.end()) - counts.begin();
+
+            if (counts.empty() || counts[best] < 2)
+                break;
+
+            const uint32_t x = static_cast<uint32_t>(best / slots), y = static_cast<uint32_t>(best % slots);
+
+            for (auto& t : terms) {
+                auto ix = std::lower_bound(t.begin(), t.end(), x), iy = std::lower_bound(t.begin(), t.end(), y);
+
+                if (ix == t.end() || *ix != x || iy == t.end() || *iy != y)
+                    continue;
+
+                t.erase(iy);
+                t.erase(ix);
+                t.push_back(static_cast<uint32_t>(slots));
+            }
+
+            shared.emplace_back(x, y);
+        }
+
+        mTemporaries = shared.size();
+
+        for (size_t s = 0; s < shared.size(); ++s) {
+            const uint32_t dst = static_cast<uint32_t>(mInputs + s);
+
+            mSteps.push_back({dst, shared[s].first, true});
+            mSteps.push_back({dst, shared[s].second, false});
+        }
+
+        for (size_t i = 0; i < mOutputs; ++i) {
+            const uint32_t dst = static_cast<uint32_t>(mInputs + mTemporaries + i);
+
+            if (terms[i].empty())
+                mSteps.push_back({dst, none, true});
+
+            for (size_t p = 0; p < terms[i].size(); ++p)
+                mSteps.push_back({dst, terms[i][p], p == 0});
+        }
+    }
+
+    size_t inputs() const noexcept { return mInputs; }
+
+    size_t outputs() const noexcept { return mOutputs; }
+
+    size_t temporaries() const noexcept { return mTemporaries; }
+
+    const std::vector<Step>& steps() const noexcept { return mSteps; }
+
+    //! Region XORs of one evaluation, the copies are not counted
+    size_t xors() const noexcept {
+        return std::count_if(mSteps.begin(), mSteps.end(), [](const Step& s) { return !s.copy; });
+    }
+
+    /**
+     * Evaluates the schedule over packets of \c n bytes, \c temp has room for \c temporaries() packets.
+     */
+    void run(const uint8_t* const* in, uint8_t* const* out, uint8_t* temp, size_t n) const noexcept {
+        auto slot = [&](uint32_t s) -> uint8_t* {
+            if (s < mInputs)
+                return const_cast<uint8_t*>(in[s]);
+
+            if (s < mInputs + mTemporaries)
+                return temp + (s - mInputs) * n;
+
+            return out[s - mInputs - mTemporaries];
+        };
+
+        for (const auto& step : mSteps) {
+            uint8_t* dst = slot(step.dst);
+
+            if (step.src == none)
+                std::memset(dst, 0, n);
+            else if (step.copy)
+                std::memcpy(dst, slot(step.src), n);
+            else
+                addRegion(slot(step.src), dst, n);
+        }
+    }
+
+private:
+    size_t mInputs = 0, mOutputs = 0, mTemporaries = 0;
+    std::vector<Step> mSteps;
+};
+} // namespace op
+
+/**
+ * Systematic erasure code with \c k data and \c m coding devices over \c GF(2^w), \c w the degree of
+ * \c modPol and <tt>k + m <= 2^w</tt>, which recovers any \c m erased devices.
+ *
+ * The coding matrix is the Cauchy matrix <tt>1 / (x_i + y_j)</tt> with <tt>x_i = i</tt> and
+ * <tt>y_j = m + j</tt>. Its columns are scaled so that the first row is all ones and every other row by
+ * the entry that leaves the fewest ones in its bit expansion; scaling keeps every square submatrix
+ * nonsingular. Devices are processed in strips of \c w packets of \c packetSize bytes, packet \c t of a
+ * strip holding bit \c t of the elements, so the encoder only XORs packets. Choose \c packetSize so
+ * that the packets of a strip and the temporaries stay in the cache.
+ *
+ * Time complexity:
+ * <ul>
+ *   <li>construction - O(ones^2 * w * m) for the elimination of shared pairs</li>
+ *   <li>encoding - O(xors() * size / w) bytes</li>
+ *   <li>decoding - O((k * w)^3 / 64) for the inverse bit matrix, then as encoding</li>
+ * </ul>
+ */
+template <class T, T modPol>
+class CauchyCode {
+public:
+    using Polynomial = BasicBinPolynomial<T, modPol>;
+
+    /**
+     * \param eliminate whether to share the common pairs of the schedules.
+     * @throws std::invalid_argument unless <tt>k, m, packetSize > 0</tt> and <tt>k + m <= 2^w</tt>.
+     */
+    CauchyCode(size_t k, size_t m, size_t packetSize, bool eliminate = true) :
+        mK(k), mM(m), mW(op::modPolDegree<T>(modPol)), mPacketSize(packetSize), mEliminate(eliminate) {
+        if (k == 0 || m == 0 || packetSize == 0 || k + m > (size_t(1) << mW))
+            throw std::invalid_argument("Code parameters must satisfy k, m, packetSize > 0 and k + m <= 2^w");
+
+        mMatrix.resize(m * k);
+
+        for (size_t i = 0; i < m; ++i)
+            for (size_t j = 0; j < k; ++j)
+                mMatrix[i * k + j] = Polynomial(1) / Polynomial(static_cast<T>(i ^ (m + j)));
+
+        for (size_t j = 0; j < k; ++j) {
+            const Polynomial d = mMatrix[j];
+
+            for (size_t i = 0; i < m; ++i)
+                mMatrix[i * k + j] /= d;
+        }
+
+        for (size_t i = 1; i < m; ++i) {
+            size_t best = SIZE_MAX;
+            Polynomial divisor(1);
+
+            for (size_t c = 0; c < k; ++c) {
+                size_t count = 0;
+
+                for (size_t j = 0; j < k; ++j)
+                    count += ones(mMatrix[i * k + j] / mMatrix[i * k + c]);
+
+                if (count < best) {
+                    best    = count;
+                    divisor = mMatrix[i * k + c];
+                }
+            }
+
+            for (size_t j = 0; j < k; ++j)
+                mMatrix[i * k + j] /= divisor;
+        }
+
+        mBits     = BitMatrix::expand(mMatrix, m, k);
+        mSchedule = op::XorSchedule(mBits, eliminate);
+    }
+
+    size_t dataDevices() const noexcept { return mK; }
+
+    size_t codingDevices() const noexcept { return mM; }
+
+    size_t wordSize() const noexcept { return mW; }
+
+    size_t packetSize() const noexcept { return mPacketSize; }
+
+    //! Bytes of a device processed together
+    size_t stripSize() const noexcept { return mW * mPacketSize; }
+
+    //! Row major \c m x \c k coding matrix
+    const std::vector<Polynomial>& matrix() const noexcept { return mMatrix; }
+
+    //! Bit expansion of the coding matrix
+    const BitMatrix& bitMatrix() const noexcept { return mBits; }
+
+    const op::XorSchedule& schedule() const noexcept { return mSchedule; }
+
+    /**
+     * Writes the \c m coding devices from the \c k data devices, every device \c size bytes.
+     *
+     * @throws std::invalid_argument if \c size is not a multiple of \c stripSize().
+     */
+    void encode(const uint8_t* const* data, uint8_t* const* coding, size_t size) const {
+        execute(mSchedule, std::vector<const uint8_t*>(data, data + mK), std::vector<uint8_t*>(coding, coding + mM), size);
+    }
+
+    /**
+     * Restores the \c erased devices in place: \c devices holds the data devices <tt>0..k-1</tt>, then the
+     * coding devices <tt>k..k+m-1</tt>.
+     *
+     * @return \c false if more than \c m devices are erased, nothing is written then.
+     * @throws std::invalid_argument if a device is out of range or repeated, or if \c size is not a
+     * multiple of \c stripSize().
+     */
+    bool decode(uint8_t* const* devices, const std::vector<size_t>& erased, size_t size) const {
+        const size_t n = mK + mM;
+        std::vector<bool> lost(n, false);
+
+        for (size_t d : erased) {
+            if (d >= n || lost[d])
+                throw std::invalid_argument("Erased devices must be distinct and in range");
+
+            lost[d] = true;
+        }
+
+        if (erased.size() > mM)
+            return false;
+
+        if (size % stripSize())
+            throw std::invalid_argument("Device size must be a multiple of the strip size");
+
+        std::vector<size_t> survivors, lostData;
+
+        for (size_t d = 0; d < n && survivors.size() < mK; ++d)
+            if (!lost[d])
+                survivors.push_back(d);
+
+        for (size_t d = 0; d < mK; ++d)
+            if (lost[d])
+                lostData.push_back(d);
+
+        if (!lostData.empty()) {
+            // The bit rows of the survivors form an invertible matrix over the data packets
+            BitMatrix g(mK * mW, mK * mW);
+
+            for (size_t s = 0; s < mK; ++s)
+                for (size_t t = 0; t < mW; ++t)
+                    for (size_t j = 0; j < mK * mW; ++j)
+                        g.set(s * mW + t, j, survivors[s] < mK ? survivors[s] * mW + t == j
+                                                               : mBits((survivors[s] - mK) * mW + t, j));
+
+            BitMatrix inv = g.inverse(), rows(lostData.size() * mW, mK * mW);
+            std::vector<const uint8_t*> in;
+            std::vector<uint8_t*> out;
+
+            for (size_t e = 0; e < lostData.size(); ++e) {
+                std::memcpy(rows.row(e * mW), inv.row(lostData[e] * mW), mW * inv.words() * sizeof(uint64_t));
+                out.push_back(devices[lostData[e]]);
+            }
+
+            for (size_t d : survivors)
+                in.push_back(devices[d]);
+
+            execute(op::XorSchedule(rows, mEliminate), in, out, size);
+        }
+
+        std::vector<size_t> lostCoding;
+
+        for (size_t d = mK; d < n; ++d)
+            if (lost[d])
+                lostCoding.push_back(d - mK);
+
+        if (!lostCoding.empty()) {
+            BitMatrix rows(lostCoding.size() * mW, mK * mW);
+            std::vector<uint8_t*> out;
+
+            for (size_t e = 0; e < lostCoding.size(); ++e) {
+                std::memcpy(rows.row(e * mW), mBits.row(lostCoding[e] * mW), mW * mBits.words() * sizeof(uint64_t));
+                out.push_back(devices[mK + lostCoding[e]]);
+            }
+
+            execute(op::XorSchedule(rows, mEliminate), std::vector<const uint8_t*>(devices, devices + mK), out, size);
+        }
+
+        return true;
+    }
+
+private:
+    size_t mK, mM, mW, mPacketSize;
+    bool mEliminate;
+    std::vector<Polynomial> mMatrix;
+    BitMatrix mBits;
+    op::XorSchedule mSchedule;
+
+    //! Ones in the bit expansion of \c e
+    size_t ones(const Polynomial& e) const {
+        size_t res = 0;
+
+        for (size_t t = 0; t < mW; ++t)
+            res += __builtin_popcountll((e * Polynomial(static_cast<T>(T(1) << t))).val());
+
+        return res;
+    }
+
+    /**
+     * Runs a schedule over all strips, its inputs and outputs are the packets of the given devices.
+     */
+    void execute(const op::XorSchedule& schedule, const std::vector<const uint8_t*>& inDevices,
+                 const std::vector<uint8_t*>& outDevices, size_t size) const {
+        if (size % stripSize())
+            throw std::invalid_argument("Device size must be a multiple of the strip size");
+
+        std::vector<const uint8_t*> in(inDevices.size() * mW);
+        std::vector<uint8_t*> out(outDevices.size() * mW);
+        std::vector<uint8_t> temp(schedule.temporaries() * mPacketSize);
+
+        for (size_t offset = 0; offset < size; offset += stripSize()) {
+            for (size_t d = 0; d < inDevices.size(); ++d)
+                for (size_t t = 0; t < mW; ++t)
+                    in[d * mW + t] = inDevices[d] + offset + t * mPacketSize;
+
+            for (size_t d = 0; d < outDevices.size(); ++d)
+                for (size_t t = 0; t < mW; ++t)
+                    out[d * mW + t] = outDevices[d] + offset + t * mPacketSize;
+
+            schedule.run(in.data(), out.data(), temp.data(), mPacketSize);
+        }
+    }
+};
+
+} // namespace GFlinalg
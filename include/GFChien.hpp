@@ -0,0 +1,288 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "GFModulus.hpp"
+#include "GFRegion.hpp"
+
+namespace GFlinalg {
+
+/**
+ * Chien search: the exponents \c i with <tt>L(a^i) = 0</tt> for a locator polynomial \c L over the field
+ * with the primitive modulus \c modPol of degree <tt>2..16</tt>, \c a its root.
+ *
+ * The term <tt>l_j a^(ij)</tt> of consecutive points is multiplied by a constant per coefficient, a map
+ * linear over \c GF(2) that runs as nibble shuffles over many lanes at once. Elements are split into
+ * planes of low and high bytes, the high plane is skipped for fields up to \c GF(2^8).
+ * <ul>
+ *   <li>\c roots: the lanes are \c lanes consecutive points of one locator, advanced by <tt>a^(j * lanes)</tt></li>
+ *   <li>\c rootsBatch: the lanes are the locators of many codewords at the same point, advanced by <tt>a^j</tt></li>
+ * </ul>
+ * Exponents are taken modulo <tt>2^m - 1</tt>, so a range may wrap around.
+ *
+ * Locators are given as coefficient values <tt>l_0..l_L</tt> or as vectors of any element class with
+ * \c val(): \c BasicBinPolynomial and the other two-parameter classes as well as \c BasicGFElem.
+ *
+ * A search is immutable after construction and may be shared between threads.
+ *
+ * Time complexity: O(L * count / lanes) shuffles of 16 lanes for one locator
+ */
+class ChienSearch {
+public:
+    static constexpr size_t lanes = 64;
+
+    /**
+     * \param modPol primitive modulus with its leading term.
+     * \param maxDegree largest degree of the locators.
+     * @throws std::invalid_argument if the degree is not <tt>2..16</tt> or the modulus is not primitive.
+     */
+    ChienSearch(uint64_t modPol, size_t maxDegree) : mMaxDegree(maxDegree) {
+        mDegree = op::modulus::degree64(modPol);
+
+        if (mDegree < 2 || mDegree > 16)
+            throw std::invalid_argument("Chien search field degree must be 2..16");
+
+        mLow   = modPol & op::modulus::lowMask(mDegree);
+        mOrder = (size_t(1) << mDegree) - 1;
+        mExp.resize(2 * mOrder);
+        mLog.assign(mOrder + 1, 0);
+
+        uint64_t v = 1;
+
+        for (size_t i = 0; i < mOrder; ++i) {
+            if (i > 0 && v == 1)
+                throw std::invalid_argument("Modulus polynomial is not primitive");
+
+            mExp[i] = mExp[i + mOrder] = static_cast<uint16_t>(v);
+            mLog[v] = i;
+            v = op::modulus::mulMod(v, 2, mLow, mDegree);
+        }
+
+        for (size_t j = 0; j <= maxDegree; ++j) {
+            addMap(mStep, mExp[(j * lanes) % mOrder]);
+            addMap(mShift, mExp[j % mOrder]);
+        }
+    }
+
+    /**
+     * Search for the field of \c e, e.g. <tt>ChienSearch::forField(BasicGFElem<uint32_t>(0, 0x201b), t)</tt>.
+     */
+    template <class Elem>
+    static ChienSearch forField(const Elem& e, size_t maxDegree) {
+        return ChienSearch(static_cast<uint64_t>(e.getMod()), maxDegree);
+    }
+
+    size_t fieldDegree() const noexcept { return mDegree; }
+
+    //! Number of points, <tt>2^m - 1</tt>
+    size_t order() const noexcept { return mOrder; }
+
+    size_t maxDegree() const noexcept { return mMaxDegree; }
+
+    /**
+     * @return Exponents \c i of the roots <tt>a^i</tt>, \c i in <tt>first..first + count - 1</tt> modulo
+     * the order, in that order. The search stops after \c limit roots.
+     * @throws std::invalid_argument if the degree exceeds \c maxDegree().
+     */
+    std::vector<size_t> roots(const uint16_t* locator, size_t size, size_t first, size_t count,
+                              size_t limit = std::numeric_limits<size_t>::max()) const {
+        const size_t L = degreeOf(locator, size);
+        std::vector<size_t> res;
+
+        if (L == 0)
+            return res;
+
+        std::vector<uint8_t> lo(L * lanes), hi(L * lanes), accLo(lanes), accHi(lanes);
+
+        for (size_t j = 1; j <= L; ++j) {
+            for (size_t k = 0; k < lanes; ++k) {
+                uint16_t v = mul(locator[j], mExp[(j * ((first + k) % mOrder)) % mOrder]);
+
+                lo[(j - 1) * lanes + k] = static_cast<uint8_t>(v);
+                hi[(j - 1) * lanes + k] = static_cast<uint8_t>(v >> 8);
+            }
+        }
+
+        for (size_t b = 0; b < count; b += lanes) {
+            std::fill(accLo.begin(), accLo.end(), static_cast<uint8_t>(locator[0]));
+            std::fill(accHi.begin(), accHi.end(), static_cast<uint8_t>(locator[0] >> 8));
+
+            for (size_t j = 1; j <= L; ++j) {
+                op::addRegion(lo.data() + (j - 1) * lanes, accLo.data(), lanes);
+
+                if (mDegree > 8)
+                    op::addRegion(hi.data() + (j - 1) * lanes, accHi.data(), lanes);
+            }
+
+            for (size_t k = 0; k < lanes && b + k < count; ++k) {
+                if ((accLo[k] | accHi[k]) == 0) {
+                    res.push_back((first + b + k) % mOrder);
+
+                    if (res.size() >= limit)
+                        return res;
+                }
+            }
+
+            for (size_t j = 1; j <= L; ++j)
+                apply(mStep[j], lo.data() + (j - 1) * lanes, hi.data() + (j - 1) * lanes, lanes);
+        }
+
+        return res;
+    }
+
+    template <class Elem>
+    std::vector<size_t> roots(const std::vector<Elem>& locator, size_t first, size_t count) const {
+        std::vector<uint16_t> values = valuesOf(locator);
+        return roots(values.data(), values.size(), first, count);
+    }
+
+    //! Roots among all nonzero elements
+    template <class Elem>
+    std::vector<size_t> roots(const std::vector<Elem>& locator) const {
+        return roots(locator, 0, mOrder);
+    }
+
+    /**
+     * Roots of many locators over the same points: one lane per locator, the search stops once every
+     * locator has as many roots as its degree.
+     *
+     * @return Exponents of the roots of every locator, as in \c roots.
+     * @throws std::invalid_argument if a degree exceeds \c maxDegree().
+     */
+    std::vector<std::vector<size_t>> rootsBatch(const std::vector<std::vector<uint16_t>>& locators, size_t first,
+                                                size_t count) const {
+        const size_t n = locators.size();
+        const size_t width = (n + 15) & ~size_t(15);
+
+        std::vector<std::vector<size_t>> res(n);
+        std::vector<size_t> degrees(n);
+        size_t L = 0, pending = 0;
+
+        for (size_t w = 0; w < n; ++w) {
+            degrees[w] = degreeOf(locators[w].data(), locators[w].size());
+            L = std::max(L, degrees[w]);
+            pending += degrees[w] > 0;
+        }
+
+        // Plane j holds l_j a^(j * point) of every locator, plane 0 the constant terms
+        std::vector<uint8_t> lo((L + 1) * width, 0), hi((L + 1) * width, 0), accLo(width), accHi(width);
+
+        for (size_t w = 0; w < n; ++w) {
+            for (size_t j = 0; j <= degrees[w]; ++j) {
+                uint16_t v = mul(locators[w][j], mExp[(j * (first % mOrder)) % mOrder]);
+
+                lo[j * width + w] = static_cast<uint8_t>(v);
+                hi[j * width + w] = static_cast<uint8_t>(v >> 8);
+            }
+        }
+
+        for (size_t p = 0; p < count && pending > 0; ++p) {
+            std::copy(lo.begin(), lo.begin() + width, accLo.begin());
+            std::copy(hi.begin(), hi.begin() + width, accHi.begin());
+
+            for (size_t j = 1; j <= L; ++j) {
+                op::addRegion(lo.data() + j * width, accLo.data(), width);
+
+                if (mDegree > 8)
+                    op::addRegion(hi.data() + j * width, accHi.data(), width);
+            }
+
+            for (size_t w = 0; w < n; ++w) {
+                if ((accLo[w] | accHi[w]) == 0 && res[w].size() < degrees[w]) {
+                    res[w].push_back((first + p) % mOrder);
+                    pending -= res[w].size() == degrees[w];
+                }
+            }
+
+            for (size_t j = 1; j <= L; ++j)
+                apply(mShift[j], lo.data() + j * width, hi.data() + j * width, width);
+        }
+
+        return res;
+    }
+
+    template <class Elem>
+    std::vector<std::vector<size_t>> rootsBatch(const std::vector<std::vector<Elem>>& locators, size_t first,
+                                                size_t count) const {
+        std::vector<std::vector<uint16_t>> values;
+
+        values.reserve(locators.size());
+
+        for (const auto& l : locators)
+            values.push_back(valuesOf(l));
+
+        return rootsBatch(values, first, count);
+    }
+
+private:
+    size_t mDegree, mOrder, mMaxDegree;
+    uint64_t mLow;
+    std::vector<uint16_t> mExp;     /*!<a^i, twice over to skip a reduction*/
+    std::vector<size_t> mLog;
+
+    struct Map {
+        op::NibbleMap narrow;       /*!<Fields up to GF(2^8)*/
+        op::NibbleMap16 wide;
+    };
+
+    std::vector<Map> mStep;         /*!<Multiplication by a^(j * lanes)*/
+    std::vector<Map> mShift;        /*!<Multiplication by a^j*/
+
+    uint16_t mul(uint16_t a, uint16_t b) const noexcept {
+        return a && b ? mExp[mLog[a] + mLog[b]] : 0;
+    }
+
+    void addMap(std::vector<Map>& maps, uint16_t c) {
+        std::array<uint8_t, 8> narrow{};
+        std::array<uint16_t, 16> wide{};
+
+        for (size_t i = 0; i < mDegree; ++i) {
+            wide[i] = mul(c, static_cast<uint16_t>(1U << i));
+
+            if (i < 8)
+                narrow[i] = static_cast<uint8_t>(wide[i]);
+        }
+
+        maps.push_back({op::NibbleMap::fromColumns(narrow), op::NibbleMap16::fromColumns(wide)});
+    }
+
+    void apply(const Map& f, uint8_t* lo, uint8_t* hi, size_t n) const noexcept {
+        if (mDegree > 8)
+            op::applyNibbleMap16(f.wide, lo, hi, lo, hi, n);
+        else
+            op::applyNibbleMap(f.narrow, lo, lo, n);
+    }
+
+    size_t degreeOf(const uint16_t* locator, size_t size) const {
+        size_t L = size;
+
+        while (L > 0 && locator[L - 1] == 0)
+            --L;
+
+        L = L ? L - 1 : 0;
+
+        if (L > mMaxDegree)
+            throw std::invalid_argument("Locator degree exceeds the maximum of the search");
+
+        return L;
+    }
+
+    template <class Elem>
+    static std::vector<uint16_t> valuesOf(const std::vector<Elem>& locator) {
+        std::vector<uint16_t> values;
+
+        values.reserve(locator.size());
+
+        for (const auto& e : locator)
+            values.push_back(static_cast<uint16_t>(e.val()));
+
+        return values;
+    }
+};
+
+} // namespace GFlinalg
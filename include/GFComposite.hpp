@@ -0,0 +1,280 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <type_traits>
+
+#include "GFRegion.hpp"
+#include "GFTPlinalg.hpp"
+
+namespace GFlinalg {
+
+/**
+ * Composite field element: \c GF((2^n)^2) built as a quadratic extension of the two parameter field
+ * \c Base (\c BasicBinPolynomial, \c PowBinPolynomial or \c TableBinPolynomial).
+ *
+ * The element <tt>hi * y + lo</tt> is stored as a pair of \c Base elements, the extension polynomial is
+ * <tt>y^2 + y + lambda</tt> (it has to be irreducible over \c Base, which is checked at compile time).
+ *
+ * Time complexity:
+ * <ul>
+ *  <li>"+" - two base additions</li>
+ *  <li>"*" - three base multiplications (Karatsuba) and a multiplication by \c lambda</li>
+ *  <li>"/" - one base inversion and six base multiplications</li>
+ * </ul>
+ *
+ * Packed form is <tt>(hi << n) | lo</tt>.
+ */
+template <class Base, decltype(Base::getMod()) lambda>
+class CompositeGFElem {
+public:
+    using BaseT  = decltype(Base::getMod());
+    static constexpr size_t baseDegree = op::modPolDegree<BaseT>(Base::getMod());
+
+    using Packed = std::conditional_t<(baseDegree <= 4), uint8_t,
+                                      std::conditional_t<(baseDegree <= 8), uint16_t, uint32_t>>;
+
+    static_assert(baseDegree <= 16, "Packed form is limited to 32 bits");
+
+private:
+    /**
+     * <tt>y^2 + y + lambda</tt> is irreducible iff <tt>z^2 + z = lambda</tt> has no solution in \c Base.
+     */
+    static constexpr bool irreducibleExtension() {
+        for (uint64_t z = 0; z < (uint64_t(1) << baseDegree); ++z) {
+            uint64_t a = z, b = z, sq = 0;
+
+            while (b) {
+                if (b & 1)
+                    sq ^= a;
+
+                b >>= 1;
+                a <<= 1;
+
+                if ((a >> baseDegree) & 1)
+                    a ^= Base::getMod();
+            }
+
+            if ((sq ^ z) == lambda)
+                return false;
+        }
+
+        return true;
+    }
+
+    static_assert(irreducibleExtension(), "y^2 + y + lambda must be irreducible over the base field");
+
+    Base mHi;
+    Base mLo;
+
+public:
+    explicit CompositeGFElem() : mHi(0), mLo(0) {}
+
+    CompositeGFElem(const Base& hi, const Base& lo) : mHi(hi), mLo(lo) {}
+
+    /**
+     * @param val packed element <tt>(hi << n) | lo</tt>
+     */
+    explicit CompositeGFElem(const Packed& val)
+        : mHi(static_cast<BaseT>(val >> baseDegree)),
+          mLo(static_cast<BaseT>(val & ((Packed(1) << baseDegree) - 1))) {}
+
+    /**
+     * @return Packed form <tt>(hi << n) | lo</tt>.
+     */
+    Packed val() const { return static_cast<Packed>((Packed(mHi.val()) << baseDegree) | mLo.val()); }
+
+    const Base& high() const noexcept { return mHi; }
+
+    const Base& low() const noexcept { return mLo; }
+
+    /**
+     * @return \c 2n For \c GF((2^n)^2).
+     */
+    static size_t gfDegree() { return baseDegree << 1; }
+
+    /**
+     * @return \c 2^(2n) For \c GF((2^n)^2).
+     */
+    static size_t gfOrder() { return size_t(1) << (baseDegree << 1); }
+
+    static constexpr BaseT getLambda() { return lambda; }
+
+    /**
+     * @return For element \c a return \c a^(-1), zero is mapped to zero.
+     */
+    CompositeGFElem getInverse() const {
+        // (hi * y + lo) * (hi * y + lo + hi) = lambda * hi^2 + hi * lo + lo^2
+        Base d = Base(lambda) * mHi * mHi + mHi * mLo + mLo * mLo;
+
+        if (d.val() == 0)
+            return CompositeGFElem();
+
+        Base dInv = Base(1) / d;
+
+        return CompositeGFElem(mHi * dInv, (mLo + mHi) * dInv);
+    }
+
+    CompositeGFElem& invert() {
+        *this = getInverse();
+        return *this;
+    }
+
+    friend CompositeGFElem operator+(const CompositeGFElem& a, const CompositeGFElem& b) {
+        return CompositeGFElem(a.mHi + b.mHi, a.mLo + b.mLo);
+    }
+
+    CompositeGFElem& operator+=(const CompositeGFElem& other) {
+        *this = *this + other;
+        return *this;
+    }
+
+    /**
+     * <tt>(a1 y + a0)(b1 y + b0) = ((a1 + a0)(b1 + b0) + a0 b0) y + (a0 b0 + lambda a1 b1)</tt>
+     */
+    friend CompositeGFElem operator*(const CompositeGFElem& a, const CompositeGFElem& b) {
+        Base hh = a.mHi * b.mHi;
+        Base ll = a.mLo * b.mLo;
+        Base mm = (a.mHi + a.mLo) * (b.mHi + b.mLo);
+
+        return CompositeGFElem(mm + ll, ll + Base(lambda) * hh);
+    }
+
+    CompositeGFElem& operator*=(const CompositeGFElem& other) {
+        *this = *this * other;
+        return *this;
+    }
+
+    friend CompositeGFElem operator/(const CompositeGFElem& a, const CompositeGFElem& b) {
+        if (b.val() == 0)
+            throw std::out_of_range("Division by zero");
+
+        return a * b.getInverse();
+    }
+
+    CompositeGFElem& operator/=(const CompositeGFElem& other) {
+        *this = *this / other;
+        return *this;
+    }
+
+    friend bool operator==(const CompositeGFElem& a, const CompositeGFElem& b) { return a.val() == b.val(); }
+
+    friend bool operator!=(const CompositeGFElem& a, const CompositeGFElem& b) { return a.val() != b.val(); }
+
+    /**
+     * Element is written in the packed form.
+     */
+    friend std::ostream& operator<<(std::ostream& out, const CompositeGFElem& a) {
+        return out << static_cast<uint32_t>(a.val());
+    }
+};
+
+/**
+ * Isomorphism between \c BasicBinPolynomial<uint16_t, modPol> (\c GF(2^8) in polynomial basis) and the
+ * composite field \c Composite.
+ *
+ * The map sends \c x to a root \c beta of \c modPol in the composite field, so it is given by the
+ * \c 8x8 binary matrix with columns <tt>beta^i</tt>. Both directions are stored as matrices and as
+ * nibble tables for bulk conversion.
+ */
+template <class Composite, uint16_t modPol>
+class CompositeIsomorphism {
+    static_assert(op::modPolDegree<uint16_t>(modPol) == 8, "Binary field must be GF(2^8)");
+    static_assert(Composite::baseDegree == 4, "Composite field must be GF((2^4)^2)");
+
+public:
+    using Binary = BasicBinPolynomial<uint16_t, modPol>;
+
+    /**
+     * Generate the isomorphism matrices. Throws \c std::invalid_argument if \c modPol is reducible: it
+     * has no root in \c Composite, or the powers of its root are linearly dependent.
+     */
+    CompositeIsomorphism() {
+        uint16_t beta = 0;
+
+        for (uint16_t c = 2; c < 256 && beta == 0; ++c) {
+            // Horner evaluation of modPol at c
+            Composite res(static_cast<uint8_t>(1));
+
+            for (size_t i = 8; i-- > 0;)
+                res = res * Composite(static_cast<uint8_t>(c)) + Composite(static_cast<uint8_t>((modPol >> i) & 1));
+
+            if (res.val() == 0)
+                beta = c;
+        }
+
+        if (beta == 0)
+            throw std::invalid_argument("Modulus polynomial has no root in the composite field");
+
+        Composite power(static_cast<uint8_t>(1));
+
+        for (size_t i = 0; i < 8; ++i) {
+            mTo[i] = power.val();
+            power *= Composite(static_cast<uint8_t>(beta));
+        }
+
+        std::array<uint8_t, 256> image{};
+        std::array<bool, 256> hit{};
+        op::NibbleMap to = op::NibbleMap::fromColumns(mTo);
+
+        for (size_t x = 0; x < 256; ++x) {
+            image[to(static_cast<uint8_t>(x))] = static_cast<uint8_t>(x);
+            hit[to(static_cast<uint8_t>(x))]   = true;
+        }
+
+        // A reducible modulus may still have a root in a subfield, whose powers span only the subfield
+        if (std::find(hit.begin(), hit.end(), false) != hit.end())
+            throw std::invalid_argument("Modulus polynomial is reducible");
+
+        for (size_t i = 0; i < 8; ++i)
+            mFrom[i] = image[1U << i];
+
+        mToMap   = to;
+        mFromMap = op::NibbleMap::fromColumns(mFrom);
+    }
+
+    /**
+     * @return Shared instance, generated on first use.
+     */
+    static const CompositeIsomorphism& get() {
+        static const CompositeIsomorphism iso;
+        return iso;
+    }
+
+    /**
+     * Columns of the binary -> composite matrix (<tt>column i = beta^i</tt>).
+     */
+    const std::array<uint8_t, 8>& toCompositeMatrix() const noexcept { return mTo; }
+
+    /**
+     * Columns of the composite -> binary matrix.
+     */
+    const std::array<uint8_t, 8>& fromCompositeMatrix() const noexcept { return mFrom; }
+
+    Composite toComposite(const Binary& a) const { return Composite(mToMap(static_cast<uint8_t>(a.val()))); }
+
+    Binary fromComposite(const Composite& a) const { return Binary(mFromMap(a.val())); }
+
+    /**
+     * Convert \c n bytes from the polynomial basis to the packed composite form.
+     */
+    void toComposite(const uint8_t* in, uint8_t* out, size_t n) const noexcept {
+        op::applyNibbleMap(mToMap, in, out, n);
+    }
+
+    /**
+     * Convert \c n bytes from the packed composite form to the polynomial basis.
+     */
+    void fromComposite(const uint8_t* in, uint8_t* out, size_t n) const noexcept {
+        op::applyNibbleMap(mFromMap, in, out, n);
+    }
+
+private:
+    std::array<uint8_t, 8> mTo;
+    std::array<uint8_t, 8> mFrom;
+
+    op::NibbleMap mToMap;
+    op::NibbleMap mFromMap;
+};
+}
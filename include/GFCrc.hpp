@@ -0,0 +1,315 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "GFModulus.hpp"
+#include "GFWide.hpp"
+#include "GFbase.hpp"
+
+namespace GFlinalg {
+
+/**
+ * Checksum kernel used by \c CrcEngine::update.
+ */
+enum class CrcMethod {
+    Slicing8,   /*!<Eight lookups per 64-bit word*/
+    Slicing16,  /*!<Sixteen lookups per 128-bit block*/
+    Clmul,      /*!<Four-lane carry-less folding of 64-byte blocks, slicing for the rest*/
+    Best        /*!<Clmul when the target has PCLMULQDQ, Slicing16 otherwise*/
+};
+
+/**
+ * Table-driven CRC with the generator polynomial \c modPol of degree <tt>1..64</tt>, written with its
+ * leading term like the modulus of \c BasicBinPolynomial (e.g. <tt>0x104C11DB7</tt> for CRC-32).
+ *
+ * The remaining parameters follow the usual CRC model: \c reflected selects LSB-first processing of
+ * the input bytes together with a reflected result, \c init is the initial register in its
+ * unreflected form and \c xorOut is XORed into the result.
+ *
+ * Checksums are continued zlib-style: <tt>update(checksum(a), b) == checksum(a + b)</tt>, and
+ * <tt>combine(checksum(a), checksum(b), b.size())</tt> gives the same value from independently
+ * computed parts. An engine is immutable after construction and may be shared between threads.
+ *
+ * Memory complexity: 16 tables of 256 words
+ */
+template <class T, T modPol>
+class CrcEngine {
+public:
+    static constexpr size_t width = op::modPolDegree<T>(modPol);
+
+    static_assert(width >= 1 && width <= 64, "CRC width must be 1..64");
+
+    explicit CrcEngine(bool reflected, uint64_t init = 0, uint64_t xorOut = 0) :
+        mReflected(reflected), mXorOut(xorOut & op::modulus::lowMask(width)), mTables(16 * 256) {
+        mInit = reflected ? reflect(init & op::modulus::lowMask(width)) : init & op::modulus::lowMask(width);
+
+        const uint64_t low = static_cast<uint64_t>(modPol) & op::modulus::lowMask(width);
+
+        for (size_t b = 0; b < 256; ++b) {
+            uint64_t r;
+
+            if (reflected) {
+                r = b;
+                for (size_t i = 0; i < 8; ++i)
+                    r = (r >> 1) ^ (reflect(low) & (uint64_t(0) - (r & 1)));
+            } else {
+                r = uint64_t(b) << 56;
+                for (size_t i = 0; i < 8; ++i)
+                    r = (r << 1) ^ ((low << (64 - width)) & (uint64_t(0) - (r >> 63)));
+            }
+
+            mTables[b] = r;
+        }
+
+        for (size_t k = 1; k < 16; ++k) {
+            for (size_t b = 0; b < 256; ++b) {
+                uint64_t prev = mTables[(k - 1) * 256 + b];
+
+                mTables[k * 256 + b] = reflected ? (prev >> 8) ^ mTables[prev & 0xFF]
+                                                 : (prev << 8) ^ mTables[prev >> 56];
+            }
+        }
+
+        // x^d mod modPol for the folding distances, in the register representation
+        const size_t distances[] = {128, 192, 512, 576};
+
+        for (size_t i = 0; i < 4; ++i) {
+            uint64_t k = op::modulus::powMod(op::modulus::xMod(low, width), distances[i], low, width);
+            mFold[i] = reflected ? op::ClmulPortable::rev64(k) : k;
+        }
+    }
+
+    bool reflected() const noexcept { return mReflected; }
+
+    //! Checksum of the empty message
+    uint64_t empty() const noexcept { return finish(mReflected ? mInit : mInit << (64 - width)); }
+
+    uint64_t checksum(const void* data, size_t size, CrcMethod method = CrcMethod::Best) const {
+        return update(empty(), data, size, method);
+    }
+
+    /**
+     * Checksum of a contiguous container (\c std::vector, \c std::string, \c std::array...).
+     */
+    template <class Container>
+    uint64_t checksum(const Container& data) const {
+        return checksum(data.data(), data.size() * sizeof(*data.data()));
+    }
+
+    /**
+     * @return Checksum of the message whose prefix has the checksum \c crc, continued by \c size bytes at \c data.
+     */
+    uint64_t update(uint64_t crc, const void* data, size_t size, CrcMethod method = CrcMethod::Best) const {
+        auto in = static_cast<const uint8_t*>(data);
+        uint64_t r = start(crc);
+
+        if (method == CrcMethod::Best)
+            method = op::hasClmul ? CrcMethod::Clmul : CrcMethod::Slicing16;
+
+        if (method == CrcMethod::Clmul && size >= 256) {
+            size_t folded = size & ~size_t(63);
+
+            r = fold(r, in, folded);
+            in += folded;
+            size -= folded;
+        }
+
+        if (method != CrcMethod::Slicing8) {
+            for (; size >= 16; size -= 16, in += 16)
+                r = slice16(r, in);
+        }
+
+        for (; size >= 8; size -= 8, in += 8)
+            r = slice8(r, in);
+
+        for (; size > 0; --size, ++in)
+            r = mReflected ? (r >> 8) ^ mTables[(r ^ *in) & 0xFF] : (r << 8) ^ mTables[(r >> 56) ^ *in];
+
+        return finish(r);
+    }
+
+    /**
+     * @return Checksum of \c a followed by \c b, where \c crc1 and \c crc2 are the checksums of \c a and \c b
+     * and \c size2 is the length of \c b in bytes.
+     *
+     * Time complexity: O(width^2 * log(size2))
+     */
+    uint64_t combine(uint64_t crc1, uint64_t crc2, uint64_t size2) const {
+        // crc(a + b) = (crc(a) ^ xorOut ^ init) * x^(8 * size2) ^ crc(b)
+        const uint64_t low = static_cast<uint64_t>(modPol) & op::modulus::lowMask(width);
+
+        uint64_t v = crc1 ^ mXorOut ^ mInit;
+        uint64_t shift = op::modulus::xMod(low, width);
+        uint64_t res = mReflected ? reflect(v) : v;
+
+        // x^(8 * size2) by squaring, the exponent itself may not fit 64 bits
+        for (size_t i = 0; i < 3; ++i)
+            shift = op::modulus::mulMod(shift, shift, low, width);
+
+        for (; size2; size2 >>= 1) {
+            if (size2 & 1)
+                res = op::modulus::mulMod(res, shift, low, width);
+
+            shift = op::modulus::mulMod(shift, shift, low, width);
+        }
+
+        return (mReflected ? reflect(res) : res) ^ crc2;
+    }
+
+    /**
+     * Splits the message into \c threads parts, checksums them concurrently and combines the results.
+     */
+    uint64_t checksumParallel(const void* data, size_t size, unsigned threads = std::thread::hardware_concurrency()) const {
+        auto in = static_cast<const uint8_t*>(data);
+
+        if (threads < 2 || size < threads * size_t(1 << 16))
+            return checksum(data, size);
+
+        std::vector<uint64_t> parts(threads);
+        std::vector<std::thread> workers;
+        size_t chunk = size / threads;
+
+        for (unsigned t = 0; t < threads; ++t) {
+            size_t begin = t * chunk;
+            size_t end = t + 1 == threads ? size : begin + chunk;
+
+            workers.emplace_back([this, &parts, in, t, begin, end] { parts[t] = checksum(in + begin, end - begin); });
+        }
+
+        for (auto& w : workers)
+            w.join();
+
+        uint64_t crc = parts[0];
+
+        for (unsigned t = 1; t < threads; ++t)
+            crc = combine(crc, parts[t], (t + 1 == threads ? size : (t + 1) * chunk) - t * chunk);
+
+        return crc;
+    }
+
+private:
+    bool mReflected;
+    uint64_t mInit, mXorOut;         /*!<Both as they appear in the result*/
+    std::vector<uint64_t> mTables;   /*!<Table k maps a byte to its remainder followed by k zero bytes*/
+    std::array<uint64_t, 4> mFold{}; /*!<x^128, x^192, x^512 and x^576 mod modPol*/
+
+    static uint64_t reflect(uint64_t v) noexcept { return op::ClmulPortable::rev64(v) >> (64 - width); }
+
+    /**
+     * Register in the working representation: low bits for the reflected CRC, high bits otherwise.
+     */
+    uint64_t start(uint64_t crc) const noexcept {
+        crc = (crc ^ mXorOut) & op::modulus::lowMask(width);
+        return mReflected ? crc : crc << (64 - width);
+    }
+
+    uint64_t finish(uint64_t r) const noexcept { return (mReflected ? r : r >> (64 - width)) ^ mXorOut; }
+
+    uint64_t load(const uint8_t* p) const noexcept {
+        uint64_t v;
+        std::memcpy(&v, p, sizeof(v));
+        return mReflected ? v : __builtin_bswap64(v);
+    }
+
+    void store(uint8_t* p, uint64_t v) const noexcept {
+        v = mReflected ? v : __builtin_bswap64(v);
+        std::memcpy(p, &v, sizeof(v));
+    }
+
+    /**
+     * Byte \c i of \c x in processing order.
+     */
+    size_t byteAt(uint64_t x, size_t i) const noexcept {
+        return mReflected ? (x >> (8 * i)) & 0xFF : (x >> (56 - 8 * i)) & 0xFF;
+    }
+
+    uint64_t slice8(uint64_t r, const uint8_t* p) const noexcept {
+        uint64_t x = r ^ load(p);
+        uint64_t res = 0;
+
+        for (size_t i = 0; i < 8; ++i)
+            res ^= mTables[(7 - i) * 256 + byteAt(x, i)];
+
+        return res;
+    }
+
+    uint64_t slice16(uint64_t r, const uint8_t* p) const noexcept {
+        uint64_t x = r ^ load(p);
+        uint64_t y = load(p + 8);
+        uint64_t res = 0;
+
+        for (size_t i = 0; i < 8; ++i)
+            res ^= mTables[(15 - i) * 256 + byteAt(x, i)] ^ mTables[(7 - i) * 256 + byteAt(y, i)];
+
+        return res;
+    }
+
+    /**
+     * <tt>(hi, lo) * x^128</tt> folded back to 128 bits with the constants \c kLo = x^d and \c kHi = x^(d+64).
+     *
+     * For the reflected CRC words hold the bits in reversed order, and a carry-less product of reversed
+     * operands is the reversed product shifted by one bit.
+     */
+    void fold128(uint64_t& hi, uint64_t& lo, uint64_t kLo, uint64_t kHi) const noexcept {
+        uint64_t a0, a1, b0, b1;
+
+        op::clmul64(hi, kHi, a0, a1);
+        op::clmul64(lo, kLo, b0, b1);
+
+        a0 ^= b0;
+        a1 ^= b1;
+
+        if (mReflected) {
+            hi = a0 << 1;
+            lo = (a1 << 1) | (a0 >> 63);
+        } else {
+            hi = a1;
+            lo = a0;
+        }
+    }
+
+    /**
+     * Checksum register after \c size bytes, \c size a multiple of 64 and at least 128.
+     *
+     * The register is added to the first bytes of the message, four 128-bit lanes are folded 512 bits
+     * at a time, the lanes are folded into one, and the remaining 128 bits go through the tables.
+     */
+    uint64_t fold(uint64_t r, const uint8_t* in, size_t size) const {
+        uint64_t hi[4], lo[4];
+
+        for (size_t j = 0; j < 4; ++j) {
+            hi[j] = load(in + 16 * j);
+            lo[j] = load(in + 16 * j + 8);
+        }
+
+        hi[0] ^= r;
+
+        for (size_t pos = 64; pos < size; pos += 64) {
+            for (size_t j = 0; j < 4; ++j) {
+                fold128(hi[j], lo[j], mFold[2], mFold[3]);
+
+                hi[j] ^= load(in + pos + 16 * j);
+                lo[j] ^= load(in + pos + 16 * j + 8);
+            }
+        }
+
+        for (size_t j = 1; j < 4; ++j) {
+            fold128(hi[0], lo[0], mFold[0], mFold[1]);
+
+            hi[0] ^= hi[j];
+            lo[0] ^= lo[j];
+        }
+
+        uint8_t rest[16];
+
+        store(rest, hi[0]);
+        store(rest + 8, lo[0]);
+
+        return slice16(0, rest);
+    }
+};
+
+} // namespace GFlinalg
@@ -0,0 +1,252 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "GFRegion.hpp"
+#include "GFTPlinalg.hpp"
+#include "GFView.hpp"
+
+/**
+ * @defgroup Dense
+ *
+ * Dense matrices whose dimensions are chosen at run time. \c MatrixEngine fixes them at compile time,
+ * which does not suit the large matrices of erasure and network codes.
+ */
+
+namespace GFlinalg {
+namespace op {
+
+//! Columns of \c C updated together by the blocked product
+constexpr size_t denseColumnBlock = 1024;
+//! Rows of \c B, one per step, that stay in the cache for a column block
+constexpr size_t denseDepthBlock = 128;
+
+//! Whether the views hold the bytes of a field of degree 8, so that rows can go through the region kernels
+template <class Elem, class... Views>
+constexpr bool regionViews() {
+    using T = std::decay_t<decltype(std::declval<const Elem&>().val())>;
+
+    return op::modPolDegree<T>(Elem::getMod()) == 8 && addressableViews<Views...>() &&
+           (std::is_same_v<ViewValue<Views>, uint8_t> && ...);
+}
+
+/**
+ * <tt>C = A * B</tt>, or <tt>C += A * B</tt> if \c accumulate, on views of the values of \c Elem (of
+ * arrays or of a \c MatrixEngine). Over \c GF(2^8), when the rows of \c B and \c C are contiguous
+ * bytes, every step is one region kernel <tt>C_i += a_ik * B_k</tt> on a block of columns; the blocks of
+ * \c B are reused for all rows of \c A while they are in the cache. Otherwise the element arithmetic
+ * runs in the same order.
+ *
+ * \c C must not overlap \c A or \c B.
+ */
+template <class Elem, class ViewA, class ViewB, class ViewC>
+void multiplyDense(const ViewA& a, const ViewB& b, const ViewC& c, bool accumulate) {
+    using V = ViewValue<ViewC>;
+
+    // Stores of bytes may alias the views, the extents are read once
+    const size_t rows = c.rows(), cols = c.columns(), inner = a.columns();
+    const bool regions = b.contiguousRows() && c.contiguousRows();
+
+    if (!accumulate && cols != 0) {
+        for (size_t i = 0; i < rows; ++i) {
+            if constexpr (addressableViews<ViewC>()) {
+                if (c.contiguousRows()) {
+                    std::fill(&c(i, 0), &c(i, 0) + cols, V(0));
+                    continue;
+                }
+            }
+
+            for (size_t j = 0; j < cols; ++j)
+                viewValue(c(i, j)) = V(0);
+        }
+    }
+
+    for (size_t jj = 0; jj < cols; jj += denseColumnBlock) {
+        const size_t width = std::min(denseColumnBlock, cols - jj);
+
+        for (size_t kk = 0; kk < inner; kk += denseDepthBlock) {
+            const size_t depth = std::min(denseDepthBlock, inner - kk);
+
+            for (size_t i = 0; i < rows; ++i) {
+                if constexpr (regionViews<Elem, ViewA, ViewB, ViewC>()) {
+                    if (regions) {
+                        const auto& field = op::RegionField<Elem>::get();
+                        V* out = &c(i, jj);
+
+                        for (size_t k = kk; k < kk + depth; ++k)
+                            field.mulAdd(a(i, k), &b(k, jj), out, width);
+
+                        continue;
+                    }
+                }
+
+                for (size_t k = kk; k < kk + depth; ++k) {
+                    const V x = static_cast<V>(viewValue(a(i, k)));
+
+                    if (x)
+                        for (size_t j = jj; j < jj + width; ++j)
+                            viewValue(c(i, j)) ^= static_cast<V>((Elem(x) * Elem(viewValue(b(k, j)))).val());
+                }
+            }
+        }
+    }
+}
+} // namespace op
+
+/**
+ * Dense row major \c rows x \c cols matrix of \c Elem, e.g. \c BasicBinPolynomial or one of its table
+ * variants. Only the values are stored, row after row.
+ *
+ * Time complexity:
+ * <ul>
+ *   <li>product - O(rows * cols * inner) multiplications, region kernels over \c GF(2^8)</li>
+ *   <li>sum - O(rows * cols)</li>
+ * </ul>
+ *
+ * Memory complexity: O(rows * cols)
+ */
+template <class Elem>
+class DenseMatrix {
+public:
+    using ElemValue = std::decay_t<decltype(std::declval<const Elem&>().val())>;
+
+    //! Stored type, a byte for fields of degree up to 8 so that the region kernels apply
+    using Value = std::conditional_t<op::modPolDegree<ElemValue>(Elem::getMod()) <= 8, uint8_t, ElemValue>;
+
+    DenseMatrix() : DenseMatrix(0, 0) {}
+
+    //! Zero matrix
+    DenseMatrix(size_t rows, size_t cols) : mRows(rows), mCols(cols), mData(rows * cols, 0) {}
+
+    static DenseMatrix identity(size_t n) {
+        DenseMatrix res(n, n);
+
+        for (size_t i = 0; i < n; ++i)
+            res.mData[i * n + i] = 1;
+
+        return res;
+    }
+
+    /**
+     * @throws std::invalid_argument if \c data does not have <tt>rows * cols</tt> entries.
+     */
+    static DenseMatrix fromElements(const std::vector<Elem>& data, size_t rows, size_t cols) {
+        if (data.size() != rows * cols)
+            throw std::invalid_argument("Dense matrix size does not match its dimensions");
+
+        DenseMatrix res(rows, cols);
+
+        for (size_t i = 0; i < data.size(); ++i)
+            res.mData[i] = static_cast<Value>(data[i].val());
+
+        return res;
+    }
+
+    //! Copy of the values seen through \c v, e.g. gathered rows of a \c MatrixEngine
+    template <class Layout, class Accessor>
+    static DenseMatrix fromView(const MatrixView<Layout, Accessor>& v) {
+        DenseMatrix res(v.rows(), v.columns());
+
+        for (size_t i = 0; i < v.rows(); ++i)
+            for (size_t j = 0; j < v.columns(); ++j)
+                res.mData[i * res.mCols + j] = static_cast<Value>(op::viewValue(v(i, j)));
+
+        return res;
+    }
+
+    //! Row major copy of the elements
+    std::vector<Elem> toElements() const {
+        std::vector<Elem> res;
+
+        res.reserve(mData.size());
+
+        for (Value v : mData)
+            res.push_back(Elem(v));
+
+        return res;
+    }
+
+    [[nodiscard]] size_t rows() const noexcept { return mRows; }
+
+    [[nodiscard]] size_t columns() const noexcept { return mCols; }
+
+    Value* data() noexcept { return mData.data(); }
+
+    const Value* data() const noexcept { return mData.data(); }
+
+    Value* row(size_t i) noexcept { return mData.data() + i * mCols; }
+
+    const Value* row(size_t i) const noexcept { return mData.data() + i * mCols; }
+
+    Elem operator()(size_t i, size_t j) const noexcept { return Elem(mData[i * mCols + j]); }
+
+    void set(size_t i, size_t j, const Elem& e) noexcept { mData[i * mCols + j] = static_cast<Value>(e.val()); }
+
+    //! Row major view of the values, for submatrices and the kernels
+    StridedView<AccessorValue::Accessor<Value>> view() noexcept { return makeView(mData.data(), mRows, mCols, mCols); }
+
+    StridedView<AccessorValue::Accessor<const Value>> view() const noexcept {
+        return makeView(mData.data(), mRows, mCols, mCols);
+    }
+
+    bool operator==(const DenseMatrix& other) const noexcept {
+        return mRows == other.mRows && mCols == other.mCols && mData == other.mData;
+    }
+
+    bool operator!=(const DenseMatrix& other) const noexcept { return !(*this == other); }
+
+    /**
+     * @throws std::invalid_argument if the dimensions differ.
+     */
+    DenseMatrix& operator+=(const DenseMatrix& other) {
+        if (mRows != other.mRows || mCols != other.mCols)
+            throw std::invalid_argument("Dense matrix dimensions do not match");
+
+        for (size_t i = 0; i < mData.size(); ++i)
+            mData[i] ^= other.mData[i];
+
+        return *this;
+    }
+
+    friend DenseMatrix operator+(DenseMatrix a, const DenseMatrix& b) { return a += b; }
+
+    /**
+     * Blocked product, see \c op::multiplyDense.
+     *
+     * @throws std::invalid_argument if <tt>a.columns() != b.rows()</tt>.
+     */
+    friend DenseMatrix operator*(const DenseMatrix& a, const DenseMatrix& b) {
+        if (a.mCols != b.mRows)
+            throw std::invalid_argument("Dense matrix dimensions do not match");
+
+        DenseMatrix c(a.mRows, b.mCols);
+
+        op::multiplyDense<Elem>(a.view(), b.view(), c.view(), false);
+        return c;
+    }
+
+private:
+    size_t mRows, mCols;
+    std::vector<Value> mData;
+};
+
+/**
+ * <tt>C = A * B</tt> on views of the values of \c Elem, e.g. gathered rows of a generator matrix times
+ * a column block of data. See \c op::multiplyDense.
+ *
+ * @throws std::invalid_argument if the dimensions do not match.
+ */
+template <class Elem, class ViewA, class ViewB, class ViewC>
+void multiply(const ViewA& a, const ViewB& b, const ViewC& c) {
+    if (a.columns() != b.rows() || c.rows() != a.rows() || c.columns() != b.columns())
+        throw std::invalid_argument("Dense matrix dimensions do not match");
+
+    op::multiplyDense<Elem>(a, b, c, false);
+}
+
+} // namespace GFlinalg
@@ -0,0 +1,390 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+#include "GFWide.hpp"
+
+namespace GFlinalg {
+namespace op {
+namespace ghash {
+
+/**
+ * @return 64-bit word stored big-endian at \c p.
+ */
+inline uint64_t load64(const uint8_t* p) noexcept {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return __builtin_bswap64(v);
+}
+
+inline void store64(uint8_t* p, uint64_t v) noexcept {
+    v = __builtin_bswap64(v);
+    std::memcpy(p, &v, sizeof(v));
+}
+
+/**
+ * Unreduced 256-bit carry-less product, \c w[3] holds the most significant word.
+ */
+struct Product {
+    std::array<uint64_t, 4> w{};
+};
+
+/**
+ * <tt>acc ^= a * b</tt>, Karatsuba over the 64-bit halves; \c bSum is <tt>bHi ^ bLo</tt>.
+ */
+inline void mulAcc(Product& acc, uint64_t aHi, uint64_t aLo, uint64_t bHi, uint64_t bLo, uint64_t bSum) noexcept {
+    uint64_t l0, l1, h0, h1, m0, m1;
+
+    clmul64(aLo, bLo, l0, l1);
+    clmul64(aHi, bHi, h0, h1);
+    clmul64(aHi ^ aLo, bSum, m0, m1);
+
+    m0 ^= l0 ^ h0;
+    m1 ^= l1 ^ h1;
+
+    acc.w[0] ^= l0;
+    acc.w[1] ^= l1 ^ m0;
+    acc.w[2] ^= h0 ^ m1;
+    acc.w[3] ^= h1;
+}
+
+/**
+ * Reduces a product of two bit-reflected elements by <tt>x^128 + x^7 + x^2 + x + 1</tt>.
+ *
+ * The product of reflected operands is the reflected product shifted right by one, so it is
+ * shifted back first; the bits of the two low words are the terms of degree 128 and above.
+ */
+inline void reduce(const Product& p, uint64_t& hi, uint64_t& lo) noexcept {
+    uint64_t x3 = (p.w[3] << 1) | (p.w[2] >> 63);
+    uint64_t x2 = (p.w[2] << 1) | (p.w[1] >> 63);
+    uint64_t x1 = (p.w[1] << 1) | (p.w[0] >> 63);
+    uint64_t x0 = p.w[0] << 1;
+
+    uint64_t d  = x1 ^ (x0 << 63) ^ (x0 << 62) ^ (x0 << 57);
+
+    hi = x3 ^ d ^ (d >> 1) ^ (d >> 2) ^ (d >> 7);
+    lo = x2 ^ x0 ^ ((x0 >> 1) | (d << 63)) ^ ((x0 >> 2) | (d << 62)) ^ ((x0 >> 7) | (d << 57));
+}
+
+} // namespace ghash
+} // namespace op
+
+/**
+ * Element of \c GF(2^128) defined by <tt>x^128 + x^7 + x^2 + x + 1</tt> in the bit-reflected
+ * convention of GCM: a 16-byte block read big-endian is the value, and its most significant bit is
+ * the coefficient of \c x^0.
+ *
+ * Time complexity:
+ * <ul>
+ *   <li>"+" - O(1)</li>
+ *   <li>"*" - three 64-bit carry-less multiplications and a shift-XOR reduction</li>
+ *   <li>"/" - 127 squarings and 12 multiplications</li>
+ * </ul>
+ *
+ * Memory complexity: O(1)
+ */
+class GcmBinPolynomial {
+public:
+    using Limbs = std::array<uint64_t, 2>;
+
+    explicit GcmBinPolynomial() : hi(0), lo(0) {}
+
+    /**
+     * \param hi first eight bytes of the block read big-endian, \c x^0..x^63.
+     * \param lo last eight bytes of the block read big-endian, \c x^64..x^127.
+     */
+    explicit GcmBinPolynomial(uint64_t hi, uint64_t lo) : hi(hi), lo(lo) {}
+
+    /**
+     * @return Element encoded by the 16 bytes at \c block.
+     */
+    static GcmBinPolynomial fromBytes(const uint8_t* block) {
+        return GcmBinPolynomial(op::ghash::load64(block), op::ghash::load64(block + 8));
+    }
+
+    void toBytes(uint8_t* block) const {
+        op::ghash::store64(block, hi);
+        op::ghash::store64(block + 8, lo);
+    }
+
+    //! Multiplicative identity, the polynomial \c 1
+    static GcmBinPolynomial one() { return GcmBinPolynomial(uint64_t(1) << 63, 0); }
+
+    //! Returns \c {hi, lo}
+    Limbs val() const noexcept { return {hi, lo}; }
+
+    static constexpr size_t gfDegree() { return 128; }
+
+    bool isZero() const noexcept { return (hi | lo) == 0; }
+
+    //! Calculates the degree of the polynomial, 0 for the zero polynomial
+    size_t degree() const noexcept {
+        if (lo)
+            return 127 - __builtin_ctzll(lo);
+        if (hi)
+            return 63 - __builtin_ctzll(hi);
+        return 0;
+    }
+
+    GcmBinPolynomial square() const { return *this * *this; }
+
+    /**
+     * Itoh-Tsujii inversion: <tt>a^(-1) = (a^(2^127 - 1))^2</tt>; the zero element maps to zero.
+     */
+    GcmBinPolynomial getInverse() const {
+        // beta = a^(2^k - 1), k runs over the prefixes of 127 = 1111111b
+        GcmBinPolynomial beta = *this;
+        size_t k = 1;
+
+        for (size_t bit = 6; bit-- > 0;) {
+            GcmBinPolynomial t = beta;
+
+            for (size_t i = 0; i < k; ++i)
+                t = t.square();
+
+            beta = t * beta;
+            k <<= 1;
+
+            beta = beta.square() * *this;
+            ++k;
+        }
+
+        return beta.square();
+    }
+
+    friend GcmBinPolynomial operator+(const GcmBinPolynomial& a, const GcmBinPolynomial& b) {
+        return GcmBinPolynomial(a.hi ^ b.hi, a.lo ^ b.lo);
+    }
+
+    friend GcmBinPolynomial operator-(const GcmBinPolynomial& a, const GcmBinPolynomial& b) { return a + b; }
+
+    GcmBinPolynomial& operator+=(const GcmBinPolynomial& other) {
+        hi ^= other.hi;
+        lo ^= other.lo;
+        return *this;
+    }
+
+    friend GcmBinPolynomial operator*(const GcmBinPolynomial& a, const GcmBinPolynomial& b) {
+        op::ghash::Product p;
+        GcmBinPolynomial res;
+
+        op::ghash::mulAcc(p, a.hi, a.lo, b.hi, b.lo, b.hi ^ b.lo);
+        op::ghash::reduce(p, res.hi, res.lo);
+
+        return res;
+    }
+
+    GcmBinPolynomial& operator*=(const GcmBinPolynomial& other) {
+        *this = *this * other;
+        return *this;
+    }
+
+    friend GcmBinPolynomial operator/(const GcmBinPolynomial& a, const GcmBinPolynomial& b) {
+        if (b.isZero())
+            throw std::out_of_range("Division by zero");
+
+        return a * b.getInverse();
+    }
+
+    GcmBinPolynomial& operator/=(const GcmBinPolynomial& other) {
+        *this = *this / other;
+        return *this;
+    }
+
+    friend bool operator==(const GcmBinPolynomial& a, const GcmBinPolynomial& b) {
+        return a.hi == b.hi && a.lo == b.lo;
+    }
+
+    friend bool operator!=(const GcmBinPolynomial& a, const GcmBinPolynomial& b) { return !(a == b); }
+
+    /**
+     * Writes the element as its 16-byte block in hex.
+     */
+    friend std::ostream& operator<<(std::ostream& out, const GcmBinPolynomial& a) {
+        static const char digits[] = "0123456789abcdef";
+        uint8_t block[16];
+        std::string text;
+
+        a.toBytes(block);
+
+        for (uint8_t b : block) {
+            text.push_back(digits[b >> 4]);
+            text.push_back(digits[b & 0xF]);
+        }
+
+        out.write(text.data(), text.size());
+        return out;
+    }
+
+private:
+    uint64_t hi, lo;
+
+    friend class GhashHasher;
+};
+
+/**
+ * Streaming GHASH: <tt>Y = (Y + X_i) * H</tt> over 16-byte blocks \c X_i.
+ *
+ * Full blocks are taken \c aggregate at a time as
+ * <tt>Y = (Y + X_1) * H^8 + X_2 * H^7 + ... + X_8 * H</tt>: the eight products are accumulated
+ * unreduced and the sum is reduced once. Input is read in place, only a trailing partial block is
+ * buffered between \c update() calls.
+ */
+class GhashHasher {
+public:
+    static constexpr size_t blockSize = 16;
+    static constexpr size_t aggregate = 8;
+
+    explicit GhashHasher(const GcmBinPolynomial& key) {
+        GcmBinPolynomial p = key;
+
+        for (size_t i = 0; i < aggregate; ++i) {
+            mPowers[i] = p;
+            mPowerSums[i] = p.hi ^ p.lo;
+            p *= key;
+        }
+
+        reset();
+    }
+
+    /**
+     * \param key the 16 bytes of the hash key \c H.
+     */
+    explicit GhashHasher(const uint8_t* key) : GhashHasher(GcmBinPolynomial::fromBytes(key)) {}
+
+    /**
+     * Absorbs \c size bytes at \c data.
+     */
+    GhashHasher& update(const void* data, size_t size) {
+        auto in = static_cast<const uint8_t*>(data);
+
+        mTotal += size;
+
+        if (mBuffered) {
+            size_t take = std::min(size, blockSize - mBuffered);
+
+            std::memcpy(mBuffer.data() + mBuffered, in, take);
+            mBuffered += take;
+            in += take;
+            size -= take;
+
+            if (mBuffered < blockSize)
+                return *this;
+
+            absorb(mBuffer.data(), 1);
+            mBuffered = 0;
+        }
+
+        absorb(in, size / blockSize);
+        in += size - size % blockSize;
+
+        mBuffered = size % blockSize;
+        std::memcpy(mBuffer.data(), in, mBuffered);
+
+        return *this;
+    }
+
+    /**
+     * Absorbs the contents of a contiguous container (\c std::vector, \c std::string, \c std::array...).
+     */
+    template <class Container>
+    GhashHasher& update(const Container& data) {
+        return update(data.data(), data.size() * sizeof(*data.data()));
+    }
+
+    /**
+     * Zero pads the pending partial block, e.g. between the additional data and the ciphertext of GCM.
+     */
+    GhashHasher& pad() {
+        if (mBuffered) {
+            std::memset(mBuffer.data() + mBuffered, 0, blockSize - mBuffered);
+            absorb(mBuffer.data(), 1);
+            mTotal += blockSize - mBuffered;
+            mBuffered = 0;
+        }
+
+        return *this;
+    }
+
+    /**
+     * @return Hash of the input so far, the pending partial block zero padded; the hasher is not modified.
+     */
+    GcmBinPolynomial digest() const {
+        GhashHasher copy(*this);
+        return copy.pad().mState;
+    }
+
+    void digest(uint8_t* out) const { digest().toBytes(out); }
+
+    //! Bytes absorbed since the last reset, padding included
+    uint64_t size() const noexcept { return mTotal; }
+
+    void reset() {
+        mState = GcmBinPolynomial();
+        mBuffered = 0;
+        mTotal = 0;
+    }
+
+private:
+    std::array<GcmBinPolynomial, aggregate> mPowers;   /*!<H^1..H^aggregate*/
+    std::array<uint64_t, aggregate> mPowerSums{};      /*!<hi ^ lo of the powers, for Karatsuba*/
+    GcmBinPolynomial mState;
+    std::array<uint8_t, blockSize> mBuffer{};
+    size_t mBuffered = 0;
+    uint64_t mTotal = 0;
+
+    void absorb(const uint8_t* in, size_t blocks) {
+        for (; blocks >= aggregate; blocks -= aggregate, in += aggregate * blockSize) {
+            op::ghash::Product p;
+
+            for (size_t i = 0; i < aggregate; ++i) {
+                const GcmBinPolynomial& h = mPowers[aggregate - 1 - i];
+
+                uint64_t xHi = op::ghash::load64(in + i * blockSize);
+                uint64_t xLo = op::ghash::load64(in + i * blockSize + 8);
+
+                if (i == 0) {
+                    xHi ^= mState.hi;
+                    xLo ^= mState.lo;
+                }
+
+                op::ghash::mulAcc(p, xHi, xLo, h.hi, h.lo, mPowerSums[aggregate - 1 - i]);
+            }
+
+            op::ghash::reduce(p, mState.hi, mState.lo);
+        }
+
+        for (; blocks > 0; --blocks, in += blockSize) {
+            op::ghash::Product p;
+
+            op::ghash::mulAcc(p, mState.hi ^ op::ghash::load64(in), mState.lo ^ op::ghash::load64(in + 8),
+                              mPowers[0].hi, mPowers[0].lo, mPowerSums[0]);
+            op::ghash::reduce(p, mState.hi, mState.lo);
+        }
+    }
+};
+
+/**
+ * GHASH of GCM: the additional data and the text, each zero padded to whole blocks, followed by
+ * the block of their bit lengths.
+ */
+inline GcmBinPolynomial ghash(const GcmBinPolynomial& key, const void* aad, size_t aadSize, const void* text,
+                              size_t textSize) {
+    uint8_t lengths[16];
+    GhashHasher hasher(key);
+
+    hasher.update(aad, aadSize).pad().update(text, textSize).pad();
+
+    op::ghash::store64(lengths, uint64_t(aadSize) << 3);
+    op::ghash::store64(lengths + 8, uint64_t(textSize) << 3);
+
+    return hasher.update(lengths, sizeof(lengths)).digest();
+}
+
+} // namespace GFlinalg
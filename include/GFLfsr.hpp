@@ -0,0 +1,202 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "GFTPlinalg.hpp"
+
+namespace GFlinalg {
+
+/**
+ * Galois form LFSR with the feedback polynomial \c modPol of degree up to 63, e.g. the PRBS7
+ * <tt>x^7 + x^6 + 1</tt> or the 802.11 scrambler <tt>x^7 + x^4 + 1</tt>.
+ *
+ * The state is the field element \c S, one step sets <tt>S = S * x</tt> and outputs the coefficient of
+ * <tt>x^(n-1)</tt> before the step, so the output satisfies the linear recurrence with the characteristic
+ * polynomial \c modPol. Bits are packed MSB first.
+ *
+ * Eight steps take two lookups indexed by the top byte of the state, or by the whole state below
+ * degree 8; for a trinomial or a pentanomial
+ * with a large enough gap below the degree up to 56 steps are a few shifts. Jumping \c N steps
+ * multiplies the state by <tt>x^N mod modPol</tt>, computed by squaring, so a stream can be split
+ * between threads.
+ *
+ * Time complexity:
+ * <ul>
+ *   <li>byte of output - O(1)</li>
+ *   <li>jump by \c N - O(n^2 * log(N))</li>
+ * </ul>
+ */
+template <class T, T modPol>
+class Lfsr {
+public:
+    using Polynomial = BasicBinPolynomial<T, modPol>;
+
+    static constexpr size_t degree = op::modPolDegree<T>(modPol);
+
+    static_assert(degree >= 1 && degree <= 63, "Feedback polynomial degree must be 1..63");
+
+    //! Output bits per step of \c generate for a trinomial or pentanomial, 0 when the byte tables are used
+    static constexpr size_t wordBits =
+        Polynomial::sparse.sparse ? std::min<size_t>(Polynomial::sparse.gap(), 56) & ~size_t(7) : 0;
+
+    /**
+     * @throws std::invalid_argument if \c seed is zero after the reduction, the register would stay zero.
+     */
+    explicit Lfsr(T seed) : mState(static_cast<uint64_t>(Polynomial(seed).val())) {
+        if (mState == 0)
+            throw std::invalid_argument("LFSR state must not be zero");
+    }
+
+    T state() const noexcept { return static_cast<T>(mState); }
+
+    uint8_t nextBit() noexcept {
+        uint8_t out = (mState >> (degree - 1)) & 1;
+
+        mState = ((mState << 1) & mask()) ^ (low() & (uint64_t(0) - out));
+
+        return out;
+    }
+
+    uint8_t nextByte() noexcept {
+        const Tables& t = tables();
+        size_t top = topByte(mState);
+
+        mState = ((mState << 8) & mask()) ^ t.step[top];
+
+        return t.out[top];
+    }
+
+    uint64_t nextWord() noexcept {
+        uint64_t res = 0;
+
+        for (size_t i = 0; i < 8; ++i)
+            res = (res << 8) | nextByte();
+
+        return res;
+    }
+
+    void generate(uint8_t* out, size_t size) noexcept {
+        size_t i = 0;
+
+        if constexpr (wordBits >= 16) {
+            // The top wordBits of the state are the next output bits, and shifting them out folds
+            // back below the degree without a carry
+            constexpr auto& sparse = Polynomial::sparse;
+
+            for (; size - i >= wordBits / 8; i += wordBits / 8) {
+                uint64_t top = mState >> (degree - wordBits);
+
+                mState = (mState << wordBits) & mask();
+
+                for (size_t k = 0; k < sparse.count; ++k)
+                    mState ^= top << sparse.taps[k];
+
+                for (size_t j = 0; j < wordBits / 8; ++j)
+                    out[i + j] = static_cast<uint8_t>(top >> (wordBits - 8 * (j + 1)));
+            }
+        }
+
+        for (; i < size; ++i)
+            out[i] = nextByte();
+    }
+
+    /**
+     * Same output as \c generate: every thread jumps its copy of the register to the start of its part.
+     */
+    void generateParallel(uint8_t* out, size_t size, unsigned threads = std::thread::hardware_concurrency()) {
+        if (threads < 2 || size < threads * size_t(1 << 12)) {
+            generate(out, size);
+            return;
+        }
+
+        std::vector<std::thread> workers;
+        size_t chunk = size / threads;
+
+        for (unsigned t = 0; t < threads; ++t) {
+            size_t begin = t * chunk;
+            size_t end = t + 1 == threads ? size : begin + chunk;
+
+            workers.emplace_back([copy = *this, out, begin, end]() mutable {
+                copy.jump(uint64_t(begin) << 3);
+                copy.generate(out + begin, end - begin);
+            });
+        }
+
+        for (auto& w : workers)
+            w.join();
+
+        jump(uint64_t(size) << 3);
+    }
+
+    /**
+     * Advances the register by \c steps bits: <tt>S = S * x^steps mod modPol</tt>.
+     */
+    Lfsr& jump(uint64_t steps) {
+        Polynomial x(2);
+        Polynomial s(static_cast<T>(mState), false);
+
+        mState = static_cast<uint64_t>((s * op::pow<Polynomial>(x, steps)).val());
+
+        return *this;
+    }
+
+private:
+    uint64_t mState;
+
+    struct Tables {
+        std::array<uint64_t, 256> step{};  /*!<top byte * x^8 mod modPol, the whole next state below degree 8*/
+        std::array<uint8_t, 256> out{};    /*!<eight output bits of the top byte*/
+    };
+
+    static constexpr uint64_t mask() { return (uint64_t(1) << degree) - 1; }
+
+    static constexpr uint64_t low() { return static_cast<uint64_t>(modPol) & mask(); }
+
+    //! Index of the byte tables: the top byte of the state, the whole state below degree 8
+    static constexpr uint64_t topByte(uint64_t state) {
+        if constexpr (degree >= 8)
+            return state >> (degree - 8);
+        else
+            return state;
+    }
+
+    //! State whose table index is \c h, zero below the top byte
+    static constexpr uint64_t fromTopByte(uint64_t h) {
+        if constexpr (degree >= 8)
+            return h << (degree - 8);
+        else
+            return h & mask();
+    }
+
+    static const Tables& tables() {
+        static const Tables t = [] {
+            Tables res;
+
+            for (uint64_t h = 0; h < 256; ++h) {
+                uint64_t s = fromTopByte(h);
+                uint8_t out = 0;
+
+                for (size_t i = 0; i < 8; ++i) {
+                    uint64_t bit = (s >> (degree - 1)) & 1;
+
+                    out = static_cast<uint8_t>((out << 1) | bit);
+                    s = ((s << 1) & mask()) ^ (low() & (uint64_t(0) - bit));
+                }
+
+                res.step[h] = s;
+                res.out[h] = out;
+            }
+
+            return res;
+        }();
+
+        return t;
+    }
+};
+
+} // namespace GFlinalg
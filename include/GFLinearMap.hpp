@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace GFlinalg {
+namespace op {
+
+/**
+ * Map of \c T words that is linear over \c GF(2), given by the images of the basis vectors
+ * (<tt>columns[i] = f(1 << i)</tt>).
+ *
+ * \c apply uses one 256 entry table per input byte. \c applyConstTime does not index memory with the
+ * input and runs in time independent of it.
+ */
+template <class T>
+class LinearMap {
+public:
+    LinearMap() = default;
+
+    explicit LinearMap(std::vector<T> columns) : mColumns(std::move(columns)) {
+        size_t bytes = (mColumns.size() + 7) >> 3;
+
+        mTables.assign(bytes << 8, 0);
+
+        for (size_t b = 0; b < bytes; ++b) {
+            for (size_t x = 1; x < 256; ++x) {
+                T res = 0;
+
+                for (size_t i = 0; i < 8 && (b << 3) + i < mColumns.size(); ++i)
+                    if ((x >> i) & 1)
+                        res ^= mColumns[(b << 3) + i];
+
+                mTables[(b << 8) + x] = res;
+            }
+        }
+    }
+
+    /**
+     * @return Number of input bits.
+     */
+    [[nodiscard]] size_t size() const noexcept { return mColumns.size(); }
+
+    const std::vector<T>& columns() const noexcept { return mColumns; }
+
+    T operator()(T x) const noexcept { return apply(x); }
+
+    T apply(T x) const noexcept {
+        T res = 0;
+
+        for (size_t b = 0; b < (mTables.size() >> 8); ++b)
+            res ^= mTables[(b << 8) + ((x >> (b << 3)) & 0xFF)];
+
+        return res;
+    }
+
+    T applyConstTime(T x) const noexcept {
+        T res = 0;
+
+        for (size_t i = 0; i < mColumns.size(); ++i)
+            res ^= mColumns[i] & (T(0) - ((x >> i) & 1));
+
+        return res;
+    }
+
+    /**
+     * <tt>out[i] = f(in[i])</tt> for \c n words.
+     */
+    void apply(const T* in, T* out, size_t n) const noexcept {
+        for (size_t i = 0; i < n; ++i)
+            out[i] = apply(in[i]);
+    }
+
+    /**
+     * <tt>out[i] = f(in[i])</tt> for \c n words.
+     */
+    void applyConstTime(const T* in, T* out, size_t n) const noexcept {
+        for (size_t i = 0; i < n; ++i)
+            out[i] = applyConstTime(in[i]);
+    }
+
+    /**
+     * Inverse of a square map, throws \c std::invalid_argument if the map is singular.
+     */
+    LinearMap inverse() const {
+        size_t n = mColumns.size();
+
+        // Gauss-Jordan elimination on the rows of [A | I]
+        std::vector<T> rows(n, 0), inv(n, 0);
+
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < n; ++j)
+                rows[i] |= static_cast<T>(((mColumns[j] >> i) & 1) << j);
+
+            inv[i] = T(1) << i;
+        }
+
+        for (size_t c = 0; c < n; ++c) {
+            size_t p = c;
+
+            while (p < n && !((rows[p] >> c) & 1))
+                ++p;
+
+            if (p == n)
+                throw std::invalid_argument("Linear map is not invertible");
+
+            std::swap(rows[c], rows[p]);
+            std::swap(inv[c], inv[p]);
+
+            for (size_t r = 0; r < n; ++r) {
+                if (r != c && ((rows[r] >> c) & 1)) {
+                    rows[r] ^= rows[c];
+                    inv[r] ^= inv[c];
+                }
+            }
+        }
+
+        std::vector<T> columns(n, 0);
+
+        for (size_t i = 0; i < n; ++i)
+            for (size_t j = 0; j < n; ++j)
+                columns[j] |= static_cast<T>(((inv[i] >> j) & 1) << i);
+
+        return LinearMap(std::move(columns));
+    }
+
+private:
+    std::vector<T> mColumns;
+    std::vector<T> mTables;
+};
+} // namespace op
+}
@@ -0,0 +1,608 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+/**
+ * @defgroup Modulus
+ *
+ * Irreducibility and primitivity tests for modulus polynomials and a search for primitive polynomials.
+ *
+ * Polynomials of degree \c n <= 64 are given as the pair <tt>(low, n)</tt>: the top term \c x^n is
+ * implicit and \c low holds the remaining coefficients, so <tt>x^64 + x^4 + x^3 + x + 1</tt> is
+ * <tt>(0x1b, 64)</tt>. The \c T overloads take a modulus in the usual form (e.g. \c 0x11d).
+ */
+
+namespace GFlinalg {
+namespace op {
+namespace modulus {
+
+constexpr uint64_t lowMask(size_t n) { return n >= 64 ? ~uint64_t(0) : (uint64_t(1) << n) - 1; }
+
+/**
+ * <tt>a * b mod (x^n + low)</tt> for <tt>a, b</tt> of degree < \c n.
+ */
+constexpr uint64_t mulMod(uint64_t a, uint64_t b, uint64_t low, size_t n) {
+    uint64_t res = 0;
+
+    for (size_t i = n; i-- > 0;) {
+        uint64_t carry = (res >> (n - 1)) & 1;
+
+        res = ((res << 1) & lowMask(n)) ^ (low & (uint64_t(0) - carry));
+
+        if ((b >> i) & 1)
+            res ^= a;
+    }
+
+    return res;
+}
+
+constexpr uint64_t powMod(uint64_t a, uint64_t e, uint64_t low, size_t n) {
+    uint64_t res = 1;
+
+    while (e) {
+        if (e & 1)
+            res = mulMod(res, a, low, n);
+
+        a = mulMod(a, a, low, n);
+        e >>= 1;
+    }
+
+    return res;
+}
+
+/**
+ * @return Degree of a nonzero 128 bit polynomial.
+ */
+constexpr size_t degree128(unsigned __int128 a) {
+    auto hi = static_cast<uint64_t>(a >> 64);
+
+    if (hi)
+        return 127 - __builtin_clzll(hi);
+
+    return 63 - __builtin_clzll(static_cast<uint64_t>(a));
+}
+
+/**
+ * @return Degree of a polynomial, 0 for 0.
+ */
+constexpr size_t degree64(uint64_t a) { return a ? 63 - __builtin_clzll(a) : 0; }
+
+/**
+ * @return <tt>gcd(x^n + low, g)</tt> for a nonzero \c g of degree < \c n.
+ */
+constexpr uint64_t gcd(uint64_t low, size_t n, uint64_t g) {
+    unsigned __int128 a = (static_cast<unsigned __int128>(1) << n) | low;
+    unsigned __int128 b = g;
+
+    while (b != 0) {
+        size_t db = degree128(b);
+
+        while (a != 0 && degree128(a) >= db)
+            a ^= b << (degree128(a) - db);
+
+        unsigned __int128 t = a;
+        a = b;
+        b = t;
+    }
+
+    return static_cast<uint64_t>(a);
+}
+
+/**
+ * Cheap necessary conditions: \c x and <tt>x + 1</tt> must not divide the polynomial.
+ */
+constexpr bool hasLinearFactor(uint64_t low, size_t n) {
+    if (n == 1)
+        return false;
+
+    size_t weight = 1;
+
+    for (uint64_t v = low; v; v &= v - 1)
+        ++weight;
+
+    return !(low & 1) || !(weight & 1);
+}
+
+/**
+ * @return Element \c x of <tt>GF(2)[x] / (x^n + low)</tt>.
+ */
+constexpr uint64_t xMod(uint64_t low, size_t n) { return n == 1 ? low : 2; }
+} // namespace modulus
+
+/**
+ * Ben-Or irreducibility test: <tt>gcd(f, x^(2^i) - x) = 1</tt> for <tt>i = 1..n/2</tt>.
+ *
+ * Stops at the smallest degree of a factor, so reducible polynomials are usually rejected after a few
+ * steps. This is the test used by the search.
+ */
+constexpr bool isIrreducibleBenOr(uint64_t low, size_t n) {
+    if (n == 0 || n > 64 || (n < 64 && (low >> n) != 0))
+        return false;
+
+    if (modulus::hasLinearFactor(low, n))
+        return false;
+
+    uint64_t x = modulus::xMod(low, n);
+    uint64_t u = x;
+
+    for (size_t i = 1; i <= n / 2; ++i) {
+        u = modulus::mulMod(u, u, low, n);
+
+        if (u == x || modulus::gcd(low, n, u ^ x) != 1)
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * Rabin irreducibility test: <tt>x^(2^n) = x mod f</tt> and <tt>gcd(f, x^(2^(n/q)) - x) = 1</tt> for every
+ * prime \c q dividing \c n.
+ */
+constexpr bool isIrreducibleRabin(uint64_t low, size_t n) {
+    if (n == 0 || n > 64 || (n < 64 && (low >> n) != 0))
+        return false;
+
+    if (modulus::hasLinearFactor(low, n))
+        return false;
+
+    uint64_t x = modulus::xMod(low, n);
+
+    for (size_t q = 2, m = n; q <= m; ++q) {
+        if (m % q != 0)
+            continue;
+
+        while (m % q == 0)
+            m /= q;
+
+        uint64_t u = x;
+
+        for (size_t i = 0; i < n / q; ++i)
+            u = modulus::mulMod(u, u, low, n);
+
+        if (u == x || modulus::gcd(low, n, u ^ x) != 1)
+            return false;
+    }
+
+    uint64_t u = x;
+
+    for (size_t i = 0; i < n; ++i)
+        u = modulus::mulMod(u, u, low, n);
+
+    return u == x;
+}
+
+constexpr bool isIrreducible(uint64_t low, size_t n) { return isIrreducibleBenOr(low, n); }
+
+/**
+ * @return \c true if \c modPol (e.g. \c 0x11d) is irreducible.
+ */
+template <class T>
+constexpr bool isIrreducible(const T& modPol) {
+    size_t n = modulus::degree64(static_cast<uint64_t>(modPol));
+
+    if (n == 0)
+        return false;
+
+    return isIrreducible(static_cast<uint64_t>(modPol) ^ (uint64_t(1) << n), n);
+}
+
+namespace modulus {
+
+constexpr uint64_t mulMod64(uint64_t a, uint64_t b, uint64_t m) {
+    return static_cast<uint64_t>(static_cast<unsigned __int128>(a) * b % m);
+}
+
+constexpr uint64_t powMod64(uint64_t a, uint64_t e, uint64_t m) {
+    uint64_t res = 1 % m;
+
+    a %= m;
+
+    while (e) {
+        if (e & 1)
+            res = mulMod64(res, a, m);
+
+        a = mulMod64(a, a, m);
+        e >>= 1;
+    }
+
+    return res;
+}
+
+/**
+ * Deterministic Miller-Rabin for 64 bit numbers.
+ */
+constexpr bool isPrime64(uint64_t p) {
+    if (p < 2)
+        return false;
+
+    constexpr uint64_t bases[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37};
+
+    for (uint64_t b : bases) {
+        if (p % b == 0)
+            return p == b;
+    }
+
+    uint64_t d = p - 1;
+    size_t s = 0;
+
+    while (!(d & 1)) {
+        d >>= 1;
+        ++s;
+    }
+
+    for (uint64_t b : bases) {
+        uint64_t x = powMod64(b, d, p);
+
+        if (x == 1 || x == p - 1)
+            continue;
+
+        bool composite = true;
+
+        for (size_t r = 1; r < s && composite; ++r) {
+            x = mulMod64(x, x, p);
+
+            if (x == p - 1)
+                composite = false;
+        }
+
+        if (composite)
+            return false;
+    }
+
+    return true;
+}
+
+inline uint64_t gcd64(uint64_t a, uint64_t b) {
+    while (b) {
+        uint64_t t = a % b;
+        a = b;
+        b = t;
+    }
+
+    return a;
+}
+
+/**
+ * Pollard rho (Brent's variant) for an odd composite \c m.
+ */
+inline uint64_t pollardRho(uint64_t m) {
+    for (uint64_t c = 1;; ++c) {
+        uint64_t y = 2, x = 2, q = 1, g = 1, ys = 2;
+        size_t r = 1;
+
+        auto f = [&](uint64_t v) {
+            return static_cast<uint64_t>((static_cast<unsigned __int128>(mulMod64(v, v, m)) + c) % m);
+        };
+
+        do {
+            x = y;
+
+            for (size_t i = 0; i < r; ++i)
+                y = f(y);
+
+            for (size_t k = 0; k < r && g == 1; k += 128) {
+                ys = y;
+
+                for (size_t i = 0; i < std::min<size_t>(128, r - k); ++i) {
+                    y = f(y);
+                    q = mulMod64(q, x > y ? x - y : y - x, m);
+                }
+
+                g = gcd64(q, m);
+            }
+
+            r <<= 1;
+        } while (g == 1);
+
+        if (g == m) {
+            do {
+                ys = f(ys);
+                g  = gcd64(x > ys ? x - ys : ys - x, m);
+            } while (g == 1);
+        }
+
+        if (g != m)
+            return g;
+    }
+}
+
+inline void factorize(uint64_t m, std::vector<uint64_t>& primes) {
+    if (m == 1)
+        return;
+
+    for (uint64_t p : {2, 3, 5, 7, 11, 13}) {
+        if (m % p == 0) {
+            primes.push_back(p);
+
+            while (m % p == 0)
+                m /= p;
+
+            factorize(m, primes);
+            return;
+        }
+    }
+
+    if (isPrime64(m)) {
+        primes.push_back(m);
+        return;
+    }
+
+    uint64_t d = pollardRho(m);
+
+    factorize(d, primes);
+    factorize(m / d, primes);
+}
+} // namespace modulus
+
+/**
+ * @return Distinct prime factors of <tt>2^n - 1</tt>, computed once per degree.
+ */
+inline const std::vector<uint64_t>& groupOrderFactors(size_t n) {
+    if (n == 0 || n > 64)
+        throw std::invalid_argument("Degree must be in [1, 64]");
+
+    static std::mutex lock;
+    static std::vector<uint64_t> factors[65];
+    static bool ready[65] = {};
+
+    std::lock_guard<std::mutex> guard(lock);
+
+    if (!ready[n]) {
+        std::vector<uint64_t> primes;
+
+        modulus::factorize(modulus::lowMask(n), primes);
+        std::sort(primes.begin(), primes.end());
+        primes.erase(std::unique(primes.begin(), primes.end()), primes.end());
+
+        factors[n] = std::move(primes);
+        ready[n]   = true;
+    }
+
+    return factors[n];
+}
+
+/**
+ * Primitivity test: \c f is irreducible and \c x has order <tt>2^n - 1</tt>, i.e.
+ * <tt>x^((2^n - 1) / p) != 1</tt> for every prime \c p dividing <tt>2^n - 1</tt>.
+ */
+inline bool isPrimitive(uint64_t low, size_t n) {
+    if (!isIrreducible(low, n))
+        return false;
+
+    uint64_t x = modulus::xMod(low, n);
+
+    if (x == 0)
+        return false;
+
+    uint64_t group = modulus::lowMask(n);
+
+    for (uint64_t p : groupOrderFactors(n)) {
+        if (modulus::powMod(x, group / p, low, n) == 1)
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * @return \c true if \c modPol (e.g. \c 0x11d) is primitive.
+ */
+template <class T>
+bool isPrimitive(const T& modPol) {
+    size_t n = modulus::degree64(static_cast<uint64_t>(modPol));
+
+    if (n == 0)
+        return false;
+
+    return isPrimitive(static_cast<uint64_t>(modPol) ^ (uint64_t(1) << n), n);
+}
+
+/**
+ * Throws \c std::invalid_argument if \c modPol is not irreducible. The result of the last check of each
+ * thread is kept, other results are cached in a shared table, so repeated checks cost a comparison.
+ */
+template <class T>
+void checkModulus(const T& modPol) {
+    thread_local T last     = 0;
+    thread_local bool lastOk = false;
+
+    if (!(lastOk && last == modPol)) {
+        static std::mutex lock;
+        static std::map<T, bool> cache;
+
+        bool ok;
+
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            auto it = cache.find(modPol);
+
+            ok = it != cache.end() ? it->second : (cache[modPol] = isIrreducible<T>(modPol));
+        }
+
+        last   = modPol;
+        lastOk = ok;
+    }
+
+    if (!lastOk)
+        throw std::invalid_argument("Modulus polynomial is not irreducible");
+}
+
+enum class ModulusKind { Irreducible, Primitive };
+
+namespace modulus {
+
+/**
+ * Run \c test over the candidates produced by \c next (in increasing order, in chunks) on \c threads
+ * threads. Stops handing out chunks once \c limit matches are found; since chunks are handed out in
+ * order, the matches form a prefix of the full sorted result.
+ */
+template <class Next, class Test>
+std::vector<uint64_t> search(Next next, Test test, size_t limit, unsigned threads) {
+    constexpr size_t chunk = 256;
+
+    if (threads == 0)
+        threads = std::max(1U, std::thread::hardware_concurrency());
+
+    std::mutex lock;
+    std::vector<uint64_t> found;
+    std::atomic<size_t> count{0};
+    bool done = false;
+
+    auto worker = [&]() {
+        std::vector<uint64_t> candidates(chunk), local;
+
+        for (;;) {
+            size_t n;
+
+            {
+                std::lock_guard<std::mutex> guard(lock);
+
+                if (done || count.load() >= limit)
+                    return;
+
+                n = next(candidates.data(), chunk);
+
+                if (n < chunk)
+                    done = true;
+            }
+
+            local.clear();
+
+            for (size_t i = 0; i < n; ++i)
+                if (test(candidates[i]))
+                    local.push_back(candidates[i]);
+
+            count += local.size();
+
+            std::lock_guard<std::mutex> guard(lock);
+            found.insert(found.end(), local.begin(), local.end());
+        }
+    };
+
+    std::vector<std::thread> pool;
+
+    for (unsigned i = 1; i < threads; ++i)
+        pool.emplace_back(worker);
+
+    worker();
+
+    for (auto& t : pool)
+        t.join();
+
+    std::sort(found.begin(), found.end());
+
+    if (found.size() > limit)
+        found.resize(limit);
+
+    return found;
+}
+
+inline auto tester(size_t n, ModulusKind kind) {
+    if (kind == ModulusKind::Primitive)
+        groupOrderFactors(n);
+
+    return [n, kind](uint64_t low) {
+        return kind == ModulusKind::Primitive ? isPrimitive(low, n) : isIrreducible(low, n);
+    };
+}
+} // namespace modulus
+
+/**
+ * List irreducible or primitive polynomials of degree \c n in increasing order of \c low, at most
+ * \c limit of them (the full list is only feasible for small \c n).
+ *
+ * @param threads number of threads, 0 means \c std::thread::hardware_concurrency()
+ * @return \c low parts, the top term \c x^n is implicit
+ */
+inline std::vector<uint64_t> findModuli(size_t n, ModulusKind kind,
+                                        size_t limit = std::numeric_limits<size_t>::max(),
+                                        unsigned threads = 0) {
+    if (n == 0 || n > 64)
+        throw std::invalid_argument("Degree must be in [1, 64]");
+
+    // low has to be odd for n > 1
+    uint64_t cur = n == 1 ? 0 : 1;
+    uint64_t step = n == 1 ? 1 : 2;
+    bool end = false;
+
+    auto next = [&](uint64_t* out, size_t max) {
+        size_t k = 0;
+
+        for (; k < max && !end; ++k) {
+            out[k] = cur;
+
+            if (cur == modulus::lowMask(n))
+                end = true;
+
+            cur += step;
+        }
+
+        return k;
+    };
+
+    return modulus::search(next, modulus::tester(n, kind), limit, threads);
+}
+
+/**
+ * List the irreducible or primitive polynomials of degree \c n with the lowest number of terms
+ * (trinomials if there are any, then pentanomials, ...), in increasing order of \c low, at most \c limit
+ * of them.
+ *
+ * @param threads number of threads, 0 means \c std::thread::hardware_concurrency()
+ * @return \c low parts, the top term \c x^n is implicit
+ */
+inline std::vector<uint64_t> findLowestWeightModuli(size_t n, ModulusKind kind,
+                                                    size_t limit = std::numeric_limits<size_t>::max(),
+                                                    unsigned threads = 0) {
+    if (n == 0 || n > 64)
+        throw std::invalid_argument("Degree must be in [1, 64]");
+
+    if (n == 1)
+        return findModuli(n, kind, limit, threads);
+
+    auto test = modulus::tester(n, kind);
+
+    // x^n + x^(...) + 1 with k middle terms, k odd (even weight is divisible by x + 1)
+    for (size_t k = 1; k < n; k += 2) {
+        // Middle terms as a k bit subset of positions 1..n-1, walked in increasing order (Gosper's hack)
+        uint64_t mid  = (uint64_t(1) << k) - 1;
+        uint64_t top  = uint64_t(1) << (n - 1);
+        bool end      = false;
+
+        auto next = [&](uint64_t* out, size_t max) {
+            size_t i = 0;
+
+            for (; i < max && !end; ++i) {
+                out[i] = (mid << 1) | 1;
+
+                uint64_t c = mid & (0 - mid);
+                uint64_t r = mid + c;
+
+                mid = (((r ^ mid) >> 2) / c) | r;
+
+                if (r == 0 || mid >= top)
+                    end = true;
+            }
+
+            return i;
+        };
+
+        auto found = modulus::search(next, test, limit, threads);
+
+        if (!found.empty())
+            return found;
+    }
+
+    return {};
+}
+} // namespace op
+}
@@ -0,0 +1,221 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "GFRegion.hpp"
+#include "GFTPlinalg.hpp"
+
+/**
+ * @defgroup NetworkCoding
+ *
+ * Random linear network coding over \c GF(2^8). A generation of \c symbols source symbols of
+ * \c symbolSize bytes is sent as coded packets: \c symbols coefficient bytes followed by the payload,
+ * the linear combination of the source symbols with these coefficients.
+ */
+
+namespace GFlinalg {
+/**
+ * Produces coded packets of a generation. The generation is not copied and must outlive the encoder.
+ */
+template <class T, T modPol>
+class RlncEncoder {
+public:
+    using Polynomial = BasicBinPolynomial<T, modPol>;
+
+    static_assert(op::modPolDegree<T>(modPol) == 8, "Network coding works over GF(2^8)");
+
+    /**
+     * \param generation \c symbols consecutive symbols of \c symbolSize bytes.
+     * @throws std::invalid_argument if \c symbols or \c symbolSize is zero.
+     */
+    RlncEncoder(const uint8_t* generation, size_t symbols, size_t symbolSize, uint64_t seed = 1) :
+        mData(generation), mSymbols(symbols), mSymbolSize(symbolSize), mRandom(seed) {
+        if (symbols == 0 || symbolSize == 0)
+            throw std::invalid_argument("Generation must not be empty");
+    }
+
+    size_t symbols() const noexcept { return mSymbols; }
+
+    size_t symbolSize() const noexcept { return mSymbolSize; }
+
+    size_t packetSize() const noexcept { return mSymbols + mSymbolSize; }
+
+    /**
+     * Writes a packet with uniformly random coefficients to \c packet of \c packetSize() bytes.
+     */
+    void encode(uint8_t* packet) {
+        for (size_t i = 0; i < mSymbols; i += 8) {
+            uint64_t r = mRandom();
+
+            std::memcpy(packet + i, &r, std::min<size_t>(8, mSymbols - i));
+        }
+
+        encode(packet, packet + mSymbols);
+    }
+
+    /**
+     * Writes the combination of the source symbols with \c coefficients to \c payload.
+     */
+    void encode(const uint8_t* coefficients, uint8_t* payload) const noexcept {
+        const auto& field = op::RegionField<Polynomial>::get();
+
+        std::memset(payload, 0, mSymbolSize);
+
+        for (size_t i = 0; i < mSymbols; ++i)
+            field.mulAdd(coefficients[i], mData + i * mSymbolSize, payload, mSymbolSize);
+    }
+
+private:
+    const uint8_t* mData;
+    size_t mSymbols, mSymbolSize;
+    std::mt19937_64 mRandom;
+};
+
+/**
+ * Decodes a generation from coded packets arriving in any order.
+ *
+ * Received rows are kept in reduced row echelon form, indexed by their pivot column. A packet is
+ * first reduced on its coefficients only, so a non-innovative packet is dropped before its payload is
+ * touched; an innovative one is normalised and eliminated from the stored rows. Source symbol \c i is
+ * available as soon as its row has no other nonzero coefficient, before the whole generation is.
+ *
+ * Time complexity: O(symbols * (symbols + symbolSize)) per packet
+ */
+template <class T, T modPol>
+class RlncDecoder {
+public:
+    using Polynomial = BasicBinPolynomial<T, modPol>;
+
+    static_assert(op::modPolDegree<T>(modPol) == 8, "Network coding works over GF(2^8)");
+
+    /**
+     * @throws std::invalid_argument if \c symbols or \c symbolSize is zero.
+     */
+    RlncDecoder(size_t symbols, size_t symbolSize) :
+        mSymbols(symbols), mSymbolSize(symbolSize), mRows(symbols * (symbols + symbolSize)),
+        mPivot(symbols, false), mScratch(symbols + symbolSize) {
+        if (symbols == 0 || symbolSize == 0)
+            throw std::invalid_argument("Generation must not be empty");
+    }
+
+    size_t symbols() const noexcept { return mSymbols; }
+
+    size_t symbolSize() const noexcept { return mSymbolSize; }
+
+    size_t packetSize() const noexcept { return mSymbols + mSymbolSize; }
+
+    size_t rank() const noexcept { return mRank; }
+
+    bool complete() const noexcept { return mRank == mSymbols; }
+
+    /**
+     * Adds a packet of \c packetSize() bytes.
+     *
+     * @return \c true if the packet increased the rank.
+     */
+    bool consume(const uint8_t* packet) {
+        const auto& field = op::RegionField<Polynomial>::get();
+        const size_t stride = packetSize();
+        uint8_t* w = mScratch.data();
+
+        std::memcpy(w, packet, stride);
+
+        // Rows are reduced, so one pass over the pivots in any order clears their columns
+        mUsed.clear();
+
+        for (size_t p = 0; p < mSymbols; ++p) {
+            if (mPivot[p] && w[p]) {
+                mUsed.push_back({p, w[p]});
+                field.mulAdd(w[p], row(p), w, mSymbols);
+            }
+        }
+
+        size_t q = 0;
+
+        while (q < mSymbols && w[q] == 0)
+            ++q;
+
+        if (q == mSymbols)
+            return false;
+
+        for (const auto& [p, c] : mUsed)
+            field.mulAdd(c, row(p) + mSymbols, w + mSymbols, mSymbolSize);
+
+        uint8_t* target = row(q);
+
+        std::memset(target, 0, stride);
+        field.mulAdd(field.inv[w[q]], w, target, stride);
+
+        for (size_t p = 0; p < mSymbols; ++p) {
+            uint8_t* r = row(p);
+
+            if (mPivot[p] && r[q])
+                field.mulAdd(r[q], target, r, stride);
+        }
+
+        mPivot[q] = true;
+        ++mRank;
+
+        return true;
+    }
+
+    /**
+     * @return \c true if source symbol \c i is known.
+     */
+    bool decoded(size_t i) const {
+        if (!mPivot.at(i))
+            return false;
+
+        const uint8_t* r = row(i);
+
+        for (size_t j = 0; j < mSymbols; ++j)
+            if (j != i && r[j])
+                return false;
+
+        return true;
+    }
+
+    /**
+     * @return Source symbol \c i, valid if \c decoded(i).
+     */
+    const uint8_t* symbol(size_t i) const { return row(i) + mSymbols; }
+
+    /**
+     * Copies the decoded generation to \c out of <tt>symbols * symbolSize</tt> bytes.
+     *
+     * @throws std::logic_error if the generation is not complete.
+     */
+    void copyTo(uint8_t* out) const {
+        if (!complete())
+            throw std::logic_error("Generation is not decoded yet");
+
+        for (size_t i = 0; i < mSymbols; ++i)
+            std::memcpy(out + i * mSymbolSize, symbol(i), mSymbolSize);
+    }
+
+    void reset() {
+        std::fill(mPivot.begin(), mPivot.end(), false);
+        mRank = 0;
+    }
+
+private:
+    size_t mSymbols, mSymbolSize;
+    std::vector<uint8_t> mRows;     /*!<Row with the pivot in column p at p * packetSize()*/
+    std::vector<bool> mPivot;
+    std::vector<uint8_t> mScratch;
+    std::vector<std::pair<size_t, uint8_t>> mUsed;
+    size_t mRank = 0;
+
+    uint8_t* row(size_t p) noexcept { return mRows.data() + p * packetSize(); }
+
+    const uint8_t* row(size_t p) const noexcept { return mRows.data() + p * packetSize(); }
+};
+
+} // namespace GFlinalg
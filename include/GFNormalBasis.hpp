@@ -0,0 +1,459 @@
+#pragma once
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "GFLinearMap.hpp"
+#include "GFTPlinalg.hpp"
+
+namespace GFlinalg {
+namespace op {
+
+constexpr bool isPrimeNumber(size_t p) {
+    if (p < 2)
+        return false;
+
+    for (size_t d = 2; d * d <= p; ++d)
+        if (p % d == 0)
+            return false;
+
+    return true;
+}
+
+/**
+ * @return Multiplicative order of 2 modulo odd \c p, 0 if 2 is not invertible modulo \c p.
+ */
+constexpr size_t orderOfTwo(size_t p) {
+    if (p < 3 || p % 2 == 0)
+        return 0;
+
+    size_t k = 1;
+
+    for (size_t v = 2 % p; v != 1; v = (v << 1) % p)
+        ++k;
+
+    return k;
+}
+
+/**
+ * @return Type (1 or 2) of the optimal normal basis of \c GF(2^n), 0 if the degree admits none.
+ */
+constexpr int onbType(size_t n) {
+    if (n < 2)
+        return 0;
+
+    if (isPrimeNumber(n + 1) && orderOfTwo(n + 1) == n)
+        return 1;
+
+    size_t p = (n << 1) + 1;
+
+    if (isPrimeNumber(p) && (orderOfTwo(p) == (n << 1) || (p % 4 == 3 && orderOfTwo(p) == n)))
+        return 2;
+
+    return 0;
+}
+} // namespace op
+
+/**
+ * Optimal normal basis <tt>{beta, beta^2, beta^4, ..., beta^(2^(n-1))}</tt> of the field
+ * \c BasicBinPolynomial<T, modPol>.
+ *
+ * \c beta is a root of the minimal polynomial of the basis: <tt>1 + x + ... + x^n</tt> for type I,
+ * <tt>f_n</tt> with <tt>f_0 = 1, f_1 = x + 1, f_k = x f_(k-1) + f_(k-2)</tt> for type II. The root is
+ * found with the Berlekamp trace algorithm.
+ *
+ * Stores the change of basis maps and the nonzero entries of the Massey-Omura matrix
+ * (<tt>beta_0 * beta_j = sum_k lambda_(i,j) beta_k</tt>, shifted so that only \c k = 0 is stored).
+ */
+template <class T, T modPol>
+class NormalBasis {
+public:
+    static constexpr size_t SZ = op::modPolDegree<T>(modPol);
+
+    static_assert(op::onbType(SZ) != 0, "Field degree does not admit an optimal normal basis");
+
+    static const NormalBasis& get() {
+        static const NormalBasis basis;
+        return basis;
+    }
+
+    static constexpr int type() { return op::onbType(SZ); }
+
+    /**
+     * @return Normal element \c beta in the polynomial basis.
+     */
+    T beta() const noexcept { return mBeta; }
+
+    /**
+     * Normal -> polynomial basis map (<tt>column i = beta^(2^i)</tt>).
+     */
+    const op::LinearMap<T>& toPolynomial() const noexcept { return mToPol; }
+
+    /**
+     * Polynomial -> normal basis map.
+     */
+    const op::LinearMap<T>& toNormal() const noexcept { return mToNormal; }
+
+    /**
+     * Pairs <tt>(i, j)</tt> with <tt>lambda_(i,j) = 1</tt>, there are \c 2n-1 of them.
+     */
+    const std::vector<std::pair<uint8_t, uint8_t>>& terms() const noexcept { return mTerms; }
+
+    static constexpr T mask() { return static_cast<T>((uint64_t(1) << SZ) - 1); }
+
+    /**
+     * Cyclic shift: bit \c k of the result is bit <tt>k + s</tt> of \c a.
+     */
+    static constexpr T rotr(T a, size_t s) {
+        s %= SZ;
+        return s == 0 ? a : static_cast<T>(((a >> s) | (a << (SZ - s))) & mask());
+    }
+
+    /**
+     * Massey-Omura multiplication: <tt>c = sum over (i, j) of rotr(a, i) & rotr(b, j)</tt>.
+     */
+    T mul(T a, T b) const noexcept {
+        T res = 0;
+
+        for (const auto& t : mTerms)
+            res ^= rotr(a, t.first) & rotr(b, t.second);
+
+        return res;
+    }
+
+private:
+    using Poly = std::vector<T>;
+
+    NormalBasis() {
+        mBeta = findRoot(minimalPolynomial());
+
+        std::vector<T> conjugates(SZ);
+        T c = mBeta;
+
+        for (size_t i = 0; i < SZ; ++i) {
+            conjugates[i] = c;
+            c             = fmul(c, c);
+        }
+
+        mToPol    = op::LinearMap<T>(conjugates);
+        mToNormal = mToPol.inverse();
+
+        for (size_t i = 0; i < SZ; ++i) {
+            for (size_t j = 0; j < SZ; ++j) {
+                if (mToNormal(fmul(conjugates[i], conjugates[j])) & 1)
+                    mTerms.emplace_back(static_cast<uint8_t>(i), static_cast<uint8_t>(j));
+            }
+        }
+    }
+
+    static Poly minimalPolynomial() {
+        Poly f(SZ + 1, 0);
+
+        if (type() == 1) {
+            for (auto& x : f)
+                x = 1;
+
+            return f;
+        }
+
+        uint64_t prev = 1, cur = 3;
+
+        for (size_t k = 1; k < SZ; ++k) {
+            uint64_t next = (cur << 1) ^ prev;
+
+            prev = cur;
+            cur  = next;
+        }
+
+        for (size_t i = 0; i <= SZ; ++i)
+            f[i] = (cur >> i) & 1;
+
+        return f;
+    }
+
+    static T fmul(T a, T b) {
+        return (BasicBinPolynomial<T, modPol>(a, false) * BasicBinPolynomial<T, modPol>(b, false)).val();
+    }
+
+    static T finv(T a) {
+        return (BasicBinPolynomial<T, modPol>(1, false) / BasicBinPolynomial<T, modPol>(a, false)).val();
+    }
+
+    static void trim(Poly& a) {
+        while (!a.empty() && a.back() == 0)
+            a.pop_back();
+    }
+
+    /**
+     * Long division, \c a becomes the remainder, the quotient is returned.
+     */
+    static Poly divMod(Poly& a, const Poly& m) {
+        trim(a);
+
+        if (a.size() < m.size())
+            return {};
+
+        Poly q(a.size() - m.size() + 1, 0);
+        T lead = finv(m.back());
+
+        for (size_t top = a.size(); top >= m.size(); --top) {
+            size_t shift = top - m.size();
+
+            if (a[top - 1] == 0)
+                continue;
+
+            T k      = fmul(a[top - 1], lead);
+            q[shift] = k;
+
+            for (size_t j = 0; j < m.size(); ++j)
+                a[shift + j] ^= fmul(k, m[j]);
+        }
+
+        trim(a);
+        return q;
+    }
+
+    static Poly mulMod(const Poly& a, const Poly& b, const Poly& m) {
+        Poly res(a.size() + b.size(), 0);
+
+        for (size_t i = 0; i < a.size(); ++i)
+            for (size_t j = 0; j < b.size(); ++j)
+                res[i + j] ^= fmul(a[i], b[j]);
+
+        divMod(res, m);
+        return res;
+    }
+
+    static Poly gcd(Poly a, Poly b) {
+        trim(a);
+        trim(b);
+
+        while (!b.empty()) {
+            divMod(a, b);
+            std::swap(a, b);
+        }
+
+        return a;
+    }
+
+    /**
+     * Berlekamp trace algorithm: \c f splits over the field into distinct linear factors, so
+     * <tt>gcd(f, Tr(delta x))</tt> is a proper factor for some basis element \c delta.
+     */
+    static T findRoot(Poly f) {
+        trim(f);
+
+        while (f.size() > 2) {
+            bool split = false;
+
+            for (size_t d = 0; d < SZ && !split; ++d) {
+                Poly r{0, static_cast<T>(T(1) << d)};
+                Poly t;
+
+                divMod(r, f);
+
+                for (size_t i = 0; i < SZ; ++i) {
+                    t.resize(std::max(t.size(), r.size()), 0);
+
+                    for (size_t j = 0; j < r.size(); ++j)
+                        t[j] ^= r[j];
+
+                    r = mulMod(r, r, f);
+                }
+
+                Poly g = gcd(f, t);
+
+                if (g.size() > 1 && g.size() < f.size()) {
+                    if ((g.size() - 1) << 1 > f.size() - 1)
+                        g = divMod(f, g);
+
+                    f     = g;
+                    split = true;
+                }
+            }
+
+            if (!split)
+                throw std::invalid_argument("Modulus polynomial is not irreducible");
+        }
+
+        return fmul(f[0], finv(f[1]));
+    }
+
+    T mBeta = 0;
+
+    op::LinearMap<T> mToPol;
+    op::LinearMap<T> mToNormal;
+
+    std::vector<std::pair<uint8_t, uint8_t>> mTerms;
+};
+
+/**
+ * Normal basis GF element class. The value stores coordinates in the optimal normal basis
+ * <tt>{beta^(2^i)}</tt>: bit \c i is the coefficient of <tt>beta^(2^i)</tt>.
+ *
+ * Time complexity:
+ * <ul>
+ *  <li>"+" - O(1)</li>
+ *  <li>squaring, square root - O(1) (cyclic rotation)</li>
+ *  <li>"*" - O(n) word operations (Massey-Omura with 2n-1 terms)</li>
+ *  <li>"/" - O(log(n)) multiplications (Itoh-Tsujii)</li>
+ * </ul>
+ *
+ * Memory complexity: \c O(n) shared per field
+ */
+template <class T, T modPol>
+class NormalBinPolynomial {
+public:
+    using Basis      = NormalBasis<T, modPol>;
+    using Polynomial = BasicBinPolynomial<T, modPol>;
+
+    explicit NormalBinPolynomial() : value(0) {}
+
+    /**
+     * @param val coordinates in the normal basis
+     */
+    explicit NormalBinPolynomial(const T& val) : value(static_cast<T>(val & Basis::mask())) {}
+
+    /**
+     * Conversion from the polynomial basis. Taken by forwarding reference so that a non-const
+     * \c Polynomial is not routed through its templated cast operator instead.
+     */
+    template <class P, std::enable_if_t<std::is_same_v<std::decay_t<P>, Polynomial>, int> = 0>
+    explicit NormalBinPolynomial(P&& pol) : value(Basis::get().toNormal()(pol.val())) {}
+
+    Polynomial toPolynomial() const { return Polynomial(Basis::get().toPolynomial()(value), false); }
+
+    T val() const noexcept { return value; }
+
+    T& val() noexcept { return value; }
+
+    static constexpr T getMod() { return modPol; }
+
+    //! For GF(2^n) returns n
+    static size_t gfDegree() { return Basis::SZ; }
+
+    //! For GF(2^n) returns 2^n
+    static size_t gfOrder() { return size_t(1) << Basis::SZ; }
+
+    //! Multiplicative identity, <tt>1 = sum of all beta^(2^i)</tt>
+    static NormalBinPolynomial one() { return NormalBinPolynomial(Basis::mask()); }
+
+    NormalBinPolynomial square() const { return NormalBinPolynomial(Basis::rotr(value, Basis::SZ - 1)); }
+
+    NormalBinPolynomial sqrt() const { return NormalBinPolynomial(Basis::rotr(value, 1)); }
+
+    /**
+     * <tt>a^(2^k)</tt>
+     */
+    NormalBinPolynomial frobenius(size_t k) const {
+        return NormalBinPolynomial(Basis::rotr(value, Basis::SZ - k % Basis::SZ));
+    }
+
+    /**
+     * Itoh-Tsujii inversion <tt>a^(-1) = (a^(2^(n-1) - 1))^2</tt>, zero is mapped to zero.
+     */
+    NormalBinPolynomial getInverse() const {
+        // res = a^(2^k - 1), processed over the bits of n - 1 from the top
+        size_t e = Basis::SZ - 1;
+        size_t k = 1;
+
+        NormalBinPolynomial res(*this);
+
+        size_t top = 0;
+        while ((e >> (top + 1)) != 0)
+            ++top;
+
+        for (size_t i = top; i-- > 0;) {
+            res = res.frobenius(k) * res;
+            k <<= 1;
+
+            if ((e >> i) & 1) {
+                res = res.square() * *this;
+                ++k;
+            }
+        }
+
+        return res.square();
+    }
+
+    NormalBinPolynomial& invert() {
+        *this = getInverse();
+        return *this;
+    }
+
+    friend NormalBinPolynomial operator+(const NormalBinPolynomial& a, const NormalBinPolynomial& b) {
+        return NormalBinPolynomial(a.value ^ b.value);
+    }
+
+    NormalBinPolynomial& operator+=(const NormalBinPolynomial& other) {
+        value ^= other.value;
+        return *this;
+    }
+
+    friend NormalBinPolynomial operator*(const NormalBinPolynomial& a, const NormalBinPolynomial& b) {
+        return NormalBinPolynomial(Basis::get().mul(a.value, b.value));
+    }
+
+    NormalBinPolynomial& operator*=(const NormalBinPolynomial& other) {
+        *this = *this * other;
+        return *this;
+    }
+
+    friend NormalBinPolynomial operator/(const NormalBinPolynomial& a, const NormalBinPolynomial& b) {
+        if (b.value == 0)
+            throw std::out_of_range("Division by zero");
+
+        return a * b.getInverse();
+    }
+
+    NormalBinPolynomial& operator/=(const NormalBinPolynomial& other) {
+        *this = *this / other;
+        return *this;
+    }
+
+    friend bool operator==(const NormalBinPolynomial& a, const NormalBinPolynomial& b) {
+        return a.value == b.value;
+    }
+
+    friend bool operator!=(const NormalBinPolynomial& a, const NormalBinPolynomial& b) {
+        return a.value != b.value;
+    }
+
+    /**
+     * Element is written as its normal basis coordinates.
+     */
+    friend std::ostream& operator<<(std::ostream& out, const NormalBinPolynomial& a) {
+        return out << static_cast<uint64_t>(a.value);
+    }
+
+    /**
+     * Bulk conversion of \c n values from the polynomial basis.
+     */
+    static void fromPolynomial(const T* in, T* out, size_t n) { Basis::get().toNormal().apply(in, out, n); }
+
+    /**
+     * Bulk conversion of \c n values to the polynomial basis.
+     */
+    static void toPolynomial(const T* in, T* out, size_t n) { Basis::get().toPolynomial().apply(in, out, n); }
+
+protected:
+    T value;
+};
+
+template <class T, T modPol>
+NormalBinPolynomial<T, modPol> pow(const NormalBinPolynomial<T, modPol>& val, size_t power) {
+    auto res = NormalBinPolynomial<T, modPol>::one();
+    auto sq  = val;
+
+    while (power) {
+        if (power & 1)
+            res *= sq;
+
+        sq = sq.square();
+        power >>= 1;
+    }
+
+    return res;
+}
+}
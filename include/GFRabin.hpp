@@ -0,0 +1,242 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#include "GFModulus.hpp"
+#include "GFbase.hpp"
+
+namespace GFlinalg {
+
+/**
+ * Rabin fingerprints: a byte string \c b_0..b_(k-1) is the polynomial <tt>sum b_i * x^(8(k-1-i))</tt>
+ * (bytes MSB first) and its fingerprint is the remainder modulo the irreducible \c modPol of degree
+ * <tt>8..64</tt>.
+ *
+ * The fingerprint of a window of the last \c window bytes is rolled one byte at a time with two
+ * lookups: the push table folds the 8 bits shifted above the degree back, and the pop table removes
+ * the byte leaving the window, <tt>out * x^(8 * window)</tt>.
+ *
+ * An engine is immutable after construction and may be shared between threads.
+ *
+ * Memory complexity: 2 tables of 256 words
+ */
+template <class T, T modPol>
+class RabinFingerprint {
+public:
+    static constexpr size_t degree = op::modPolDegree<T>(modPol);
+
+    static_assert(degree >= 8 && degree <= 64, "Fingerprint degree must be 8..64");
+    static_assert(op::isIrreducible<T>(modPol), "Modulus polynomial must be irreducible");
+
+    /**
+     * @throws std::invalid_argument if \c window is zero.
+     */
+    explicit RabinFingerprint(size_t window) : mWindow(window) {
+        if (window == 0)
+            throw std::invalid_argument("Window must not be empty");
+
+        const uint64_t low = static_cast<uint64_t>(modPol) & op::modulus::lowMask(degree);
+        const uint64_t x = op::modulus::xMod(low, degree);
+        const uint64_t xn = low;
+        const uint64_t xw = op::modulus::powMod(x, 8 * window, low, degree);
+
+        for (uint64_t b = 0; b < 256; ++b) {
+            // b * x^n and b * x^(8 * window), b spread over its bits
+            uint64_t push = 0, bn = xn;
+
+            for (size_t i = 0; i < 8; ++i) {
+                if ((b >> i) & 1)
+                    push ^= bn;
+
+                bn = op::modulus::mulMod(bn, x, low, degree);
+            }
+
+            mPush[b] = push;
+            mPop[b] = op::modulus::mulMod(b & op::modulus::lowMask(degree), xw, low, degree);
+        }
+    }
+
+    size_t window() const noexcept { return mWindow; }
+
+    static constexpr uint64_t mask() { return op::modulus::lowMask(degree); }
+
+    /**
+     * @return Fingerprint of the message with the fingerprint \c fp followed by the byte \c in.
+     */
+    uint64_t push(uint64_t fp, uint8_t in) const noexcept {
+        return (((fp << 8) | in) & mask()) ^ mPush[fp >> (degree - 8)];
+    }
+
+    /**
+     * @return Fingerprint of the window with the fingerprint \c fp slid by one byte: \c out leaves, \c in enters.
+     */
+    uint64_t roll(uint64_t fp, uint8_t out, uint8_t in) const noexcept { return push(fp, in) ^ mPop[out]; }
+
+    /**
+     * @return Fingerprint of the whole message, regardless of the window.
+     */
+    uint64_t fingerprint(const void* data, size_t size, uint64_t fp = 0) const noexcept {
+        auto in = static_cast<const uint8_t*>(data);
+
+        for (size_t i = 0; i < size; ++i)
+            fp = push(fp, in[i]);
+
+        return fp;
+    }
+
+private:
+    size_t mWindow;
+    std::array<uint64_t, 256> mPush{};  /*!<b * x^degree mod modPol*/
+    std::array<uint64_t, 256> mPop{};   /*!<b * x^(8 * window) mod modPol*/
+};
+
+/**
+ * Rolling fingerprint of the last \c window bytes of a stream fed in arbitrary pieces.
+ *
+ * Only the window itself is kept; before \c window bytes were seen the missing ones count as zeros,
+ * which do not change the fingerprint.
+ */
+template <class Engine>
+class RabinWindow {
+public:
+    explicit RabinWindow(const Engine& engine) : mEngine(&engine), mRing(engine.window()) {}
+
+    uint64_t slide(uint8_t in) noexcept {
+        uint8_t out = mRing[mPos];
+
+        mRing[mPos] = in;
+        mPos = mPos + 1 == mRing.size() ? 0 : mPos + 1;
+        mValue = mEngine->roll(mValue, out, in);
+
+        return mValue;
+    }
+
+    uint64_t slide(const void* data, size_t size) noexcept {
+        auto in = static_cast<const uint8_t*>(data);
+
+        for (size_t i = 0; i < size; ++i)
+            slide(in[i]);
+
+        return mValue;
+    }
+
+    uint64_t value() const noexcept { return mValue; }
+
+    void reset() noexcept {
+        std::fill(mRing.begin(), mRing.end(), 0);
+        mPos = 0;
+        mValue = 0;
+    }
+
+private:
+    const Engine* mEngine;
+    std::vector<uint8_t> mRing;
+    size_t mPos = 0;
+    uint64_t mValue = 0;
+};
+
+/**
+ * Content-defined chunking: a chunk ends after the first byte where the window fingerprint has all
+ * the bits of <tt>avgSize - 1</tt> set, but not before \c minSize bytes and not after \c maxSize bytes.
+ *
+ * The first <tt>minSize - window</tt> bytes of every chunk are skipped without hashing, the window is
+ * filled from there, so boundaries depend only on the content of the window. Buffers are scanned in
+ * place and a chunk may span any number of \c scan() calls.
+ */
+template <class Engine>
+class RabinChunker {
+public:
+    /**
+     * @throws std::invalid_argument unless <tt>0 < minSize <= maxSize</tt> and \c avgSize is a power of two.
+     */
+    explicit RabinChunker(const Engine& engine, size_t minSize, size_t avgSize, size_t maxSize) :
+        mWindow(engine), mMin(minSize), mMax(maxSize), mMask(avgSize - 1) {
+        if (minSize == 0 || minSize > maxSize)
+            throw std::invalid_argument("Chunk sizes must satisfy 0 < minSize <= maxSize");
+
+        if (avgSize == 0 || (avgSize & (avgSize - 1)))
+            throw std::invalid_argument("Average chunk size must be a power of two");
+
+        mSkip = minSize > engine.window() ? minSize - engine.window() : 0;
+    }
+
+    /**
+     * Continues the current chunk with \c size bytes at \c data.
+     *
+     * @return Number of bytes consumed: up to and including the chunk boundary if \c boundary is set,
+     * otherwise all of them.
+     */
+    size_t scan(const void* data, size_t size, bool& boundary) {
+        auto in = static_cast<const uint8_t*>(data);
+        size_t i = 0;
+
+        boundary = false;
+
+        if (mLength < mSkip) {
+            i = std::min(size, mSkip - mLength);
+            mLength += i;
+        }
+
+        for (; i < size; ++i) {
+            uint64_t fp = mWindow.slide(in[i]);
+
+            if (++mLength >= mMin && ((fp & mMask) == mMask || mLength >= mMax)) {
+                boundary = true;
+                reset();
+                return i + 1;
+            }
+        }
+
+        return size;
+    }
+
+    /**
+     * @return Lengths of the chunks of \c data, the last one ends with the data.
+     */
+    std::vector<size_t> split(const void* data, size_t size) {
+        auto in = static_cast<const uint8_t*>(data);
+        std::vector<size_t> chunks;
+        size_t begin = 0, pos = 0;
+
+        reset();
+
+        while (pos < size) {
+            bool boundary;
+
+            pos += scan(in + pos, size - pos, boundary);
+
+            if (boundary) {
+                chunks.push_back(pos - begin);
+                begin = pos;
+            }
+        }
+
+        if (begin < size)
+            chunks.push_back(size - begin);
+
+        reset();
+
+        return chunks;
+    }
+
+    //! Bytes of the current chunk scanned so far
+    size_t pending() const noexcept { return mLength; }
+
+    void reset() noexcept {
+        mWindow.reset();
+        mLength = 0;
+    }
+
+private:
+    RabinWindow<Engine> mWindow;
+    size_t mMin, mMax, mSkip;
+    uint64_t mMask;
+    size_t mLength = 0;
+};
+
+} // namespace GFlinalg
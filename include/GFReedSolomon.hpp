@@ -0,0 +1,312 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#include "GFBerlekampMassey.hpp"
+#include "GFChien.hpp"
+#include "GFRegion.hpp"
+#include "GFTPlinalg.hpp"
+
+namespace GFlinalg {
+
+/**
+ * Reed-Solomon code of length <tt>n <= 255</tt> with \c k data symbols over \c GF(2^8), the modulus
+ * \c modPol primitive. The generator has the roots <tt>a^1..a^(n-k)</tt>, so up to <tt>(n - k) / 2</tt>
+ * symbol errors are corrected. Symbol \c i of a codeword is the coefficient of <tt>x^(n-1-i)</tt>: the
+ * data comes first, the parity follows.
+ *
+ * Batches are decoded in lockstep with one codeword per byte lane. In the interleaved layout row \c i
+ * holds symbol \c i of every codeword, so the syndromes of all lanes are Horner steps over whole rows
+ * with the region kernels; \c decode transposes contiguous codewords into that layout first. Lanes
+ * whose syndromes are all zero are done, only the others go through Berlekamp-Massey, the Chien search
+ * and Forney's formula.
+ *
+ * A code is immutable after construction and may be shared between threads.
+ *
+ * Time complexity:
+ * <ul>
+ *   <li>encoding and the syndromes - O(n * (n - k)) region steps per block of lanes</li>
+ *   <li>a lane with errors - O((n - k)^2 + n * (n - k)) field operations</li>
+ * </ul>
+ */
+template <class T, T modPol>
+class ReedSolomon {
+public:
+    using Polynomial = BasicBinPolynomial<T, modPol>;
+
+    static_assert(op::modPolDegree<T>(modPol) == 8, "Reed-Solomon symbols are bytes");
+
+    //! Lanes processed together, the syndromes of a block stay in the L1 cache
+    static constexpr size_t block = 256;
+
+    /**
+     * @throws std::invalid_argument unless <tt>0 < k < n <= 255</tt>, or if \c modPol is not primitive.
+     */
+    ReedSolomon(size_t n, size_t k) : mN(n), mK(k), mChien(modPol, checkedCorrectable(n, k)) {
+        const auto& field = op::RegionField<Polynomial>::get();
+        const size_t roots = n - k;
+
+        mAlpha.resize(255);
+        mAlpha[0] = 1;
+
+        for (size_t i = 1; i < 255; ++i)
+            mAlpha[i] = field.product(mAlpha[i - 1], 2);
+
+        // g(x) = prod (x + a^i), i = 1..n-k
+        mGenerator.assign(roots + 1, 0);
+        mGenerator[0] = 1;
+
+        for (size_t i = 1; i <= roots; ++i) {
+            for (size_t j = i; j > 0; --j)
+                mGenerator[j] = mGenerator[j - 1] ^ field.product(mGenerator[j], mAlpha[i]);
+
+            mGenerator[0] = field.product(mGenerator[0], mAlpha[i]);
+        }
+
+        for (size_t j = 0; j <= roots; ++j) {
+            mGeneratorMaps.push_back(field.mul[mGenerator[j]]);
+            mRootMaps.push_back(field.mul[mAlpha[j % 255]]);
+        }
+    }
+
+    size_t length() const noexcept { return mN; }
+
+    size_t dataSize() const noexcept { return mK; }
+
+    size_t paritySize() const noexcept { return mN - mK; }
+
+    size_t correctable() const noexcept { return (mN - mK) / 2; }
+
+    /**
+     * @return Generator coefficients <tt>g_0..g_(n-k)</tt>, \c g_j of <tt>x^j</tt>.
+     */
+    const std::vector<uint8_t>& generator() const noexcept { return mGenerator; }
+
+    /**
+     * Writes the <tt>n - k</tt> parity symbols of one codeword.
+     */
+    void encode(const uint8_t* data, uint8_t* parity) const {
+        const auto& field = op::RegionField<Polynomial>::get();
+        const size_t roots = mN - mK;
+
+        // parity[m] is the coefficient of x^(n-k-1-m)
+        std::memset(parity, 0, roots);
+
+        for (size_t i = 0; i < mK; ++i) {
+            uint8_t fb = data[i] ^ parity[0];
+
+            std::memmove(parity, parity + 1, roots - 1);
+            parity[roots - 1] = 0;
+
+            for (size_t m = 0; m < roots; ++m)
+                parity[m] ^= field.product(fb, mGenerator[roots - 1 - m]);
+        }
+    }
+
+    /**
+     * Encodes \c width interleaved codewords: row \c i of \c width bytes at <tt>rows + i * stride</tt>, the data
+     * rows <tt>0..k-1</tt> are read and the parity rows <tt>k..n-1</tt> written.
+     */
+    void encodeInterleaved(uint8_t* rows, size_t stride, size_t width) const {
+        const size_t roots = mN - mK;
+        std::vector<uint8_t> reg(roots * block);
+        std::vector<uint8_t*> r(roots);
+
+        for (size_t c = 0; c < width; c += block) {
+            const size_t lanes = std::min(block, width - c);
+
+            // r[m] is the plane of the coefficient of x^(n-k-1-m), rotated instead of shifted
+            for (size_t m = 0; m < roots; ++m)
+                r[m] = reg.data() + m * block;
+
+            std::fill(reg.begin(), reg.end(), 0);
+
+            for (size_t i = 0; i < mK; ++i) {
+                uint8_t* fb = r[0];
+
+                op::addRegion(rows + i * stride + c, fb, lanes);
+                std::rotate(r.begin(), r.begin() + 1, r.end());
+
+                for (size_t m = 0; m + 1 < roots; ++m)
+                    op::addNibbleMap(mGeneratorMaps[roots - 1 - m], fb, r[m], lanes);
+
+                op::applyNibbleMap(mGeneratorMaps[0], fb, fb, lanes);
+            }
+
+            for (size_t m = 0; m < roots; ++m)
+                std::memcpy(rows + (mK + m) * stride + c, r[m], lanes);
+        }
+    }
+
+    /**
+     * Corrects \c width interleaved codewords in place, rows as in \c encodeInterleaved.
+     *
+     * \param status if not null, receives per lane the number of corrected symbols or -1.
+     * @return Number of lanes with uncorrectable errors, left unchanged.
+     */
+    size_t decodeInterleaved(uint8_t* rows, size_t stride, size_t width, int* status = nullptr) const {
+        const size_t roots = mN - mK;
+        std::vector<uint8_t> syn(roots * block), dirty(block);
+        size_t failed = 0;
+
+        for (size_t c = 0; c < width; c += block) {
+            const size_t lanes = std::min(block, width - c);
+
+            // S_j = r(a^j) for all lanes, the rows in order of decreasing degree
+            std::fill(syn.begin(), syn.end(), 0);
+
+            for (size_t i = 0; i < mN; ++i)
+                for (size_t j = 0; j < roots; ++j)
+                    op::hornerNibbleMap(mRootMaps[j + 1], rows + i * stride + c, syn.data() + j * block, lanes);
+
+            std::fill(dirty.begin(), dirty.end(), 0);
+
+            for (size_t j = 0; j < roots; ++j)
+                for (size_t l = 0; l < lanes; ++l)
+                    dirty[l] |= syn[j * block + l];
+
+            for (size_t l = 0; l < lanes; ++l) {
+                int res = 0;
+
+                if (dirty[l]) {
+                    std::vector<uint8_t> s(roots);
+
+                    for (size_t j = 0; j < roots; ++j)
+                        s[j] = syn[j * block + l];
+
+                    res = correct(s, rows + c + l, stride);
+                    failed += res < 0;
+                }
+
+                if (status)
+                    status[c + l] = res;
+            }
+        }
+
+        return failed;
+    }
+
+    /**
+     * Corrects \c count contiguous codewords of \c n bytes in place, see \c decodeInterleaved.
+     */
+    size_t decode(uint8_t* codewords, size_t count, int* status = nullptr) const {
+        std::vector<uint8_t> rows(mN * block);
+        std::vector<int> st(block);
+        size_t failed = 0;
+
+        for (size_t c = 0; c < count; c += block) {
+            const size_t lanes = std::min(block, count - c);
+            uint8_t* words = codewords + c * mN;
+
+            for (size_t l = 0; l < lanes; ++l)
+                for (size_t i = 0; i < mN; ++i)
+                    rows[i * block + l] = words[l * mN + i];
+
+            failed += decodeInterleaved(rows.data(), block, lanes, st.data());
+
+            for (size_t l = 0; l < lanes; ++l) {
+                if (st[l] > 0)
+                    for (size_t i = 0; i < mN; ++i)
+                        words[l * mN + i] = rows[i * block + l];
+
+                if (status)
+                    status[c + l] = st[l];
+            }
+        }
+
+        return failed;
+    }
+
+private:
+    //! Errors corrected by a code of length \c n, checked before the Chien search is built for them
+    static size_t checkedCorrectable(size_t n, size_t k) {
+        if (k == 0 || k >= n || n > 255)
+            throw std::invalid_argument("Code parameters must satisfy 0 < k < n <= 255");
+
+        return (n - k) / 2;
+    }
+
+    size_t mN, mK;
+    ChienSearch mChien;
+    std::vector<uint8_t> mAlpha;                 /*!<a^i*/
+    std::vector<uint8_t> mGenerator;
+    std::vector<op::NibbleMap> mGeneratorMaps;   /*!<Multiplication by g_j*/
+    std::vector<op::NibbleMap> mRootMaps;        /*!<Multiplication by a^j*/
+
+    /**
+     * Full decoding of one lane with the syndromes <tt>S_1..S_(n-k)</tt>; symbol \c i is at <tt>column[i * stride]</tt>.
+     */
+    int correct(const std::vector<uint8_t>& s, uint8_t* column, size_t stride) const {
+        const auto& field = op::RegionField<Polynomial>::get();
+        const size_t roots = mN - mK;
+
+        BerlekampMassey<Polynomial> bm;
+
+        for (uint8_t v : s)
+            bm.update(Polynomial(v));
+
+        const size_t errors = bm.complexity();
+
+        if (errors > correctable())
+            return -1;
+
+        std::vector<uint16_t> locator;
+
+        for (const auto& e : bm.connection())
+            locator.push_back(static_cast<uint16_t>(e.val()));
+
+        // Roots a^-d for the degrees d = n-1..0 of the symbols
+        std::vector<size_t> found = mChien.roots(locator.data(), locator.size(), 255 - mN + 1, mN, errors);
+
+        if (found.size() != errors)
+            return -1;
+
+        // Omega = S(x) * Lambda(x) mod x^(n-k), S(x) = sum S_(j+1) x^j
+        std::vector<uint8_t> omega(roots, 0);
+
+        for (size_t i = 0; i < roots; ++i)
+            for (size_t j = 0; j <= errors && i + j < roots; ++j)
+                omega[i + j] ^= field.product(s[i], static_cast<uint8_t>(locator[j]));
+
+        // p(a^e)
+        auto evaluate = [&](const std::vector<uint8_t>& p, size_t e) {
+            uint8_t v = 0;
+
+            for (size_t q = 0; q < p.size(); ++q)
+                if (p[q])
+                    v ^= field.product(p[q], mAlpha[(q * e) % 255]);
+
+            return v;
+        };
+
+        std::vector<uint8_t> values(errors);
+        std::vector<uint8_t> derivative(errors, 0);
+
+        // Formal derivative: only the odd terms survive in characteristic 2
+        for (size_t j = 1; j <= errors; j += 2)
+            derivative[j - 1] = static_cast<uint8_t>(locator[j]);
+
+        for (size_t q = 0; q < errors; ++q) {
+            uint8_t num = evaluate(omega, found[q]);
+            uint8_t den = evaluate(derivative, found[q]);
+
+            if (den == 0)
+                return -1;
+
+            values[q] = field.product(num, field.inv[den]);
+        }
+
+        for (size_t q = 0; q < errors; ++q) {
+            size_t degree = (255 - found[q]) % 255;
+            column[(mN - 1 - degree) * stride] ^= values[q];
+        }
+
+        return static_cast<int>(errors);
+    }
+};
+
+} // namespace GFlinalg
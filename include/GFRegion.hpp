@@ -0,0 +1,284 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#ifdef __SSSE3__
+#include <tmmintrin.h>
+#endif
+
+/**
+ * @defgroup Region
+ *
+ * Kernels that apply the same operation to whole memory regions.
+ */
+
+namespace GFlinalg {
+namespace op {
+
+/**
+ * Pair of 16 entry tables describing a map of bytes that is linear over \c GF(2):
+ * <tt>f(x) = lo[x & 15] ^ hi[x >> 4]</tt>.
+ */
+struct NibbleMap {
+    std::array<uint8_t, 16> lo;
+    std::array<uint8_t, 16> hi;
+
+    /**
+     * Build the tables from the images of the 8 basis vectors (<tt>columns[i] = f(1 << i)</tt>).
+     */
+    static NibbleMap fromColumns(const std::array<uint8_t, 8>& columns) {
+        NibbleMap res{};
+
+        for (size_t x = 0; x < 16; ++x) {
+            for (size_t i = 0; i < 4; ++i) {
+                if ((x >> i) & 1) {
+                    res.lo[x] ^= columns[i];
+                    res.hi[x] ^= columns[i + 4];
+                }
+            }
+        }
+
+        return res;
+    }
+
+    uint8_t operator()(uint8_t x) const noexcept { return lo[x & 15] ^ hi[x >> 4]; }
+};
+
+/**
+ * <tt>out[i] = f(in[i])</tt> for \c n bytes. Uses byte shuffles when SSSE3 is available.
+ *
+ * \c in and \c out may be the same region.
+ */
+inline void applyNibbleMap(const NibbleMap& f, const uint8_t* in, uint8_t* out, size_t n) noexcept {
+    size_t i = 0;
+
+#ifdef __SSSE3__
+    const __m128i lo   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(f.lo.data()));
+    const __m128i hi   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(f.hi.data()));
+    const __m128i mask = _mm_set1_epi8(0x0F);
+
+    for (; i + 16 <= n; i += 16) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        __m128i l = _mm_shuffle_epi8(lo, _mm_and_si128(x, mask));
+        __m128i h = _mm_shuffle_epi8(hi, _mm_and_si128(_mm_srli_epi64(x, 4), mask));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_xor_si128(l, h));
+    }
+#endif
+
+    for (; i < n; ++i)
+        out[i] = f(in[i]);
+}
+
+/**
+ * Map of 16-bit words that is linear over \c GF(2), by nibbles: <tt>f(x)</tt> is the sum over the four
+ * nibbles \c v_q of \c x of <tt>f(v_q << 4q)</tt>, kept as its low and high bytes.
+ */
+struct NibbleMap16 {
+    std::array<std::array<uint8_t, 16>, 4> lo;
+    std::array<std::array<uint8_t, 16>, 4> hi;
+
+    /**
+     * Build the tables from the images of the 16 basis vectors (<tt>columns[i] = f(1 << i)</tt>).
+     */
+    static NibbleMap16 fromColumns(const std::array<uint16_t, 16>& columns) {
+        NibbleMap16 res{};
+
+        for (size_t q = 0; q < 4; ++q) {
+            for (size_t x = 0; x < 16; ++x) {
+                uint16_t v = 0;
+
+                for (size_t i = 0; i < 4; ++i)
+                    if ((x >> i) & 1)
+                        v ^= columns[4 * q + i];
+
+                res.lo[q][x] = static_cast<uint8_t>(v);
+                res.hi[q][x] = static_cast<uint8_t>(v >> 8);
+            }
+        }
+
+        return res;
+    }
+
+    uint16_t operator()(uint16_t x) const noexcept {
+        uint16_t res = 0;
+
+        for (size_t q = 0; q < 4; ++q) {
+            size_t v = (x >> (4 * q)) & 15;
+            res ^= static_cast<uint16_t>(lo[q][v] | (hi[q][v] << 8));
+        }
+
+        return res;
+    }
+};
+
+/**
+ * <tt>out[i] = f(in[i])</tt> for \c n words stored in two planes, word \c i being
+ * <tt>inLo[i] | inHi[i] << 8</tt>. Uses byte shuffles when SSSE3 is available.
+ *
+ * The output planes may be the input planes.
+ */
+inline void applyNibbleMap16(const NibbleMap16& f, const uint8_t* inLo, const uint8_t* inHi, uint8_t* outLo,
+                             uint8_t* outHi, size_t n) noexcept {
+    size_t i = 0;
+
+#ifdef __SSSE3__
+    __m128i tlo[4], thi[4];
+
+    for (size_t q = 0; q < 4; ++q) {
+        tlo[q] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(f.lo[q].data()));
+        thi[q] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(f.hi[q].data()));
+    }
+
+    const __m128i mask = _mm_set1_epi8(0x0F);
+
+    for (; i + 16 <= n; i += 16) {
+        __m128i l = _mm_loadu_si128(reinterpret_cast<const __m128i*>(inLo + i));
+        __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(inHi + i));
+        __m128i v[4] = {_mm_and_si128(l, mask), _mm_and_si128(_mm_srli_epi64(l, 4), mask),
+                        _mm_and_si128(h, mask), _mm_and_si128(_mm_srli_epi64(h, 4), mask)};
+        __m128i rl = _mm_setzero_si128(), rh = _mm_setzero_si128();
+
+        for (size_t q = 0; q < 4; ++q) {
+            rl = _mm_xor_si128(rl, _mm_shuffle_epi8(tlo[q], v[q]));
+            rh = _mm_xor_si128(rh, _mm_shuffle_epi8(thi[q], v[q]));
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(outLo + i), rl);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(outHi + i), rh);
+    }
+#endif
+
+    for (; i < n; ++i) {
+        uint16_t r = f(static_cast<uint16_t>(inLo[i] | (inHi[i] << 8)));
+
+        outLo[i] = static_cast<uint8_t>(r);
+        outHi[i] = static_cast<uint8_t>(r >> 8);
+    }
+}
+
+/**
+ * <tt>out[i] ^= f(in[i])</tt> for \c n bytes, the multiply-accumulate step when \c f is a multiplication.
+ */
+inline void addNibbleMap(const NibbleMap& f, const uint8_t* in, uint8_t* out, size_t n) noexcept {
+    size_t i = 0;
+
+#ifdef __SSSE3__
+    const __m128i lo   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(f.lo.data()));
+    const __m128i hi   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(f.hi.data()));
+    const __m128i mask = _mm_set1_epi8(0x0F);
+
+    for (; i + 16 <= n; i += 16) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(out + i));
+        __m128i l = _mm_shuffle_epi8(lo, _mm_and_si128(x, mask));
+        __m128i h = _mm_shuffle_epi8(hi, _mm_and_si128(_mm_srli_epi64(x, 4), mask));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_xor_si128(y, _mm_xor_si128(l, h)));
+    }
+#endif
+
+    for (; i < n; ++i)
+        out[i] ^= f(in[i]);
+}
+
+/**
+ * <tt>acc[i] = f(acc[i]) ^ in[i]</tt> for \c n bytes: a Horner step of polynomials evaluated lane-wise.
+ */
+inline void hornerNibbleMap(const NibbleMap& f, const uint8_t* in, uint8_t* acc, size_t n) noexcept {
+    size_t i = 0;
+
+#ifdef __SSSE3__
+    const __m128i lo   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(f.lo.data()));
+    const __m128i hi   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(f.hi.data()));
+    const __m128i mask = _mm_set1_epi8(0x0F);
+
+    for (; i + 16 <= n; i += 16) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(acc + i));
+        __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        __m128i l = _mm_shuffle_epi8(lo, _mm_and_si128(x, mask));
+        __m128i h = _mm_shuffle_epi8(hi, _mm_and_si128(_mm_srli_epi64(x, 4), mask));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(acc + i), _mm_xor_si128(y, _mm_xor_si128(l, h)));
+    }
+#endif
+
+    for (; i < n; ++i)
+        acc[i] = f(acc[i]) ^ in[i];
+}
+
+/**
+ * <tt>out[i] ^= in[i]</tt> for \c n bytes.
+ */
+inline void addRegion(const uint8_t* in, uint8_t* out, size_t n) noexcept {
+    size_t i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        uint64_t x, y;
+
+        std::memcpy(&x, in + i, 8);
+        std::memcpy(&y, out + i, 8);
+        y ^= x;
+        std::memcpy(out + i, &y, 8);
+    }
+
+    for (; i < n; ++i)
+        out[i] ^= in[i];
+}
+
+/**
+ * Tables of the multiplication by every element of a field of degree 8, \c Elem constructible from
+ * its value (\c BasicBinPolynomial and the other compile-time modulus classes).
+ */
+template <class Elem>
+std::array<NibbleMap, 256> mulNibbleMaps() {
+    std::array<NibbleMap, 256> res;
+
+    for (size_t c = 0; c < 256; ++c) {
+        std::array<uint8_t, 8> columns;
+
+        for (size_t i = 0; i < 8; ++i)
+            columns[i] = static_cast<uint8_t>((Elem(c) * Elem(1U << i)).val());
+
+        res[c] = NibbleMap::fromColumns(columns);
+    }
+
+    return res;
+}
+
+/**
+ * Multiplication tables and inverses of a field of degree 8 for the region kernels, shared by all
+ * users of the same \c Elem.
+ */
+template <class Elem>
+struct RegionField {
+    std::array<NibbleMap, 256> mul = mulNibbleMaps<Elem>();
+    std::array<uint8_t, 256> inv{};
+
+    RegionField() {
+        for (size_t c = 1; c < 256; ++c)
+            inv[c] = static_cast<uint8_t>((Elem(1) / Elem(c)).val());
+    }
+
+    static const RegionField& get() {
+        static const RegionField field;
+        return field;
+    }
+
+    uint8_t product(uint8_t a, uint8_t b) const noexcept { return mul[a](b); }
+
+    /**
+     * <tt>out += c * in</tt> over \c n bytes.
+     */
+    void mulAdd(uint8_t c, const uint8_t* in, uint8_t* out, size_t n) const noexcept {
+        if (c == 1)
+            addRegion(in, out, n);
+        else if (c != 0)
+            addNibbleMap(mul[c], in, out, n);
+    }
+};
+} // namespace op
+}
@@ -13,17 +13,31 @@
  */
 namespace GFlinalg {
 
+/**
+ * Field parameters shared by the single template parameter elements.
+ *
+ * \c reduction caches the fold descriptor of \c modPol, so elements over a trinomial or a
+ * pentanomial field reduce and multiply with the same kernels as \c BasicBinPolynomial.
+ */
 template <typename MPT>
 struct GFElemState {
     size_t SZ, order;
     MPT modPol;
+    op::SparseModulus reduction;
 
     GFElemState() : SZ(), order(), modPol() {};
-    GFElemState(size_t size, size_t order, const MPT& modPol) : SZ(size), order(order), modPol(modPol) {}
+    GFElemState(size_t size, size_t order, const MPT& modPol) :
+        SZ(size), order(order), modPol(modPol), reduction(op::sparseModulus<MPT>(modPol)) {}
     GFElemState(size_t size, size_t order) : SZ(size), order(order) {}
 
+    /**
+     * Derives the degree and the order of the field from \c modPol.
+     */
+    explicit GFElemState(const MPT& modPol) :
+        GFElemState(op::modPolDegree<MPT>(modPol), size_t(1) << op::modPolDegree<MPT>(modPol), modPol) {}
+
     GFElemState(const GFElemState& other):
-        SZ(other.SZ), order(other.order), modPol(other.modPol) {}
+        SZ(other.SZ), order(other.order), modPol(other.modPol), reduction(other.reduction) {}
 
     bool operator != (const GFElemState<MPT>& other) {
         return !(*this == other);
@@ -33,6 +47,7 @@ struct GFElemState {
         SZ = other.SZ;
         order = other.order;
         modPol = other.modPol;
+        reduction = other.reduction;
         return *this;
     }
 };
@@ -84,13 +99,14 @@ public:
         this->mState(0, 0);
     }
 
-    explicit constexpr BasicGFElem(const T& value, const T& modulus, bool doReduce = true):
+    /**
+     * @throws std::invalid_argument if \c modulus is not irreducible (the check is cached per modulus).
+     */
+    explicit BasicGFElem(const T& value, const T& modulus, bool doReduce = true):
         value(value) {
+        op::checkModulus<T>(modulus);
 
-        mState = State();
-        mState.modPol = modulus;
-        mState.SZ = op::modPolDegree<T>(modulus);
-        mState.order = 1 << mState.SZ;
+        mState = State(modulus);
 
         if (doReduce)
             this->reduce();
@@ -113,19 +129,18 @@ public:
      * @note Polynomial is automatically reduced after initialization.
      */
     template <typename Iter>
-    explicit constexpr BasicGFElem(Iter begin, Iter end, const T& modulus): value(0) {
+    explicit BasicGFElem(Iter begin, Iter end, const T& modulus): value(0) {
         static_assert(std::is_convertible_v<decltype(*begin), T>);
 
-        mState = State(0, 0, modulus);
+        op::checkModulus<T>(modulus);
+
+        mState = State(modulus);
 
         while (begin++ != end) {
             value |= (static_cast<T>(*begin) & 1);
             value <<= 1;
         }
 
-        mState.SZ = op::modPolDegree<T>();
-        mState.order = 1 << mState.SZ;
-
         this->reduce();
     }
 
@@ -136,10 +151,10 @@ public:
      * @see BasicGFElem::BasicGFElem(Iter, Iter , const T&)
      */
     template <typename Iter>
-    explicit constexpr BasicGFElem(Iter begin, Iter end, Iter beginMod, Iter endMod): value(0) {
+    explicit BasicGFElem(Iter begin, Iter end, Iter beginMod, Iter endMod): value(0) {
         static_assert(std::is_convertible_v<decltype(*begin), T>);
 
-        mState = State(0, 0, 0);
+        T modulus = 0;
 
         while (begin++ != end) {
             value |= (static_cast<T>(*begin) & 1);
@@ -147,12 +162,13 @@ public:
         }
 
         while (beginMod++ != endMod) {
-            mState.modPol |= (static_cast<T>(*beginMod) & 1);
-            mState.modPol <<= 1;
+            modulus |= (static_cast<T>(*beginMod) & 1);
+            modulus <<= 1;
         }
 
-        mState.SZ = op::modPolDegree<T>();
-        mState.order = 1 << mState.SZ;
+        op::checkModulus<T>(modulus);
+
+        mState = State(modulus);
 
         reduce();
     }
@@ -188,14 +204,10 @@ public:
      * @return \c value reduced by \c mState.modPol.
      */
     T reduce() {
-        auto pos  = mState.order - mState.SZ;
-        uint8_t i = 1;
-
-        while (value >= 1U << mState.SZ) {
-            if ((value >> (mState.order - i)) & 1)
-                value ^= mState.modPol << (pos - i);
-            ++i;
-        }
+        if (mState.reduction.sparse)
+            value = op::foldReduce<T>(value, mState.reduction, sizeof(T) << 3);
+        else
+            value = op::longReduce<T>(value, mState.modPol, mState.SZ);
 
         return value;
     }
@@ -219,11 +231,11 @@ public:
         if (a.mState.modPol != b.mState.modPol)
             throw std::runtime_error("Cannot perform addition for elements of different fields");
 
-        return BasicGFElem(a.val() ^ b.val(), a.mState.modPol);
+        return BasicGFElem(a.val() ^ b.val(), a.mState);
     }
 
     BasicGFElem& operator+=(const BasicGFElem& other) {
-        *this = BasicGFElem(val() ^ other.val(), mState.modPol);
+        *this = BasicGFElem(val() ^ other.val(), mState);
         return *this;
     }
 
@@ -231,6 +243,9 @@ public:
         if (a.mState.modPol != b.mState.modPol)
             throw std::runtime_error("Cannot perform multiplication for elements of different fields");
 
+        if (a.mState.reduction.sparse)
+            return BasicGFElem(op::sparseMul<T>(a.value, b.value, a.mState.reduction), a.mState);
+
         return {op::polMul<BasicGFElem>(a, b)};
     }
 
@@ -368,12 +383,12 @@ public:
             throw std::runtime_error("Cannot perform multiplication for elements of different fields");
 
         if (this->value == 0 || other.value == 0)
-            return PowGFElem(0, this->mState.modPol);
+            return PowGFElem(BasicGFElem<T>(0, this->mState), alphaToIndex);
 
-        return PowGFElem(alphaToIndex->indToPol[
+        return PowGFElem(BasicGFElem<T>(alphaToIndex->indToPol[
             alphaToIndex->polToInd[this->value] +
             alphaToIndex->polToInd[other.value]],
-                         this->mState.modPol, alphaToIndex);
+                         this->mState), alphaToIndex);
     }
 
     PowGFElem& operator*=(const PowGFElem& other) {
@@ -401,7 +416,7 @@ public:
             throw std::runtime_error("Cannot perform division for elements of different fields");
 
         if (this->value == 0)
-            return PowGFElem(0, this->mState.modPol);
+            return PowGFElem(BasicGFElem<T>(0, this->mState), alphaToIndex);
 
         if (other.value == 0)
             throw std::out_of_range("Division by zero");
@@ -411,8 +426,8 @@ public:
         if (temp < alphaToIndex->polToInd[other.value])
             temp += this->mState.order - 1;
 
-        return PowGFElem(alphaToIndex->indToPol[temp - alphaToIndex->polToInd[other.value]],
-            this->mState.modPol, alphaToIndex);
+        return PowGFElem(BasicGFElem<T>(alphaToIndex->indToPol[temp - alphaToIndex->polToInd[other.value]],
+            this->mState), alphaToIndex);
     }
 
     PowGFElem& operator/=(const PowGFElem& other) {
@@ -433,7 +448,7 @@ public:
         if (other.mState.modPol != this->mState.modPol)
             throw std::runtime_error("Cannot perform addition for elements of different fields");
 
-        return PowGFElem(this->val() ^ other.val(), this->mState.modPol, alphaToIndex);
+        return PowGFElem(BasicGFElem<T>(this->val() ^ other.val(), this->mState), alphaToIndex);
     }
 
     PowGFElem operator+=(const PowGFElem& other) {
@@ -448,7 +463,7 @@ public:
 template <class T>
 PowGFElem<T> pow(const PowGFElem<T>& val, size_t power) {
     size_t index = (val.alphaToIndex->polToInd[val.value] * power) % (val.gfOrder() - 1);
-    return PowGFElem<T>(val.alphaToIndex->indToPol[index], val.mState.modPol, val.alphaToIndex);
+    return PowGFElem<T>(BasicGFElem<T>(val.alphaToIndex->indToPol[index], val.mState), val.alphaToIndex);
 }
 
 /**
@@ -580,7 +595,7 @@ public:
         if (other.mState.modPol != this->mState.modPol)
             throw std::runtime_error("Cannot perform addition for elements of different fields");
 
-        return TableGFElem(this->val() ^ other.val(), this->mState.modPol, mulTable, divTable);
+        return TableGFElem(BasicGFElem<T>(this->val() ^ other.val(), this->mState), mulTable, divTable);
     }
 
     TableGFElem& operator+=(const TableGFElem& other) {
@@ -592,8 +607,8 @@ public:
         if (other.mState.modPol != this->mState.modPol)
             throw std::runtime_error("Cannot perform multiplication for elements of different fields");
 
-        return TableGFElem(mulTable->at(this->val() * this->mState.order + other.val()),
-            this->mState.modPol, mulTable, divTable);
+        return TableGFElem(BasicGFElem<T>((*mulTable)[this->val() * this->mState.order + other.val()],
+            this->mState), mulTable, divTable);
     }
 
     TableGFElem& operator*=(const TableGFElem& other) {
@@ -608,8 +623,8 @@ public:
         if (other.value == 0)
             throw std::out_of_range("Division by zero");
 
-        return TableGFElem(divTable->at(this->val() * this->mState.order + other.val()),
-            this->mState.modPol, mulTable, divTable);
+        return TableGFElem(BasicGFElem<T>((*divTable)[this->val() * this->mState.order + other.val()],
+            this->mState), mulTable, divTable);
     }
 
     TableGFElem& operator/=(const TableGFElem& other) {
@@ -0,0 +1,231 @@
+#pragma once
+
+#include <type_traits>
+#include <vector>
+
+#include "GFSPlinalg.hpp"
+
+namespace GFlinalg {
+
+/**
+ * Validated-once arithmetic context for a single field.
+ *
+ * The modulus is checked when the scope is created (it must be a primitive polynomial, i.e. \c x has to
+ * generate the multiplicative group), after which all arithmetic is performed on raw \c T values
+ * without comparing moduli or bounds. Multiplication is a single branch-free lookup into an extended
+ * exponent table, so the operations can be inlined and used inside vectorizable loops.
+ *
+ * Division policy: division by zero and inversion of zero are not errors inside a scope, they return
+ * the sentinel value \c 0 (this matches <tt>a^(order - 2)</tt>, which is what \c getInverse() computes
+ * for \c a = 0).
+ *
+ * Define \c GFLINALG_DEBUG to keep the checks: operands outside of the field and elements of another
+ * field throw \c std::runtime_error, division by zero throws \c std::out_of_range.
+ *
+ * Time complexity:
+ * <ul>
+ *  <li>"+" - O(1)</li>
+ *  <li>"*" - O(1)</li>
+ *  <li>"/" - O(1)</li>
+ * </ul>
+ *
+ * Memory complexity: \c O(2^n)
+ */
+template <class T>
+class GFScope {
+public:
+    using State = GFElemState<T>;
+
+    static constexpr bool checked = op::checkedArithmetic;
+
+    explicit GFScope(const T& modPol) {
+        size_t SZ = op::modPolDegree<T>(modPol);
+
+        if (SZ == 0)
+            throw std::invalid_argument("Modulus polynomial must have a positive degree");
+
+        mState = State(SZ, 1U << SZ, modPol);
+
+        size_t group = mState.order - 1;
+
+        // log(0) points to the zero-filled tail, so that exp[log(a) + log(b)] = 0 if a == 0 or b == 0
+        mLog.assign(mState.order, static_cast<uint32_t>(group << 1));
+        mExp.assign((group << 2) + 1, 0);
+        mInv.assign(mState.order, 0);
+
+        BasicGFElem<T> counter{1, modPol};
+        BasicGFElem<T> modifier{2, modPol};
+
+        for (size_t i = 0; i < group; ++i) {
+            if (i > 0 && counter.val() == 1)
+                throw std::invalid_argument("Modulus polynomial is not primitive");
+
+            mExp[i]             = counter.val();
+            mLog[counter.val()] = static_cast<uint32_t>(i);
+
+            counter *= modifier;
+        }
+
+        if (counter.val() != 1)
+            throw std::invalid_argument("Modulus polynomial is not primitive");
+
+        // This is to avoid % operations in math operators
+        for (size_t i = group; i < group << 1; ++i)
+            mExp[i] = mExp[i - group];
+
+        for (size_t i = 1; i < mState.order; ++i)
+            mInv[i] = mExp[(group - mLog[i]) % group];
+    }
+
+    explicit GFScope(const State& state) : GFScope(state.modPol) {}
+
+    const State& getState() const noexcept { return mState; }
+
+    /**
+     * @return \c n For \c GF(2^n).
+     */
+    [[nodiscard]] size_t gfDegree() const noexcept { return mState.SZ; }
+
+    /**
+     * @return \c 2^n For \c GF(2^n).
+     */
+    [[nodiscard]] size_t gfOrder() const noexcept { return mState.order; }
+
+    T getMod() const noexcept { return mState.modPol; }
+
+    /**
+     * @return Power of the primitive element for nonzero \c a.
+     */
+    size_t log(T a) const noexcept(!checked) {
+        check(a);
+        return mLog[a];
+    }
+
+    /**
+     * @return <tt>x^power</tt> where \c x is the primitive element.
+     */
+    T exp(size_t power) const noexcept { return mExp[power % (mState.order - 1)]; }
+
+    T add(T a, T b) const noexcept(!checked) {
+        check(a);
+        check(b);
+        return a ^ b;
+    }
+
+    T mul(T a, T b) const noexcept(!checked) {
+        check(a);
+        check(b);
+        return mExp[mLog[a] + mLog[b]];
+    }
+
+    /**
+     * @return \c a^(-1), or the \c 0 sentinel for \c a = 0.
+     */
+    T inv(T a) const noexcept(!checked) {
+        check(a);
+        return mInv[a];
+    }
+
+    /**
+     * @return <tt>a / b</tt>, or the \c 0 sentinel for \c b = 0.
+     */
+    T div(T a, T b) const noexcept(!checked) {
+        if constexpr (checked) {
+            if (b == 0)
+                throw std::out_of_range("Division by zero");
+        }
+
+        return mul(a, inv(b));
+    }
+
+    T pow(T a, size_t power) const noexcept(!checked) {
+        check(a);
+
+        if (a == 0)
+            return power == 0;
+
+        return mExp[(mLog[a] * (power % (mState.order - 1))) % (mState.order - 1)];
+    }
+
+    /**
+     * Element based interface. The result keeps the LUT/table pointers of \c a.
+     */
+    template <class Elem, class = std::enable_if_t<!std::is_arithmetic_v<Elem>>>
+    Elem add(const Elem& a, const Elem& b) const noexcept(!checked) {
+        Elem res(a);
+        res.val() = add(in(a), in(b));
+        return res;
+    }
+
+    template <class Elem, class = std::enable_if_t<!std::is_arithmetic_v<Elem>>>
+    Elem mul(const Elem& a, const Elem& b) const noexcept(!checked) {
+        Elem res(a);
+        res.val() = mul(in(a), in(b));
+        return res;
+    }
+
+    template <class Elem, class = std::enable_if_t<!std::is_arithmetic_v<Elem>>>
+    Elem div(const Elem& a, const Elem& b) const noexcept(!checked) {
+        Elem res(a);
+        res.val() = div(in(a), in(b));
+        return res;
+    }
+
+    template <class Elem, class = std::enable_if_t<!std::is_arithmetic_v<Elem>>>
+    Elem inv(const Elem& a) const noexcept(!checked) {
+        Elem res(a);
+        res.val() = inv(in(a));
+        return res;
+    }
+
+    BasicGFElem<T> elem(const T& val) const { return BasicGFElem<T>(val, mState); }
+
+    /**
+     * <tt>out[i] = a[i] * b[i]</tt>
+     */
+    void mul(const T* a, const T* b, T* out, size_t n) const noexcept(!checked) {
+        for (size_t i = 0; i < n; ++i)
+            out[i] = mul(a[i], b[i]);
+    }
+
+    /**
+     * <tt>out[i] = c * a[i]</tt>
+     */
+    void mul(T c, const T* a, T* out, size_t n) const noexcept(!checked) {
+        for (size_t i = 0; i < n; ++i)
+            out[i] = mul(c, a[i]);
+    }
+
+    /**
+     * <tt>out[i] = a[i] / b[i]</tt>
+     */
+    void div(const T* a, const T* b, T* out, size_t n) const noexcept(!checked) {
+        for (size_t i = 0; i < n; ++i)
+            out[i] = div(a[i], b[i]);
+    }
+
+private:
+    void check(T a) const {
+        if constexpr (checked) {
+            if (static_cast<size_t>(a) >= mState.order)
+                throw std::runtime_error("Operand does not belong to the field");
+        }
+    }
+
+    template <class Elem>
+    T in(const Elem& a) const {
+        if constexpr (checked) {
+            if (a.getMod() != mState.modPol)
+                throw std::runtime_error("Cannot perform operation for elements of different fields");
+        }
+
+        return a.val();
+    }
+
+    State mState;
+
+    std::vector<uint32_t> mLog;
+    std::vector<T> mExp;
+    std::vector<T> mInv;
+};
+}
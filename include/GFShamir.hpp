@@ -0,0 +1,253 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "GFRegion.hpp"
+#include "GFTPlinalg.hpp"
+
+namespace GFlinalg {
+namespace op {
+
+/**
+ * Overwrites \c n bytes at \c p with zeros through a volatile pointer, so that the stores are not dropped
+ * as dead when the memory is released right after.
+ */
+inline void secureZero(void* p, size_t n) noexcept {
+    volatile uint8_t* bytes = static_cast<volatile uint8_t*>(p);
+
+    for (size_t i = 0; i < n; ++i)
+        bytes[i] = 0;
+}
+} // namespace op
+
+/**
+ * Shamir threshold sharing over \c GF(2^8) with the modulus \c modPol: every byte of a buffer is an
+ * independent secret, so a batch of secrets is shared by passing them concatenated.
+ *
+ * A byte \c s gets the polynomial <tt>f(x) = s + a_1 x + ... + a_(t-1) x^(t-1)</tt> with random
+ * coefficients and the share with the ID \c x is <tt>f(x)</tt>. Shares are evaluated by Horner's
+ * rule over whole buffers with the region kernels, and reconstruction is a sum of the shares scaled by
+ * the Lagrange coefficients at zero, computed once per set of share IDs and cached for the latest
+ * \c cacheLimit sets.
+ *
+ * The random coefficients are wiped before \c split returns: with them a single share gives the secret
+ * away. The object may be shared between threads, the cache is guarded by a mutex.
+ *
+ * Time complexity:
+ * <ul>
+ *   <li>split - O(n * t * size)</li>
+ *   <li>combine - O(t * size), O(t^2) more for a new set of IDs</li>
+ * </ul>
+ */
+template <class T, T modPol>
+class ShamirSharing {
+public:
+    using Polynomial = BasicBinPolynomial<T, modPol>;
+
+    static_assert(op::modPolDegree<T>(modPol) == 8, "Shamir sharing works over GF(2^8)");
+
+    //! Sets of share IDs whose Lagrange coefficients are kept, the oldest set is dropped beyond it
+    static constexpr size_t cacheLimit = 128;
+
+    /**
+     * \param threshold number of shares needed to reconstruct, <tt>1..255</tt>.
+     * @throws std::invalid_argument if \c threshold is out of range.
+     */
+    explicit ShamirSharing(size_t threshold) : mThreshold(threshold) {
+        if (threshold == 0 || threshold > 255)
+            throw std::invalid_argument("Threshold must be 1..255");
+    }
+
+    size_t threshold() const noexcept { return mThreshold; }
+
+    /**
+     * Writes \c n shares of the \c size bytes at \c secret to \c shares, share \c j at <tt>shares + j * size</tt>
+     * for the ID <tt>ids[j]</tt>.
+     *
+     * \param random uniform random bit generator for the coefficients; it must be cryptographically
+     * secure for real secrets.
+     * @throws std::invalid_argument if <tt>n < threshold</tt> or the IDs are not distinct and nonzero.
+     */
+    template <class Rng>
+    void split(const uint8_t* secret, size_t size, const uint8_t* ids, size_t n, uint8_t* shares, Rng& random) const {
+        const auto& field = op::RegionField<Polynomial>::get();
+
+        if (n < mThreshold)
+            throw std::invalid_argument("Fewer shares than the threshold");
+
+        checkIds(ids, n);
+
+        const size_t block = 4096;
+        SecretBuffer coefs((mThreshold - 1) * std::min(block, size));
+
+        for (size_t pos = 0; pos < size; pos += block) {
+            const size_t len = std::min(block, size - pos);
+
+            fillRandom(coefs.data(), (mThreshold - 1) * len, random);
+
+            for (size_t j = 0; j < n; ++j) {
+                uint8_t* acc = shares + j * size + pos;
+
+                // ((a_(t-1) x + a_(t-2)) x + ... + a_1) x + s
+                std::memset(acc, 0, len);
+
+                for (size_t k = mThreshold - 1; k > 0; --k) {
+                    op::applyNibbleMap(field.mul[ids[j]], acc, acc, len);
+                    op::addRegion(coefs.data() + (k - 1) * len, acc, len);
+                }
+
+                op::applyNibbleMap(field.mul[ids[j]], acc, acc, len);
+                op::addRegion(secret + pos, acc, len);
+            }
+        }
+    }
+
+    /**
+     * Reconstructs \c size bytes to \c secret from the first \c threshold() shares of \c n, share \c j of
+     * \c size bytes at <tt>shares + j * size</tt> with the ID <tt>ids[j]</tt>.
+     *
+     * @throws std::invalid_argument if <tt>n < threshold</tt> or the IDs are not distinct and nonzero.
+     */
+    void combine(const uint8_t* ids, size_t n, const uint8_t* shares, size_t size, uint8_t* secret) const {
+        const auto& field = op::RegionField<Polynomial>::get();
+
+        if (n < mThreshold)
+            throw std::invalid_argument("Fewer shares than the threshold");
+
+        std::vector<uint8_t> lambda = lagrange(ids);
+
+        std::memset(secret, 0, size);
+
+        for (size_t j = 0; j < mThreshold; ++j)
+            field.mulAdd(lambda[j], shares + j * size, secret, size);
+    }
+
+    /**
+     * @return Lagrange coefficients at zero for the first \c threshold() IDs at \c ids, in their order.
+     * @throws std::invalid_argument if the IDs are not distinct and nonzero.
+     */
+    std::vector<uint8_t> lagrange(const uint8_t* ids) const {
+        // The cache is keyed by the sorted IDs, the coefficients are stored in that order
+        std::vector<uint8_t> key(ids, ids + mThreshold);
+        std::vector<uint8_t> lambda;
+
+        std::sort(key.begin(), key.end());
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            auto it = mCache.find(key);
+
+            if (it != mCache.end())
+                lambda = it->second;
+        }
+
+        if (lambda.empty()) {
+            checkIds(ids, mThreshold);
+
+            // lambda_j = prod x_m / (x_m - x_j), m != j
+            const auto& field = op::RegionField<Polynomial>::get();
+
+            lambda.assign(mThreshold, 1);
+
+            for (size_t j = 0; j < mThreshold; ++j) {
+                for (size_t m = 0; m < mThreshold; ++m) {
+                    if (m != j)
+                        lambda[j] = field.product(lambda[j], field.product(key[m], field.inv[key[m] ^ key[j]]));
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            if (mCache.find(key) == mCache.end()) {
+                if (mCache.size() == cacheLimit) {
+                    mCache.erase(mOrder.front());
+                    mOrder.pop_front();
+                }
+
+                mOrder.push_back(mCache.emplace(key, lambda).first);
+            }
+        }
+
+        std::vector<uint8_t> res(mThreshold);
+
+        for (size_t j = 0; j < mThreshold; ++j)
+            res[j] = lambda[std::lower_bound(key.begin(), key.end(), ids[j]) - key.begin()];
+
+        return res;
+    }
+
+    //! Number of cached sets of Lagrange coefficients
+    size_t cached() const {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mCache.size();
+    }
+
+private:
+    using Cache = std::map<std::vector<uint8_t>, std::vector<uint8_t>>;
+
+    /**
+     * Bytes that are wiped when they go out of scope, also when an exception leaves \c split.
+     */
+    class SecretBuffer {
+    public:
+        explicit SecretBuffer(size_t n) : mData(n) {}
+
+        SecretBuffer(const SecretBuffer&) = delete;
+        SecretBuffer& operator=(const SecretBuffer&) = delete;
+
+        ~SecretBuffer() { op::secureZero(mData.data(), mData.size()); }
+
+        uint8_t* data() noexcept { return mData.data(); }
+
+    private:
+        std::vector<uint8_t> mData;
+    };
+
+    size_t mThreshold;
+    mutable std::mutex mMutex;
+    mutable Cache mCache;
+    mutable std::deque<typename Cache::iterator> mOrder;   /*!<cached sets, oldest first*/
+
+    /**
+     * Whole words of a full range generator are split into bytes, others go through a distribution.
+     */
+    template <class Rng>
+    static void fillRandom(uint8_t* out, size_t n, Rng& random) {
+        using Word = typename Rng::result_type;
+
+        if constexpr (Rng::min() == 0 && Rng::max() == std::numeric_limits<Word>::max()) {
+            for (size_t i = 0; i < n; i += sizeof(Word)) {
+                Word w = random();
+                std::memcpy(out + i, &w, std::min(sizeof(Word), n - i));
+            }
+        } else {
+            std::uniform_int_distribution<unsigned> byte(0, 255);
+
+            for (size_t i = 0; i < n; ++i)
+                out[i] = static_cast<uint8_t>(byte(random));
+        }
+    }
+
+    static void checkIds(const uint8_t* ids, size_t n) {
+        std::array<bool, 256> seen{};
+
+        for (size_t j = 0; j < n; ++j) {
+            if (ids[j] == 0 || seen[ids[j]])
+                throw std::invalid_argument("Share IDs must be distinct and nonzero");
+
+            seen[ids[j]] = true;
+        }
+    }
+};
+
+} // namespace GFlinalg
@@ -0,0 +1,304 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "GFRegion.hpp"
+#include "GFTPlinalg.hpp"
+#include "GFView.hpp"
+
+/**
+ * @defgroup Sparse
+ *
+ * Compressed sparse matrices over the two template parameter element classes. Only the nonzero
+ * entries are kept: \c CsrMatrix stores them row by row, \c CscMatrix column by column, each as the
+ * usual triple of major offsets, minor indices and values.
+ */
+
+namespace GFlinalg {
+
+enum class SparseOrder { Row, Column };
+
+/**
+ * Compressed sparse matrix with \c rows x \c cols entries of \c Elem, e.g. \c BasicBinPolynomial or
+ * one of its table variants.
+ *
+ * Products with dense vectors use the element arithmetic. Over \c GF(2^8) a matrix also multiplies a
+ * dense block: row \c j of the block is \c width bytes, one independent vector per byte column, and
+ * every nonzero \c a_ij is one region step <tt>Y_i += a_ij * X_j</tt>.
+ *
+ * Time complexity:
+ * <ul>
+ *   <li>products - O(nonzeros) element operations, O(nonzeros * width) bytes for a block</li>
+ *   <li>conversion from dense - O(rows * cols)</li>
+ *   <li>change of the order - O(rows + cols + nonzeros)</li>
+ * </ul>
+ *
+ * Memory complexity: O(major + nonzeros)
+ */
+template <class Elem, SparseOrder order>
+class SparseMatrix {
+public:
+    using Value = std::decay_t<decltype(std::declval<const Elem&>().val())>;
+
+    /**
+     * Zero matrix.
+     *
+     * @throws std::invalid_argument if a dimension does not fit the 32-bit indices.
+     */
+    SparseMatrix(size_t rows, size_t cols) : mRows(rows), mCols(cols) {
+        if (rows > UINT32_MAX || cols > UINT32_MAX)
+            throw std::invalid_argument("Sparse matrix dimensions must fit 32-bit indices");
+
+        mOffsets.assign(major() + 1, 0);
+    }
+
+    /**
+     * Sums the entries <tt>(i, j, value)</tt> in any order, repeated positions are added and zeros dropped.
+     *
+     * @throws std::out_of_range if an index is outside the matrix.
+     */
+    static SparseMatrix fromTriplets(size_t rows, size_t cols, const std::vector<std::tuple<size_t, size_t, Elem>>& entries) {
+        SparseMatrix res(rows, cols);
+        std::vector<std::tuple<size_t, size_t, Value>> sorted;
+
+        sorted.reserve(entries.size());
+
+        for (const auto& [i, j, e] : entries) {
+            if (i >= rows || j >= cols)
+                throw std::out_of_range("Sparse matrix entry out of range");
+
+            if (order == SparseOrder::Row)
+                sorted.emplace_back(i, j, e.val());
+            else
+                sorted.emplace_back(j, i, e.val());
+        }
+
+        std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
+            return std::tie(std::get<0>(a), std::get<1>(a)) < std::tie(std::get<0>(b), std::get<1>(b));
+        });
+
+        for (size_t q = 0; q < sorted.size();) {
+            const auto [p, m, v] = sorted[q];
+            Value sum = 0;
+
+            for (; q < sorted.size() && std::get<0>(sorted[q]) == p && std::get<1>(sorted[q]) == m; ++q)
+                sum ^= std::get<2>(sorted[q]);
+
+            if (sum) {
+                res.mIndices.push_back(static_cast<uint32_t>(m));
+                res.mValues.push_back(sum);
+                ++res.mOffsets[p + 1];
+            }
+        }
+
+        for (size_t p = 0; p < res.major(); ++p)
+            res.mOffsets[p + 1] += res.mOffsets[p];
+
+        return res;
+    }
+
+    /**
+     * Keeps the nonzero entries of the dense row major matrix at \c data.
+     */
+    static SparseMatrix fromDense(const Elem* data, size_t rows, size_t cols) {
+        SparseMatrix res(rows, cols);
+
+        for (size_t p = 0; p < res.major(); ++p) {
+            for (size_t m = 0; m < res.minor(); ++m) {
+                Value v = order == SparseOrder::Row ? data[p * cols + m].val() : data[m * cols + p].val();
+
+                if (v) {
+                    res.mIndices.push_back(static_cast<uint32_t>(m));
+                    res.mValues.push_back(v);
+                }
+            }
+
+            res.mOffsets[p + 1] = res.mIndices.size();
+        }
+
+        return res;
+    }
+
+    static SparseMatrix fromDense(const std::vector<Elem>& data, size_t rows, size_t cols) {
+        if (data.size() != rows * cols)
+            throw std::invalid_argument("Dense matrix size does not match its dimensions");
+
+        return fromDense(data.data(), rows, cols);
+    }
+
+    //! Keeps the nonzero values seen through \c v, e.g. gathered rows of a dense matrix or an engine
+    template <class Layout, class Accessor>
+    static SparseMatrix fromDense(const MatrixView<Layout, Accessor>& v) {
+        SparseMatrix res(v.rows(), v.columns());
+
+        for (size_t p = 0; p < res.major(); ++p) {
+            for (size_t m = 0; m < res.minor(); ++m) {
+                Value x = static_cast<Value>(op::viewValue(order == SparseOrder::Row ? v(p, m) : v(m, p)));
+
+                if (x) {
+                    res.mIndices.push_back(static_cast<uint32_t>(m));
+                    res.mValues.push_back(x);
+                }
+            }
+
+            res.mOffsets[p + 1] = res.mIndices.size();
+        }
+
+        return res;
+    }
+
+    //! Row major dense copy
+    std::vector<Elem> toDense() const {
+        std::vector<Elem> res(mRows * mCols, Elem(0));
+
+        for (size_t p = 0; p < major(); ++p)
+            for (size_t q = mOffsets[p]; q < mOffsets[p + 1]; ++q)
+                at(res, p, mIndices[q]) = Elem(mValues[q]);
+
+        return res;
+    }
+
+    //! The same matrix in the other order
+    SparseMatrix<Elem, order == SparseOrder::Row ? SparseOrder::Column : SparseOrder::Row> convert() const {
+        SparseMatrix<Elem, order == SparseOrder::Row ? SparseOrder::Column : SparseOrder::Row> res(mRows, mCols);
+        auto& offsets = res.mOffsets;
+
+        for (size_t m : mIndices)
+            ++offsets[m + 1];
+
+        for (size_t m = 0; m < minor(); ++m)
+            offsets[m + 1] += offsets[m];
+
+        res.mIndices.resize(nonzeros());
+        res.mValues.resize(nonzeros());
+
+        std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+
+        // Majors are visited in order, so the new minor indices come out sorted
+        for (size_t p = 0; p < major(); ++p) {
+            for (size_t q = mOffsets[p]; q < mOffsets[p + 1]; ++q) {
+                size_t dst = next[mIndices[q]]++;
+
+                res.mIndices[dst] = static_cast<uint32_t>(p);
+                res.mValues[dst]  = mValues[q];
+            }
+        }
+
+        return res;
+    }
+
+    [[nodiscard]] size_t rows() const noexcept { return mRows; }
+
+    [[nodiscard]] size_t columns() const noexcept { return mCols; }
+
+    [[nodiscard]] size_t nonzeros() const noexcept { return mValues.size(); }
+
+    //! Bytes held by the offsets, indices and values
+    [[nodiscard]] size_t memory() const noexcept {
+        return mOffsets.size() * sizeof(size_t) + mIndices.size() * sizeof(uint32_t) + mValues.size() * sizeof(Value);
+    }
+
+    //! Entry \c (i, j), found by a binary search in its row or column
+    Elem operator()(size_t i, size_t j) const {
+        if (i >= mRows || j >= mCols)
+            throw std::out_of_range("Sparse matrix index out of range");
+
+        const size_t p = order == SparseOrder::Row ? i : j;
+        const size_t m = order == SparseOrder::Row ? j : i;
+        auto first = mIndices.begin() + mOffsets[p], last = mIndices.begin() + mOffsets[p + 1];
+        auto it = std::lower_bound(first, last, m);
+
+        return Elem(it != last && *it == m ? mValues[it - mIndices.begin()] : 0);
+    }
+
+    /**
+     * @return <tt>A * x</tt>.
+     * @throws std::invalid_argument if \c x does not have \c columns() entries.
+     */
+    std::vector<Elem> multiply(const std::vector<Elem>& x) const {
+        if (x.size() != mCols)
+            throw std::invalid_argument("Vector size does not match the matrix");
+
+        std::vector<Elem> y(mRows, Elem(0));
+
+        for (size_t p = 0; p < major(); ++p) {
+            for (size_t q = mOffsets[p]; q < mOffsets[p + 1]; ++q) {
+                if (order == SparseOrder::Row)
+                    y[p] += Elem(mValues[q]) * x[mIndices[q]];
+                else
+                    y[mIndices[q]] += Elem(mValues[q]) * x[p];
+            }
+        }
+
+        return y;
+    }
+
+    /**
+     * <tt>Y = A * X</tt> over \c GF(2^8): row \c j of \c X is \c width bytes at <tt>x + j * width</tt>,
+     * row \c i of \c Y is written at <tt>y + i * width</tt>. \c X and \c Y must not overlap.
+     */
+    void multiplyBlock(const uint8_t* x, size_t width, uint8_t* y) const {
+        static_assert(op::modPolDegree<Value>(Elem::getMod()) == 8, "Block products work over GF(2^8)");
+
+        const auto& field = op::RegionField<Elem>::get();
+
+        if (order == SparseOrder::Column)
+            std::memset(y, 0, mRows * width);
+
+        for (size_t p = 0; p < major(); ++p) {
+            if (order == SparseOrder::Row) {
+                uint8_t* out = y + p * width;
+
+                std::memset(out, 0, width);
+
+                for (size_t q = mOffsets[p]; q < mOffsets[p + 1]; ++q)
+                    field.mulAdd(static_cast<uint8_t>(mValues[q]), x + mIndices[q] * width, out, width);
+            } else {
+                const uint8_t* in = x + p * width;
+
+                for (size_t q = mOffsets[p]; q < mOffsets[p + 1]; ++q)
+                    field.mulAdd(static_cast<uint8_t>(mValues[q]), in, y + mIndices[q] * width, width);
+            }
+        }
+    }
+
+    //! Offsets of the rows (CSR) or columns (CSC) into \c indices() and \c values()
+    const std::vector<size_t>& offsets() const noexcept { return mOffsets; }
+
+    //! Column (CSR) or row (CSC) of every nonzero, ascending within a row or column
+    const std::vector<uint32_t>& indices() const noexcept { return mIndices; }
+
+    const std::vector<Value>& values() const noexcept { return mValues; }
+
+private:
+    template <class, SparseOrder>
+    friend class SparseMatrix;
+
+    size_t mRows, mCols;
+    std::vector<size_t> mOffsets;
+    std::vector<uint32_t> mIndices;
+    std::vector<Value> mValues;
+
+    size_t major() const noexcept { return order == SparseOrder::Row ? mRows : mCols; }
+
+    size_t minor() const noexcept { return order == SparseOrder::Row ? mCols : mRows; }
+
+    Elem& at(std::vector<Elem>& dense, size_t p, size_t m) const noexcept {
+        return order == SparseOrder::Row ? dense[p * mCols + m] : dense[m * mCols + p];
+    }
+};
+
+template <class Elem>
+using CsrMatrix = SparseMatrix<Elem, SparseOrder::Row>;
+
+template <class Elem>
+using CscMatrix = SparseMatrix<Elem, SparseOrder::Column>;
+
+} // namespace GFlinalg
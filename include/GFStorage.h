@@ -2,6 +2,7 @@
 #define GFLINALG_GFSTORAGE_H
 
 #include "GFSPlinalg.hpp"
+#include "GFView.hpp"
 
 /**
  * @defgroup Storage
@@ -232,6 +233,27 @@ struct AccessorBasic {
         }
     };
 };
+
+/**
+ * Accessor of a whole \c MatrixEngine in the shape of \c AccessorBasic: offset \c i is entry
+ * <tt>(i / C, i % C)</tt>, so \c makeView gives strided and gathered views of an engine.
+ */
+struct AccessorEngine {
+    template <typename T, size_t R, size_t C>
+    struct Accessor {
+        using pointer      = MatrixEngine<T, R, C>*;
+        using reference    = GFElemRef<T>;
+
+        constexpr reference operator()(pointer p, ptrdiff_t i) const noexcept {
+            return (*p)(i / C, i % C);
+        }
+    };
+};
+
+template <typename T, size_t R, size_t C>
+StridedView<AccessorEngine::Accessor<T, R, C>> makeView(MatrixEngine<T, R, C>& m) noexcept {
+    return StridedView<AccessorEngine::Accessor<T, R, C>>(&m, R, C, {static_cast<ptrdiff_t>(C), 1});
+}
 }
 
 #endif // GFLINALG_GFSTORAGE_H
@@ -0,0 +1,237 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "GFDense.hpp"
+
+namespace GFlinalg {
+namespace op {
+
+/**
+ * Bump allocator over a single buffer for the temporaries of recursive algorithms. Allocations are
+ * released together by going back to an earlier \c mark, so nested calls use the buffer as a stack
+ * and nothing is allocated from the heap while they run.
+ */
+class Arena {
+public:
+    //! Every allocation starts at a multiple of this many bytes
+    static constexpr size_t alignment = 64;
+
+    explicit Arena(size_t bytes) : mBuffer(bytes + alignment) {
+        const auto address = reinterpret_cast<uintptr_t>(mBuffer.data());
+
+        mBase     = mBuffer.data() + ((alignment - address % alignment) % alignment);
+        mCapacity = bytes;
+    }
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    //! Bytes that \c count objects of \c V take in an arena
+    template <class V>
+    static constexpr size_t footprint(size_t count) noexcept {
+        return (count * sizeof(V) + alignment - 1) / alignment * alignment;
+    }
+
+    /**
+     * Uninitialized room for \c count objects of the trivial type \c V.
+     *
+     * @throws std::logic_error if the arena is exhausted.
+     */
+    template <class V>
+    V* allocate(size_t count) {
+        const size_t bytes = footprint<V>(count);
+
+        if (bytes > mCapacity - mUsed)
+            throw std::logic_error("Arena is exhausted");
+
+        V* res = reinterpret_cast<V*>(mBase + mUsed);
+
+        mUsed += bytes;
+        mPeak = std::max(mPeak, mUsed);
+        return res;
+    }
+
+    size_t mark() const noexcept { return mUsed; }
+
+    //! Frees everything allocated after \c mark was taken
+    void release(size_t mark) noexcept { mUsed = mark; }
+
+    size_t capacity() const noexcept { return mCapacity; }
+
+    size_t used() const noexcept { return mUsed; }
+
+    //! Largest \c used() so far
+    size_t peak() const noexcept { return mPeak; }
+
+private:
+    std::vector<uint8_t> mBuffer;
+    uint8_t* mBase;
+    size_t mCapacity, mUsed = 0, mPeak = 0;
+};
+
+//! <tt>out = x + y</tt> on views of values, \c out may be \c x or \c y
+template <class ViewX, class ViewY, class ViewOut>
+void addDense(const ViewX& x, const ViewY& y, const ViewOut& out) {
+    // Stores of bytes may alias the views, the extents are read once
+    const size_t rows = out.rows(), cols = out.columns();
+
+    if (cols == 0)
+        return;
+
+    if constexpr (addressableViews<ViewX, ViewY, ViewOut>()) {
+        if (x.contiguousRows() && y.contiguousRows() && out.contiguousRows()) {
+            for (size_t i = 0; i < rows; ++i) {
+                const auto* a = &x(i, 0);
+                const auto* b = &y(i, 0);
+                auto* o = &out(i, 0);
+
+                for (size_t j = 0; j < cols; ++j)
+                    o[j] = a[j] ^ b[j];
+            }
+
+            return;
+        }
+    }
+
+    using V = ViewValue<ViewOut>;
+
+    for (size_t i = 0; i < rows; ++i)
+        for (size_t j = 0; j < cols; ++j)
+            viewValue(out(i, j)) = static_cast<V>(viewValue(x(i, j)) ^ viewValue(y(i, j)));
+}
+
+/**
+ * Arena bytes used by \c strassenDense for an <tt>m x k</tt> by <tt>k x n</tt> product.
+ */
+template <class V>
+size_t strassenWorkspace(size_t m, size_t k, size_t n, size_t cutoff) noexcept {
+    if (std::min({m, k, n}) <= std::max<size_t>(cutoff, 1))
+        return 0;
+
+    m >>= 1, k >>= 1, n >>= 1;
+
+    return Arena::footprint<V>(m * k) + Arena::footprint<V>(k * n) + Arena::footprint<V>(m * n) +
+           strassenWorkspace<V>(m, k, n, cutoff);
+}
+
+/**
+ * <tt>C = A * B</tt> by Strassen-Winograd: 7 half size products and 15 sums per level instead of 8
+ * products. In characteristic 2 every subtraction is a sum. Odd dimensions are peeled, the last row,
+ * column or inner index goes through \c multiplyDense, and so does every product with a dimension at
+ * most \c cutoff.
+ *
+ * Three temporaries per level come from \c arena, one of the size of a quarter of \c A, \c B and \c C
+ * each; the other intermediate results are kept in the quarters of \c C.
+ */
+template <class Elem, class ViewA, class ViewB, class ViewC>
+void strassenDense(const ViewA& a, const ViewB& b, const ViewC& c, size_t cutoff, Arena& arena) {
+    using V = ViewValue<ViewC>;
+
+    const size_t m = a.rows(), k = a.columns(), n = b.columns();
+
+    if (std::min({m, k, n}) <= std::max<size_t>(cutoff, 1)) {
+        multiplyDense<Elem>(a, b, c, false);
+        return;
+    }
+
+    const size_t hm = m >> 1, hk = k >> 1, hn = n >> 1;
+    const size_t mark = arena.mark();
+
+    const auto x = makeView(arena.allocate<V>(hm * hk), hm, hk, hk);
+    const auto y = makeView(arena.allocate<V>(hk * hn), hk, hn, hn);
+    const auto z = makeView(arena.allocate<V>(hm * hn), hm, hn, hn);
+
+    const auto a11 = a.submatrix(0, 0, hm, hk), a12 = a.submatrix(0, hk, hm, hk);
+    const auto a21 = a.submatrix(hm, 0, hm, hk), a22 = a.submatrix(hm, hk, hm, hk);
+    const auto b11 = b.submatrix(0, 0, hk, hn), b12 = b.submatrix(0, hn, hk, hn);
+    const auto b21 = b.submatrix(hk, 0, hk, hn), b22 = b.submatrix(hk, hn, hk, hn);
+    const auto c11 = c.submatrix(0, 0, hm, hn), c12 = c.submatrix(0, hn, hm, hn);
+    const auto c21 = c.submatrix(hm, 0, hm, hn), c22 = c.submatrix(hm, hn, hm, hn);
+
+    addDense(a11, a21, x);                              // S3
+    addDense(b22, b12, y);                              // T3
+    strassenDense<Elem>(x, y, c21, cutoff, arena);      // P7 = S3 T3
+    addDense(a21, a22, x);                              // S1
+    addDense(b12, b11, y);                              // T1
+    strassenDense<Elem>(x, y, c22, cutoff, arena);      // P5 = S1 T1
+    addDense(x, a11, x);                                // S2 = S1 + A11
+    addDense(b22, y, y);                                // T2 = B22 + T1
+    strassenDense<Elem>(x, y, c12, cutoff, arena);      // P6 = S2 T2
+    addDense(a12, x, x);                                // S4 = A12 + S2
+    strassenDense<Elem>(x, b22, c11, cutoff, arena);    // P3 = S4 B22
+    strassenDense<Elem>(a11, b11, z, cutoff, arena);    // P1
+    addDense(z, c12, c12);                              // U2 = P1 + P6
+    addDense(c12, c21, c21);                            // U3 = U2 + P7
+    addDense(c12, c22, c12);                            // U4 = U2 + P5
+    addDense(c21, c22, c22);                            // C22 = U3 + P5
+    addDense(c12, c11, c12);                            // C12 = U4 + P3
+    addDense(y, b21, y);                                // T4 = T2 + B21
+    strassenDense<Elem>(a22, y, c11, cutoff, arena);    // P4 = A22 T4
+    addDense(c21, c11, c21);                            // C21 = U3 + P4
+    strassenDense<Elem>(a12, b21, c11, cutoff, arena);  // P2
+    addDense(c11, z, c11);                              // C11 = P1 + P2
+
+    arena.release(mark);
+
+    const size_t em = hm << 1, ek = hk << 1, en = hn << 1;
+
+    if (ek < k)
+        multiplyDense<Elem>(a.submatrix(0, ek, em, 1), b.submatrix(ek, 0, 1, en), c.submatrix(0, 0, em, en), true);
+
+    if (en < n)
+        multiplyDense<Elem>(a.submatrix(0, 0, m, k), b.submatrix(0, en, k, 1), c.submatrix(0, en, m, 1), false);
+
+    if (em < m)
+        multiplyDense<Elem>(a.submatrix(em, 0, 1, k), b.submatrix(0, 0, k, en), c.submatrix(em, 0, 1, en), false);
+}
+} // namespace op
+
+/**
+ * Products with a dimension up to this size are left to the blocked kernel. Below it the region kernels
+ * run on rows too short to make up for the sums of another level.
+ */
+constexpr size_t strassenCutoff = 128;
+
+/**
+ * <tt>C = A * B</tt> with Strassen-Winograd on top of the blocked product, on views of the values of
+ * \c Elem (strided or gathered rows). The temporaries are drawn from \c arena, which needs
+ * <tt>op::strassenWorkspace</tt> bytes.
+ *
+ * Time complexity: O(n^2.81) for square matrices of size \c n.
+ *
+ * @throws std::invalid_argument if the dimensions do not match.
+ * @throws std::logic_error if the arena is too small.
+ */
+template <class Elem, class ViewA, class ViewB, class ViewC>
+void strassen(const ViewA& a, const ViewB& b, const ViewC& c, op::Arena& arena, size_t cutoff = strassenCutoff) {
+    if (a.columns() != b.rows() || c.rows() != a.rows() || c.columns() != b.columns())
+        throw std::invalid_argument("Dense matrix dimensions do not match");
+
+    op::strassenDense<Elem>(a, b, c, cutoff, arena);
+}
+
+template <class Elem>
+void strassen(const DenseMatrix<Elem>& a, const DenseMatrix<Elem>& b, DenseMatrix<Elem>& c, op::Arena& arena,
+              size_t cutoff = strassenCutoff) {
+    strassen<Elem>(a.view(), b.view(), c.view(), arena, cutoff);
+}
+
+/**
+ * As above with an arena of the exact size.
+ */
+template <class Elem>
+DenseMatrix<Elem> strassen(const DenseMatrix<Elem>& a, const DenseMatrix<Elem>& b, size_t cutoff = strassenCutoff) {
+    using Value = typename DenseMatrix<Elem>::Value;
+
+    DenseMatrix<Elem> c(a.rows(), b.columns());
+    op::Arena arena(op::strassenWorkspace<Value>(a.rows(), a.columns(), b.columns(), cutoff));
+
+    strassen(a, b, c, arena, cutoff);
+    return c;
+}
+
+} // namespace GFlinalg
@@ -0,0 +1,455 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "GFRegion.hpp"
+#include "GFSparse.hpp"
+
+namespace GFlinalg {
+
+/**
+ * Structured Gaussian elimination of a sparse system <tt>A x = b</tt> with \c rows equations and
+ * \c cols unknowns, e.g. the equations an LT or Raptor decoder collects.
+ *
+ * Pivots are taken while they are cheap, by their Markowitz cost <tt>(r - 1)(c - 1)</tt> for a row of
+ * weight \c r in a column of weight \c c:
+ * <ul>
+ *   <li>singleton rows - the unknown is known, its column drops out of the other rows</li>
+ *   <li>singleton columns - the row only defines its unknown and is set aside for back substitution</li>
+ *   <li>light columns - the lightest row of the lightest column is merged into the other rows of the
+ *   column, as long as the cost stays within \c maxCost</li>
+ * </ul>
+ * What is left is a small dense remainder for a dense or iterative solver. Elimination only looks at
+ * the matrix and records a plan, so \c solve and \c solveBlock replay it on any right hand side: the row
+ * operations, the dense remainder by Gauss-Jordan and the back substitution of the pivots.
+ *
+ * Time complexity: O(pivots * fill) for the elimination, O(fill * width) per block of right hand sides
+ */
+template <class Elem>
+class StructuredGauss {
+public:
+    /**
+     * \param maxCost largest Markowitz cost of a pivot in a light column, singletons cost nothing.
+     */
+    explicit StructuredGauss(const CsrMatrix<Elem>& a, size_t maxCost = 8) :
+        mRows(a.rows()), mCols(a.columns()), mRowData(a.rows()), mColRows(a.columns()),
+        mColWeight(a.columns(), 0), mRowActive(a.rows(), true), mColActive(a.columns(), true) {
+        const auto& offsets = a.offsets();
+
+        for (size_t i = 0; i < mRows; ++i) {
+            for (size_t q = offsets[i]; q < offsets[i + 1]; ++q) {
+                uint32_t j = a.indices()[q];
+
+                mRowData[i].emplace_back(j, Elem(a.values()[q]));
+                mColRows[j].push_back(static_cast<uint32_t>(i));
+                ++mColWeight[j];
+            }
+
+            if (mRowData[i].size() == 1)
+                mSingletons.push_back(static_cast<uint32_t>(i));
+        }
+
+        for (size_t j = 0; j < mCols; ++j)
+            if (mColWeight[j])
+                mQueue.emplace(mColWeight[j], static_cast<uint32_t>(j));
+
+        eliminate(maxCost);
+        buildRemainder();
+    }
+
+    size_t rows() const noexcept { return mRows; }
+
+    size_t columns() const noexcept { return mCols; }
+
+    //! Number of unknowns eliminated sparsely
+    size_t pivots() const noexcept { return mPivots.size(); }
+
+    //! Entries added to the sparse rows by the elimination
+    size_t fill() const noexcept { return mFill; }
+
+    /**
+     * @return Dense remainder, \c remainderRowIds().size() x \c remainderColumnIds().size() row major.
+     */
+    const std::vector<Elem>& remainder() const noexcept { return mDense; }
+
+    //! Equations of the remainder, indices into the right hand side after \c reduce
+    const std::vector<uint32_t>& remainderRowIds() const noexcept { return mDenseRows; }
+
+    //! Unknowns of the remainder
+    const std::vector<uint32_t>& remainderColumnIds() const noexcept { return mDenseCols; }
+
+    /**
+     * Applies the row operations of the elimination to \c b of \c rows() entries. The remainder is then
+     * solved for <tt>b[remainderRowIds()]</tt>, and \c backSubstitute recovers the other unknowns.
+     */
+    void reduce(std::vector<Elem>& b) const {
+        ElemRows ops;
+        replay(ops, b.data());
+    }
+
+    /**
+     * Fills the pivot unknowns of \c x, \c cols() entries with the remainder unknowns set, from a
+     * reduced \c b.
+     */
+    void backSubstitute(const std::vector<Elem>& b, std::vector<Elem>& x) const {
+        ElemRows ops;
+        substitute(ops, b.data(), x.data());
+    }
+
+    /**
+     * Solves <tt>A x = b</tt>, the remainder by Gauss-Jordan elimination and free unknowns set to zero.
+     *
+     * @return \c false if the system is inconsistent.
+     */
+    bool solve(std::vector<Elem> b, std::vector<Elem>& x) const {
+        if (b.size() != mRows)
+            throw std::invalid_argument("Vector size does not match the matrix");
+
+        ElemRows ops;
+
+        x.assign(mCols, Elem(0));
+
+        return run(ops, b.data(), x.data());
+    }
+
+    /**
+     * Solves <tt>A X = B</tt> over \c GF(2^8) for \c width right hand sides at once: row \c i of \c B is
+     * \c width bytes at <tt>b + i * width</tt> and is overwritten, row \c j of \c X is written to
+     * <tt>x + j * width</tt>. Every row operation is a region kernel, as the symbols of an LT decoder.
+     *
+     * @return \c false if the system is inconsistent.
+     */
+    bool solveBlock(uint8_t* b, size_t width, uint8_t* x) const {
+        static_assert(op::modPolDegree<typename CsrMatrix<Elem>::Value>(Elem::getMod()) == 8, "Block solving works over GF(2^8)");
+
+        BlockRows ops{width};
+
+        std::memset(x, 0, mCols * width);
+
+        return run(ops, b, x);
+    }
+
+private:
+    using Entry = std::pair<uint32_t, Elem>;
+
+    struct Pivot {
+        uint32_t row, col;
+        Elem inv;                       /*!<Inverse of the pivot*/
+        std::vector<Entry> targets;     /*!<Rows t with <tt>b_t += m * b_row</tt>*/
+        std::vector<Entry> entries;     /*!<Rest of the pivot row*/
+    };
+
+    size_t mRows, mCols, mFill = 0;
+    std::vector<std::vector<Entry>> mRowData;       /*!<Active rows, sorted by column*/
+    std::vector<std::vector<uint32_t>> mColRows;    /*!<Rows that had an entry in the column, may be stale*/
+    std::vector<size_t> mColWeight;
+    std::vector<bool> mRowActive, mColActive;
+    std::set<std::pair<size_t, uint32_t>> mQueue;   /*!<Active columns by weight*/
+    std::vector<uint32_t> mSingletons;
+    std::vector<Pivot> mPivots;
+
+    std::vector<Elem> mDense;
+    std::vector<uint32_t> mDenseRows, mDenseCols;
+    std::vector<uint32_t> mEmptyRows;               /*!<Equations reduced to 0 = b_i*/
+
+    //! Right hand sides as single elements
+    struct ElemRows {
+        using Row = Elem*;
+
+        template <class P>
+        P at(P base, size_t i) const noexcept { return base + i; }
+
+        void addScaled(Row dst, const Elem* src, const Elem& c) const { *dst += c * *src; }
+
+        void scale(Row dst, const Elem& c) const { *dst *= c; }
+
+        void copy(Row dst, const Elem* src) const { *dst = *src; }
+
+        bool isZero(const Elem* r) const { return r->val() == 0; }
+    };
+
+    //! Right hand sides as rows of bytes over GF(2^8)
+    struct BlockRows {
+        using Row = uint8_t*;
+
+        size_t width;
+
+        template <class P>
+        P at(P base, size_t i) const noexcept { return base + i * width; }
+
+        void addScaled(Row dst, const uint8_t* src, const Elem& c) const {
+            op::RegionField<Elem>::get().mulAdd(static_cast<uint8_t>(c.val()), src, dst, width);
+        }
+
+        void scale(Row dst, const Elem& c) const {
+            op::applyNibbleMap(op::RegionField<Elem>::get().mul[c.val()], dst, dst, width);
+        }
+
+        void copy(Row dst, const uint8_t* src) const { std::memcpy(dst, src, width); }
+
+        bool isZero(const uint8_t* r) const {
+            return std::all_of(r, r + width, [](uint8_t v) { return v == 0; });
+        }
+    };
+
+    const Elem* find(size_t row, uint32_t col) const {
+        const auto& r = mRowData[row];
+        auto it = std::lower_bound(r.begin(), r.end(), col, [](const Entry& e, uint32_t c) { return e.first < c; });
+
+        return it != r.end() && it->first == col ? &it->second : nullptr;
+    }
+
+    void setWeight(uint32_t col, size_t weight) {
+        if (mColActive[col] && mColWeight[col])
+            mQueue.erase({mColWeight[col], col});
+
+        mColWeight[col] = weight;
+
+        if (mColActive[col] && weight)
+            mQueue.emplace(weight, col);
+    }
+
+    void eliminate(size_t maxCost) {
+        for (;;) {
+            while (!mSingletons.empty()) {
+                uint32_t i = mSingletons.back();
+
+                mSingletons.pop_back();
+
+                if (mRowActive[i] && mRowData[i].size() == 1)
+                    pivot(i, mRowData[i][0].first);
+            }
+
+            if (mQueue.empty())
+                break;
+
+            // Lightest row of the lightest column
+            auto [weight, col] = *mQueue.begin();
+            uint32_t best = 0;
+            size_t bestWeight = SIZE_MAX;
+
+            for (uint32_t i : mColRows[col]) {
+                if (mRowActive[i] && mRowData[i].size() < bestWeight && find(i, col)) {
+                    best = i;
+                    bestWeight = mRowData[i].size();
+                }
+            }
+
+            if ((bestWeight - 1) * (weight - 1) > maxCost)
+                break;
+
+            pivot(best, col);
+        }
+    }
+
+    void pivot(uint32_t row, uint32_t col) {
+        Pivot p{row, col, Elem(1) / *find(row, col), {}, {}};
+
+        for (const auto& e : mRowData[row])
+            if (e.first != col)
+                p.entries.push_back(e);
+
+        mRowActive[row] = false;
+
+        for (const auto& e : mRowData[row])
+            setWeight(e.first, mColWeight[e.first] - 1);
+
+        std::vector<uint32_t> rows;
+
+        rows.swap(mColRows[col]);
+        std::sort(rows.begin(), rows.end());
+        rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+
+        for (uint32_t t : rows) {
+            const Elem* a = mRowActive[t] ? find(t, col) : nullptr;
+
+            if (!a)
+                continue;
+
+            Elem m = *a * p.inv;
+
+            p.targets.emplace_back(t, m);
+            addRow(t, p.entries, m, col);
+        }
+
+        mColActive[col] = false;
+        mQueue.erase({mColWeight[col], col});
+        mPivots.push_back(std::move(p));
+    }
+
+    //! Row \c t += m * (pivot row), the pivot column cancels
+    void addRow(uint32_t t, const std::vector<Entry>& entries, const Elem& m, uint32_t col) {
+        const auto& old = mRowData[t];
+        std::vector<Entry> res;
+        size_t i = 0, j = 0;
+
+        res.reserve(old.size() + entries.size());
+
+        while (i < old.size() || j < entries.size()) {
+            if (j == entries.size() || (i < old.size() && old[i].first < entries[j].first)) {
+                if (old[i].first == col)
+                    setWeight(col, mColWeight[col] - 1);
+                else
+                    res.push_back(old[i]);
+
+                ++i;
+            } else if (i == old.size() || entries[j].first < old[i].first) {
+                res.emplace_back(entries[j].first, m * entries[j].second);
+                mColRows[entries[j].first].push_back(t);
+                setWeight(entries[j].first, mColWeight[entries[j].first] + 1);
+                ++mFill;
+                ++j;
+            } else {
+                Elem v = old[i].second + m * entries[j].second;
+
+                if (v.val())
+                    res.emplace_back(old[i].first, v);
+                else
+                    setWeight(old[i].first, mColWeight[old[i].first] - 1);
+
+                ++i;
+                ++j;
+            }
+        }
+
+        mRowData[t] = std::move(res);
+
+        if (mRowData[t].size() == 1)
+            mSingletons.push_back(t);
+    }
+
+    void buildRemainder() {
+        std::vector<uint32_t> position(mCols, UINT32_MAX);
+
+        for (size_t j = 0; j < mCols; ++j) {
+            if (mColActive[j] && mColWeight[j]) {
+                position[j] = static_cast<uint32_t>(mDenseCols.size());
+                mDenseCols.push_back(static_cast<uint32_t>(j));
+            }
+        }
+
+        for (size_t i = 0; i < mRows; ++i) {
+            if (!mRowActive[i])
+                continue;
+
+            if (mRowData[i].empty()) {
+                mEmptyRows.push_back(static_cast<uint32_t>(i));
+                continue;
+            }
+
+            mDenseRows.push_back(static_cast<uint32_t>(i));
+            mDense.resize(mDenseRows.size() * mDenseCols.size(), Elem(0));
+
+            for (const auto& [j, v] : mRowData[i])
+                mDense[(mDenseRows.size() - 1) * mDenseCols.size() + position[j]] = v;
+        }
+
+        // The sparse state is only needed during the elimination
+        mRowData    = {};
+        mColRows    = {};
+        mColWeight  = {};
+        mRowActive  = {};
+        mColActive  = {};
+        mSingletons = {};
+        mQueue.clear();
+    }
+
+    template <class Ops>
+    void replay(const Ops& ops, typename Ops::Row b) const {
+        for (const auto& p : mPivots)
+            for (const auto& [t, m] : p.targets)
+                ops.addScaled(ops.at(b, t), ops.at(b, p.row), m);
+    }
+
+    template <class Ops, class B>
+    void substitute(const Ops& ops, B b, typename Ops::Row x) const {
+        for (size_t q = mPivots.size(); q-- > 0;) {
+            const auto& p = mPivots[q];
+            auto out = ops.at(x, p.col);
+
+            ops.copy(out, ops.at(b, p.row));
+
+            for (const auto& [j, v] : p.entries)
+                ops.addScaled(out, ops.at(x, j), v);
+
+            ops.scale(out, p.inv);
+        }
+    }
+
+    template <class Ops>
+    bool run(const Ops& ops, typename Ops::Row b, typename Ops::Row x) const {
+        replay(ops, b);
+
+        for (uint32_t i : mEmptyRows)
+            if (!ops.isZero(ops.at(b, i)))
+                return false;
+
+        // Gauss-Jordan on the remainder, the right hand sides follow the row operations
+        const size_t rows = mDenseRows.size(), cols = mDenseCols.size();
+        std::vector<Elem> d = mDense;
+        std::vector<uint32_t> order = mDenseRows;
+        size_t rank = 0;
+
+        for (size_t c = 0; c < cols && rank < rows; ++c) {
+            size_t r = rank;
+
+            while (r < rows && d[r * cols + c].val() == 0)
+                ++r;
+
+            if (r == rows)
+                continue;
+
+            if (r != rank) {
+                std::swap_ranges(d.begin() + r * cols, d.begin() + (r + 1) * cols, d.begin() + rank * cols);
+                std::swap(order[r], order[rank]);
+            }
+
+            const Elem inv = Elem(1) / d[rank * cols + c];
+
+            for (size_t k = c; k < cols; ++k)
+                d[rank * cols + k] *= inv;
+
+            ops.scale(ops.at(b, order[rank]), inv);
+
+            for (size_t i = 0; i < rows; ++i) {
+                const Elem m = d[i * cols + c];
+
+                if (i == rank || m.val() == 0)
+                    continue;
+
+                for (size_t k = c; k < cols; ++k)
+                    d[i * cols + k] += m * d[rank * cols + k];
+
+                ops.addScaled(ops.at(b, order[i]), ops.at(b, order[rank]), m);
+            }
+
+            ++rank;
+        }
+
+        for (size_t i = rank; i < rows; ++i)
+            if (!ops.isZero(ops.at(b, order[i])))
+                return false;
+
+        for (size_t i = 0; i < rank; ++i) {
+            size_t c = 0;
+
+            while (d[i * cols + c].val() == 0)
+                ++c;
+
+            // Free unknowns are zero, so the pivot unknown is the right hand side
+            ops.copy(ops.at(x, mDenseCols[c]), ops.at(b, order[i]));
+        }
+
+        substitute(ops, b, x);
+
+        return true;
+    }
+};
+
+} // namespace GFlinalg
@@ -28,7 +28,9 @@ namespace GFlinalg {
     protected:
         T value;
         constexpr static size_t SZ = op::modPolDegree<T>(modPol);
-        constexpr static size_t order = 1 << SZ;
+        constexpr static size_t order = size_t(1) << SZ;
+
+        static_assert(op::isIrreducible<T>(modPol), "Modulus polynomial must be irreducible");
 
     public:
         //! Default constructor
@@ -78,6 +80,9 @@ namespace GFlinalg {
 
         static constexpr T getMod() { return modPol; }
 
+        //! Fold descriptor, used instead of the long division for trinomials and pentanomials
+        constexpr static op::SparseModulus sparse = op::sparseModulus<T>(modPol);
+
         //! For GF(2^n) returns n
         static size_t gfDegree() { return SZ; }
         //! For GF(2^n) returns 2^n
@@ -88,14 +93,10 @@ namespace GFlinalg {
         }
         //! Reduces polynomial by modulus polynomial (modPol)
         T reduce() {
-            auto pos = order - SZ;
-            // Reduce by modulus
-            uint8_t i = 1;
-            while (value >= 1U << SZ) {
-                if ((value >> (order - i)) & 1)
-                    value ^= modPol << (pos - i);
-                ++i;
-            }
+            if constexpr (sparse.sparse)
+                value = op::foldReduce<T>(value, sparse, sizeof(T) << 3);
+            else
+                value = op::longReduce<T>(value, modPol, SZ);
             return value;
         }
         /*!
@@ -141,11 +142,14 @@ namespace GFlinalg {
         }
         //! Multiplies elements in Galois field as polynomials
         friend BasicBinPolynomial operator * (const BasicBinPolynomial& a, const BasicBinPolynomial& b) {
-            return op::polMul<BasicBinPolynomial>(a, b);
+            if constexpr (sparse.sparse)
+                return BasicBinPolynomial(op::sparseMul<T>(a.value, b.value, sparse), false);
+            else
+                return op::polMul<BasicBinPolynomial>(a, b);
         }
         //! Multiplies elements in Galois Field as polynomials
         BasicBinPolynomial& operator *= (const BasicBinPolynomial& other) {
-            *this = op::polMul<BasicBinPolynomial>(*this, other);
+            *this = *this * other;
             return *this;
         }
         //! Divides elements in Galois field as polynomials
@@ -270,8 +274,11 @@ namespace GFlinalg {
          *
          */
         PowBinPolynomial& operator *= (const PowBinPolynomial& other) {
-            this->val() = alphaToIndex.indToPol[alphaToIndex.polToInd[this->val()] +
-                alphaToIndex.polToInd[other.value]];
+            if (this->value == 0 || other.value == 0)
+                this->val() = 0;
+            else
+                this->val() = alphaToIndex.indToPol[alphaToIndex.polToInd[this->val()] +
+                    alphaToIndex.polToInd[other.value]];
             return (*this);
         }
         //! Divides elements in Galois field using LUTs
@@ -312,12 +319,14 @@ namespace GFlinalg {
          *
          */
         PowBinPolynomial& operator /= (const PowBinPolynomial& other) {
+            if (other.value == 0)
+                throw std::out_of_range("Division by zero");
             if (value == 0)
-                return PowBinPolynomial(0);
+                return *this;
             auto temp(alphaToIndex.polToInd[this->value]);
             if (temp < alphaToIndex.polToInd[other.value])
                 temp += order - 1;
-            *this->val = alphaToIndex.indToPol[temp - alphaToIndex.polToInd[other.value]];
+            this->val() = alphaToIndex.indToPol[temp - alphaToIndex.polToInd[other.value]];
             return *this;
         }
 
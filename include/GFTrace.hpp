@@ -0,0 +1,430 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "GFLinearMap.hpp"
+#include "GFModulus.hpp"
+#include "GFNormalBasis.hpp"
+#include "GFSPlinalg.hpp"
+#include "GFTPlinalg.hpp"
+
+namespace GFlinalg {
+namespace op {
+
+/**
+ * @return Parity of the set bits of \c x, computed without branches.
+ */
+template <class T>
+constexpr uint8_t parity(T x) noexcept {
+    uint64_t v = static_cast<uint64_t>(x);
+
+    for (size_t s = 32; s > 0; s >>= 1)
+        v ^= v >> s;
+
+    return static_cast<uint8_t>(v & 1);
+}
+
+/**
+ * \c GF(2)-linear maps of a binary field \c GF(2^n) given by its modulus polynomial:
+ * <ul>
+ *  <li>trace <tt>Tr(a) = a + a^2 + ... + a^(2^(n-1))</tt>, stored as the mask of basis elements with
+ *  trace 1, so that <tt>Tr(a) = parity(a & mask)</tt></li>
+ *  <li>square root <tt>a^(2^(n-1))</tt></li>
+ *  <li>half trace <tt>H(a) = sum of a^(4^i), i = 0..(n-1)/2</tt> (odd \c n only)</li>
+ *  <li>a solution map \c S of <tt>x^2 + x = c</tt>: <tt>S(c)^2 + S(c) = c</tt> whenever <tt>Tr(c) = 0</tt>,
+ *  for any \c n</li>
+ * </ul>
+ *
+ * Every map has a table driven \c apply and a constant time \c applyConstTime (see \c LinearMap).
+ * Instances are shared: use \c get() for a runtime modulus.
+ */
+template <class T>
+class FieldMaps {
+public:
+    explicit FieldMaps(const T& modPol) : mModPol(modPol), mDegree(modPolDegree<T>(modPol)) {
+        if (mDegree == 0)
+            throw std::invalid_argument("Modulus polynomial must have a positive degree");
+
+        if (!isIrreducible<T>(modPol))
+            throw std::invalid_argument("Modulus polynomial is not irreducible");
+
+        std::vector<T> sqrtColumns(mDegree), halfTraceColumns(mDegree), quadColumns(mDegree);
+
+        for (size_t i = 0; i < mDegree; ++i) {
+            uint64_t x = uint64_t(1) << i;
+            uint64_t tr = 0, ht = 0, p = x;
+
+            for (size_t k = 0; k < mDegree; ++k) {
+                tr ^= p;
+
+                if (!(k & 1))
+                    ht ^= p;
+
+                if (k + 1 == mDegree)
+                    sqrtColumns[i] = static_cast<T>(p);
+
+                p = mulMod(p, p);
+            }
+
+            mTraceMask |= static_cast<T>(tr << i);
+            halfTraceColumns[i] = static_cast<T>(ht);
+            quadColumns[i]      = static_cast<T>(mulMod(x, x) ^ x);
+        }
+
+        mSqrt = LinearMap<T>(std::move(sqrtColumns));
+
+        if (mDegree & 1)
+            mHalfTrace = LinearMap<T>(std::move(halfTraceColumns));
+
+        mSolve = LinearMap<T>(solutionColumns(quadColumns));
+    }
+
+    /**
+     * @return Shared maps of the field, built on first use. Safe to call from several threads.
+     */
+    static const FieldMaps& get(const T& modPol) {
+        thread_local const FieldMaps* last = nullptr;
+
+        if (last != nullptr && last->mModPol == modPol)
+            return *last;
+
+        static std::mutex lock;
+        static std::map<T, std::unique_ptr<FieldMaps>> cache;
+
+        std::lock_guard<std::mutex> guard(lock);
+        auto& maps = cache[modPol];
+
+        if (!maps)
+            maps = std::make_unique<FieldMaps>(modPol);
+
+        last = maps.get();
+        return *last;
+    }
+
+    T getMod() const noexcept { return mModPol; }
+
+    size_t gfDegree() const noexcept { return mDegree; }
+
+    T traceMask() const noexcept { return mTraceMask; }
+
+    uint8_t trace(T a) const noexcept { return parity(a & mTraceMask); }
+
+    const LinearMap<T>& sqrtMap() const noexcept { return mSqrt; }
+
+    /**
+     * Throws \c std::invalid_argument for fields of even degree.
+     */
+    const LinearMap<T>& halfTraceMap() const {
+        if (!(mDegree & 1))
+            throw std::invalid_argument("Half trace is defined only for fields of odd degree");
+
+        return mHalfTrace;
+    }
+
+    const LinearMap<T>& solutionMap() const noexcept { return mSolve; }
+
+    /**
+     * <tt>out[i] = Tr(in[i])</tt> for \c n values.
+     */
+    void trace(const T* in, uint8_t* out, size_t n) const noexcept {
+        for (size_t i = 0; i < n; ++i)
+            out[i] = parity(in[i] & mTraceMask);
+    }
+
+private:
+    uint64_t mulMod(uint64_t a, uint64_t b) const noexcept {
+        uint64_t res = 0;
+
+        while (b) {
+            if (b & 1)
+                res ^= a;
+
+            b >>= 1;
+            a <<= 1;
+
+            if ((a >> mDegree) & 1)
+                a ^= static_cast<uint64_t>(mModPol);
+        }
+
+        return res;
+    }
+
+    /**
+     * <tt>x -> x^2 + x</tt> has kernel \c {0, 1} and image <tt>{c : Tr(c) = 0}</tt>. Column \c i of the
+     * solution map solves <tt>x^2 + x = e_i + Tr(e_i) e_k</tt> for a fixed \c e_k of trace 1, so the map
+     * is linear and exact on the image.
+     */
+    std::vector<T> solutionColumns(const std::vector<T>& quadColumns) const {
+        // pivots[b] = (image with top bit b, its preimage)
+        std::vector<std::pair<T, T>> pivots(mDegree, {0, 0});
+
+        auto reduce = [&](T v, T& src) {
+            for (size_t b = mDegree; b-- > 0;) {
+                if (((v >> b) & 1) && pivots[b].first != 0) {
+                    v ^= pivots[b].first;
+                    src ^= pivots[b].second;
+                }
+            }
+
+            return v;
+        };
+
+        for (size_t i = 0; i < mDegree; ++i) {
+            T src = static_cast<T>(T(1) << i);
+            T v   = reduce(quadColumns[i], src);
+
+            if (v != 0) {
+                size_t top = 0;
+
+                while (v >> (top + 1))
+                    ++top;
+
+                pivots[top] = {v, src};
+            }
+        }
+
+        T shift = 0;
+
+        for (size_t k = 0; k < mDegree && shift == 0; ++k)
+            if ((mTraceMask >> k) & 1)
+                shift = static_cast<T>(T(1) << k);
+
+        std::vector<T> columns(mDegree);
+
+        for (size_t i = 0; i < mDegree; ++i) {
+            T e   = static_cast<T>(T(1) << i);
+            T src = 0;
+
+            reduce(((mTraceMask >> i) & 1) ? static_cast<T>(e ^ shift) : e, src);
+            columns[i] = src;
+        }
+
+        return columns;
+    }
+
+    T mModPol;
+    size_t mDegree;
+    T mTraceMask = 0;
+
+    LinearMap<T> mSqrt;
+    LinearMap<T> mHalfTrace;
+    LinearMap<T> mSolve;
+};
+
+/**
+ * Field maps of a two parameter element class (shared per modulus, no lookup).
+ */
+template <class T, T modPol>
+const FieldMaps<T>& fieldMapsOf(const BasicBinPolynomial<T, modPol>&) {
+    static const FieldMaps<T> maps(modPol);
+    return maps;
+}
+
+/**
+ * Field maps of a single parameter element class (cached per modulus).
+ */
+template <class T>
+const FieldMaps<T>& fieldMapsOf(const BasicGFElem<T>& a) {
+    return FieldMaps<T>::get(a.getMod());
+}
+
+template <class Elem>
+using FieldMapsOf = decltype(fieldMapsOf(std::declval<const Elem&>()));
+
+template <class Elem>
+Elem withValue(const Elem& a, decltype(std::declval<const Elem&>().val()) v) {
+    Elem res(a);
+    res.val() = v;
+    return res;
+}
+} // namespace op
+
+/**
+ * @defgroup Trace
+ *
+ * Trace, half trace, square root and the quadratic equation <tt>x^2 + x = c</tt> for the polynomial
+ * basis classes (\c BasicBinPolynomial, \c PowBinPolynomial, \c TableBinPolynomial and their single
+ * parameter analogues) and for \c NormalBinPolynomial.
+ *
+ * All of them are \c GF(2)-linear and precomputed once per field (\c op::FieldMaps). The default
+ * functions use byte tables, the \c ConstTime versions run in time independent of the operand. The
+ * trace is a masked parity in both cases. In the normal basis everything reduces to rotations and
+ * prefix XORs, so there is only one version.
+ *
+ * Time complexity (polynomial basis):
+ * <ul>
+ *  <li>trace - O(1)</li>
+ *  <li>square root, half trace, quadratic - O(n / 8) lookups, O(n) for \c ConstTime</li>
+ * </ul>
+ */
+
+/**
+ * @return <tt>Tr(a)</tt>, 0 or 1.
+ */
+template <class Elem, class = op::FieldMapsOf<Elem>>
+uint8_t trace(const Elem& a) {
+    return op::fieldMapsOf(a).trace(a.val());
+}
+
+/**
+ * @return Square root of \c a.
+ */
+template <class Elem, class = op::FieldMapsOf<Elem>>
+Elem sqrt(const Elem& a) {
+    return op::withValue(a, op::fieldMapsOf(a).sqrtMap().apply(a.val()));
+}
+
+template <class Elem, class = op::FieldMapsOf<Elem>>
+Elem sqrtConstTime(const Elem& a) {
+    return op::withValue(a, op::fieldMapsOf(a).sqrtMap().applyConstTime(a.val()));
+}
+
+/**
+ * @return Half trace of \c a, throws \c std::invalid_argument for fields of even degree.
+ */
+template <class Elem, class = op::FieldMapsOf<Elem>>
+Elem halfTrace(const Elem& a) {
+    return op::withValue(a, op::fieldMapsOf(a).halfTraceMap().apply(a.val()));
+}
+
+template <class Elem, class = op::FieldMapsOf<Elem>>
+Elem halfTraceConstTime(const Elem& a) {
+    return op::withValue(a, op::fieldMapsOf(a).halfTraceMap().applyConstTime(a.val()));
+}
+
+/**
+ * Solve <tt>x^2 + x = c</tt>. The other solution is <tt>x + 1</tt>.
+ *
+ * @return \c false if there is no solution (<tt>Tr(c) = 1</tt>), \c x is still written in that case.
+ */
+template <class Elem, class = op::FieldMapsOf<Elem>>
+bool solveQuadratic(const Elem& c, Elem& x) {
+    const auto& maps = op::fieldMapsOf(c);
+
+    x = op::withValue(c, maps.solutionMap().apply(c.val()));
+    return maps.trace(c.val()) == 0;
+}
+
+template <class Elem, class = op::FieldMapsOf<Elem>>
+bool solveQuadraticConstTime(const Elem& c, Elem& x) {
+    const auto& maps = op::fieldMapsOf(c);
+
+    x = op::withValue(c, maps.solutionMap().applyConstTime(c.val()));
+    return maps.trace(c.val()) == 0;
+}
+
+/**
+ * <tt>out[i] = Tr(a[i])</tt> for \c n elements of the same field.
+ */
+template <class Elem, class = op::FieldMapsOf<Elem>>
+void trace(const Elem* a, uint8_t* out, size_t n) {
+    if (n == 0)
+        return;
+
+    const auto& maps = op::fieldMapsOf(a[0]);
+
+    for (size_t i = 0; i < n; ++i)
+        out[i] = maps.trace(a[i].val());
+}
+
+/**
+ * <tt>out[i] = sqrt(a[i])</tt> for \c n elements of the same field.
+ */
+template <class Elem, class = op::FieldMapsOf<Elem>>
+void sqrt(const Elem* a, Elem* out, size_t n) {
+    if (n == 0)
+        return;
+
+    const auto& map = op::fieldMapsOf(a[0]).sqrtMap();
+
+    for (size_t i = 0; i < n; ++i)
+        out[i] = op::withValue(a[i], map.apply(a[i].val()));
+}
+
+/**
+ * <tt>out[i] = H(a[i])</tt> for \c n elements of the same field.
+ */
+template <class Elem, class = op::FieldMapsOf<Elem>>
+void halfTrace(const Elem* a, Elem* out, size_t n) {
+    if (n == 0)
+        return;
+
+    const auto& map = op::fieldMapsOf(a[0]).halfTraceMap();
+
+    for (size_t i = 0; i < n; ++i)
+        out[i] = op::withValue(a[i], map.apply(a[i].val()));
+}
+
+/**
+ * Solve <tt>x[i]^2 + x[i] = c[i]</tt> for \c n elements of the same field, <tt>ok[i] = 0</tt> if there is
+ * no solution.
+ */
+template <class Elem, class = op::FieldMapsOf<Elem>>
+void solveQuadratic(const Elem* c, Elem* x, uint8_t* ok, size_t n) {
+    if (n == 0)
+        return;
+
+    const auto& maps = op::fieldMapsOf(c[0]);
+    const auto& map  = maps.solutionMap();
+
+    for (size_t i = 0; i < n; ++i) {
+        x[i]  = op::withValue(c[i], map.apply(c[i].val()));
+        ok[i] = static_cast<uint8_t>(maps.trace(c[i].val()) ^ 1);
+    }
+}
+
+/**
+ * Normal basis: \c 1 is the sum of all basis elements and <tt>Tr(beta) = 1</tt>, so the trace is the
+ * parity of the coordinates.
+ */
+template <class T, T modPol>
+uint8_t trace(const NormalBinPolynomial<T, modPol>& a) noexcept {
+    return op::parity(a.val());
+}
+
+template <class T, T modPol>
+NormalBinPolynomial<T, modPol> sqrt(const NormalBinPolynomial<T, modPol>& a) {
+    return a.sqrt();
+}
+
+/**
+ * Normal basis half trace <tt>sum of a^(4^i)</tt>: XOR of rotations by even amounts.
+ */
+template <class T, T modPol>
+NormalBinPolynomial<T, modPol> halfTrace(const NormalBinPolynomial<T, modPol>& a) {
+    using Basis = typename NormalBinPolynomial<T, modPol>::Basis;
+
+    if (!(Basis::SZ & 1))
+        throw std::invalid_argument("Half trace is defined only for fields of odd degree");
+
+    T res = 0;
+
+    for (size_t i = 0; i < Basis::SZ; i += 2)
+        res ^= Basis::rotr(a.val(), Basis::SZ - i);
+
+    return NormalBinPolynomial<T, modPol>(res);
+}
+
+/**
+ * Normal basis: <tt>x^2 + x = c</tt> reads <tt>x_(k-1) + x_k = c_k</tt>, so with <tt>x_0 = 0</tt> the
+ * solution is the prefix XOR of \c c.
+ */
+template <class T, T modPol>
+bool solveQuadratic(const NormalBinPolynomial<T, modPol>& c, NormalBinPolynomial<T, modPol>& x) {
+    using Basis = typename NormalBinPolynomial<T, modPol>::Basis;
+
+    uint64_t v = static_cast<uint64_t>(c.val()) & ~uint64_t(1);
+
+    for (size_t s = 1; s < Basis::SZ; s <<= 1)
+        v ^= v << s;
+
+    x = NormalBinPolynomial<T, modPol>(static_cast<T>(v & Basis::mask()));
+    return op::parity(c.val()) == 0;
+}
+}
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @defgroup View
+ *
+ * Non-owning views of matrices in the style of \c mdspan: a pointer, the extents, a layout mapping
+ * from indices to offsets and an accessor turning a pointer and an offset into a reference. The
+ * accessors follow \c AccessorBasic: a policy with a nested \c Accessor that defines \c pointer,
+ * \c reference and <tt>operator()(pointer, ptrdiff_t)</tt>, so views work on plain arrays as well as
+ * on \c MatrixEngine through \c GFElemRef.
+ */
+
+namespace GFlinalg {
+namespace op {
+
+/**
+ * The stored value behind a reference of a view: plain values as they are, element references such as
+ * \c GFElemRef through their \c val(). The algorithms read and write views through it, so they accept
+ * views of a \c MatrixEngine as well as of arrays.
+ */
+template <class T, std::enable_if_t<std::is_arithmetic_v<T>, int> = 0>
+constexpr T& viewValue(T& ref) noexcept {
+    return ref;
+}
+
+template <class Ref, std::enable_if_t<!std::is_arithmetic_v<std::remove_reference_t<Ref>>, int> = 0>
+constexpr auto& viewValue(Ref&& ref) {
+    return ref.val();
+}
+
+//! Value type stored behind the view \c View
+template <class View>
+using ViewValue = std::remove_cv_t<std::remove_reference_t<decltype(viewValue(std::declval<typename View::reference>()))>>;
+
+//! Whether the views give references into memory, so that rows can be walked with pointers
+template <class... Views>
+constexpr bool addressableViews() {
+    return (std::is_lvalue_reference_v<typename Views::reference> && ...);
+}
+} // namespace op
+
+/**
+ * Entry \c (i, j) at <tt>i * rowStride + j * colStride</tt>. Submatrices, column blocks and transposes
+ * stay in this layout.
+ */
+struct LayoutStrided {
+    struct mapping {
+        ptrdiff_t rowStride, colStride;
+
+        ptrdiff_t operator()(size_t i, size_t j) const noexcept {
+            return static_cast<ptrdiff_t>(i) * rowStride + static_cast<ptrdiff_t>(j) * colStride;
+        }
+
+        ptrdiff_t stride(size_t r) const noexcept { return r == 0 ? rowStride : colStride; }
+
+        //! Mapping of the submatrix starting at \c (i, j) and its offset
+        std::pair<mapping, ptrdiff_t> submatrix(size_t i, size_t j) const noexcept { return {*this, (*this)(i, j)}; }
+    };
+};
+
+/**
+ * Row \c i is row <tt>rows[i]</tt> of a strided matrix: entry \c (i, j) at
+ * <tt>rows[i] * rowStride + j * colStride</tt>. The index list is not copied and must outlive the view.
+ */
+struct LayoutGather {
+    struct mapping {
+        const size_t* rows;
+        ptrdiff_t rowStride, colStride;
+
+        ptrdiff_t operator()(size_t i, size_t j) const noexcept {
+            return static_cast<ptrdiff_t>(rows[i]) * rowStride + static_cast<ptrdiff_t>(j) * colStride;
+        }
+
+        ptrdiff_t stride(size_t r) const noexcept { return r == 0 ? 0 : colStride; }
+
+        std::pair<mapping, ptrdiff_t> submatrix(size_t i, size_t j) const noexcept {
+            return {{rows + i, rowStride, colStride}, static_cast<ptrdiff_t>(j) * colStride};
+        }
+    };
+};
+
+/**
+ * Accessor of plain arrays of \c T, e.g. the values of a \c DenseMatrix. \c R is unused and only keeps
+ * the shape of \c AccessorBasic.
+ */
+struct AccessorValue {
+    template <typename T, size_t R = 0>
+    struct Accessor {
+        using pointer   = T*;
+        using reference = T&;
+
+        constexpr reference operator()(pointer p, ptrdiff_t i) const noexcept { return p[i]; }
+    };
+};
+
+/**
+ * \c rows x \c cols view of the data behind \c pointer. Entry \c (i, j) is
+ * <tt>accessor(data, offset + mapping(i, j))</tt>; the offset moves with submatrices, so accessors whose
+ * pointers cannot be advanced (like \c AccessorBasic) still give views of any part of a matrix.
+ *
+ * Views are cheap to copy and never own the data.
+ */
+template <class Layout, class Accessor>
+class MatrixView {
+public:
+    using layout_type   = Layout;
+    using accessor_type = Accessor;
+    using mapping_type  = typename Layout::mapping;
+    using pointer       = typename Accessor::pointer;
+    using reference     = typename Accessor::reference;
+
+    MatrixView(pointer data, size_t rows, size_t cols, mapping_type map, ptrdiff_t offset = 0, Accessor accessor = {}) :
+        mData(data), mRows(rows), mCols(cols), mMap(map), mOffset(offset), mAccessor(accessor) {}
+
+    [[nodiscard]] size_t rows() const noexcept { return mRows; }
+
+    [[nodiscard]] size_t columns() const noexcept { return mCols; }
+
+    pointer data() const noexcept { return mData; }
+
+    ptrdiff_t offset() const noexcept { return mOffset; }
+
+    const mapping_type& mapping() const noexcept { return mMap; }
+
+    const Accessor& accessor() const noexcept { return mAccessor; }
+
+    reference operator()(size_t i, size_t j) const { return mAccessor(mData, mOffset + mMap(i, j)); }
+
+    //! Whether the entries of a row are adjacent, the region kernels need it
+    bool contiguousRows() const noexcept { return mMap.colStride == 1; }
+
+    /**
+     * The \c r x \c c block starting at \c (i, j).
+     *
+     * @throws std::out_of_range if the block is not inside the view.
+     */
+    MatrixView submatrix(size_t i, size_t j, size_t r, size_t c) const {
+        if (i + r > mRows || j + c > mCols)
+            throw std::out_of_range("Submatrix is outside the view");
+
+        const auto [map, shift] = mMap.submatrix(i, j);
+
+        return MatrixView(mData, r, c, map, mOffset + shift, mAccessor);
+    }
+
+    //! Columns <tt>j..j+c-1</tt>
+    MatrixView columnBlock(size_t j, size_t c) const { return submatrix(0, j, mRows, c); }
+
+private:
+    pointer mData;
+    size_t mRows, mCols;
+    mapping_type mMap;
+    ptrdiff_t mOffset;
+    Accessor mAccessor;
+};
+
+template <class Accessor>
+using StridedView = MatrixView<LayoutStrided, Accessor>;
+
+template <class Accessor>
+using GatherView = MatrixView<LayoutGather, Accessor>;
+
+/**
+ * Rows <tt>rows[0], rows[1], ...</tt> of \c v without copying, e.g. the surviving rows of a generator
+ * matrix. \c rows is not copied and must outlive the result.
+ *
+ * @throws std::out_of_range if an index is not a row of \c v.
+ */
+template <class Accessor>
+GatherView<Accessor> gatherRows(const StridedView<Accessor>& v, const std::vector<size_t>& rows) {
+    for (size_t i : rows)
+        if (i >= v.rows())
+            throw std::out_of_range("Gathered row is outside the view");
+
+    const auto& map = v.mapping();
+
+    return GatherView<Accessor>(v.data(), rows.size(), v.columns(), {rows.data(), map.rowStride, map.colStride},
+                                v.offset(), v.accessor());
+}
+
+//! The transpose of \c v without copying, the strides are exchanged
+template <class Accessor>
+StridedView<Accessor> transpose(const StridedView<Accessor>& v) {
+    const auto& map = v.mapping();
+
+    return StridedView<Accessor>(v.data(), v.columns(), v.rows(), {map.colStride, map.rowStride}, v.offset(),
+                                 v.accessor());
+}
+
+/**
+ * Row major view of \c rows x \c cols values at \c data, rows \c stride values apart.
+ */
+template <class T>
+StridedView<AccessorValue::Accessor<T>> makeView(T* data, size_t rows, size_t cols, size_t stride) noexcept {
+    return StridedView<AccessorValue::Accessor<T>>(data, rows, cols, {static_cast<ptrdiff_t>(stride), 1});
+}
+
+} // namespace GFlinalg
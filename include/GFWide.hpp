@@ -0,0 +1,454 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+#ifdef __PCLMUL__
+#include <wmmintrin.h>
+#endif
+
+namespace GFlinalg {
+namespace op {
+
+/**
+ * Carry-less 64 x 64 -> 128 bit multiplication without \c PCLMUL, usable where timing must not depend
+ * on the operands.
+ *
+ * Integer multiplication of operands with holes (every fourth bit kept) cannot carry into the kept
+ * bits of the product, so four masked integer products per output class give the carry-less product.
+ * The high half is the low half of the product of the bit reversed operands.
+ */
+struct ClmulPortable {
+    static uint64_t bmul64(uint64_t x, uint64_t y) noexcept {
+        constexpr uint64_t m0 = 0x1111111111111111ULL, m1 = 0x2222222222222222ULL;
+        constexpr uint64_t m2 = 0x4444444444444444ULL, m3 = 0x8888888888888888ULL;
+
+        uint64_t x0 = x & m0, x1 = x & m1, x2 = x & m2, x3 = x & m3;
+        uint64_t y0 = y & m0, y1 = y & m1, y2 = y & m2, y3 = y & m3;
+
+        uint64_t z0 = (x0 * y0) ^ (x1 * y3) ^ (x2 * y2) ^ (x3 * y1);
+        uint64_t z1 = (x0 * y1) ^ (x1 * y0) ^ (x2 * y3) ^ (x3 * y2);
+        uint64_t z2 = (x0 * y2) ^ (x1 * y1) ^ (x2 * y0) ^ (x3 * y3);
+        uint64_t z3 = (x0 * y3) ^ (x1 * y2) ^ (x2 * y1) ^ (x3 * y0);
+
+        return (z0 & m0) | (z1 & m1) | (z2 & m2) | (z3 & m3);
+    }
+
+    static uint64_t rev64(uint64_t x) noexcept {
+        x = ((x & 0x5555555555555555ULL) << 1) | ((x >> 1) & 0x5555555555555555ULL);
+        x = ((x & 0x3333333333333333ULL) << 2) | ((x >> 2) & 0x3333333333333333ULL);
+        x = ((x & 0x0F0F0F0F0F0F0F0FULL) << 4) | ((x >> 4) & 0x0F0F0F0F0F0F0F0FULL);
+
+        return __builtin_bswap64(x);
+    }
+
+    /**
+     * <tt>(lo, hi) = a * b</tt> over \c GF(2)[x].
+     */
+    static void mul(uint64_t a, uint64_t b, uint64_t& lo, uint64_t& hi) noexcept {
+        lo = bmul64(a, b);
+        hi = rev64(bmul64(rev64(a), rev64(b))) >> 1;
+    }
+};
+
+/**
+ * Whether \c clmul64 is a single instruction, the portable version is several times slower than a table lookup.
+ */
+#ifdef __PCLMUL__
+constexpr bool hasClmul = true;
+#else
+constexpr bool hasClmul = false;
+#endif
+
+/**
+ * Carry-less 64 x 64 -> 128 bit multiplication, \c PCLMULQDQ when the target has it.
+ */
+inline void clmul64(uint64_t a, uint64_t b, uint64_t& lo, uint64_t& hi) noexcept {
+#ifdef __PCLMUL__
+    __m128i r = _mm_clmulepi64_si128(_mm_cvtsi64_si128(static_cast<long long>(a)),
+                                     _mm_cvtsi64_si128(static_cast<long long>(b)), 0x00);
+
+    lo = static_cast<uint64_t>(_mm_cvtsi128_si64(r));
+    hi = static_cast<uint64_t>(_mm_cvtsi128_si64(_mm_unpackhi_epi64(r, r)));
+#else
+    ClmulPortable::mul(a, b, lo, hi);
+#endif
+}
+
+/**
+ * Spread the bits of \c x over 128 bits (bit \c i goes to bit \c 2i), i.e. squaring over \c GF(2)[x].
+ */
+inline void spread64(uint64_t x, uint64_t& lo, uint64_t& hi) noexcept {
+    auto spread32 = [](uint64_t v) {
+        v = (v | (v << 16)) & 0x0000FFFF0000FFFFULL;
+        v = (v | (v << 8)) & 0x00FF00FF00FF00FFULL;
+        v = (v | (v << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        v = (v | (v << 2)) & 0x3333333333333333ULL;
+        v = (v | (v << 1)) & 0x5555555555555555ULL;
+        return v;
+    };
+
+    lo = spread32(x & 0xFFFFFFFFULL);
+    hi = spread32(x >> 32);
+}
+
+namespace wide {
+
+//! Operand size (in limbs) up to which products are computed by schoolbook multiplication
+constexpr size_t karatsubaCutoff = 3;
+
+/**
+ * <tt>out[0..2N) = a * b</tt> over \c GF(2)[x], Karatsuba above \c karatsubaCutoff limbs.
+ */
+template <size_t N>
+void mulLimbs(const uint64_t* a, const uint64_t* b, uint64_t* out) noexcept {
+    if constexpr (N <= karatsubaCutoff) {
+        for (size_t i = 0; i < 2 * N; ++i)
+            out[i] = 0;
+
+        for (size_t i = 0; i < N; ++i) {
+            for (size_t j = 0; j < N; ++j) {
+                uint64_t lo, hi;
+
+                clmul64(a[i], b[j], lo, hi);
+                out[i + j] ^= lo;
+                out[i + j + 1] ^= hi;
+            }
+        }
+    } else {
+        // a = a0 + x^(64h) a1, a0 has h limbs and a1 has H = N - h >= h limbs
+        constexpr size_t h = N / 2;
+        constexpr size_t H = N - h;
+
+        uint64_t sa[H], sb[H], mid[2 * H];
+
+        for (size_t i = 0; i < H; ++i) {
+            sa[i] = a[h + i] ^ (i < h ? a[i] : 0);
+            sb[i] = b[h + i] ^ (i < h ? b[i] : 0);
+        }
+
+        uint64_t lo[2 * H] = {}, hi[2 * H];
+
+        mulLimbs<h>(a, b, lo);
+        mulLimbs<H>(a + h, b + h, hi);
+        mulLimbs<H>(sa, sb, mid);
+
+        // (a0 + a1)(b0 + b1) - a0 b0 - a1 b1
+        for (size_t i = 0; i < 2 * H; ++i)
+            mid[i] ^= lo[i] ^ hi[i];
+
+        for (size_t i = 0; i < 2 * h; ++i)
+            out[i] = lo[i];
+
+        for (size_t i = 2 * h; i < 2 * N; ++i)
+            out[i] = hi[i - 2 * h];
+
+        for (size_t i = 0; i < 2 * H; ++i)
+            out[h + i] ^= mid[i];
+    }
+}
+
+/**
+ * <tt>c ^= t * x^pos</tt>, \c t is a single limb.
+ */
+inline void xorShifted(uint64_t* c, size_t pos, uint64_t t) noexcept {
+    size_t limb = pos >> 6, off = pos & 63;
+
+    c[limb] ^= t << off;
+
+    if (off)
+        c[limb + 1] ^= t >> (64 - off);
+}
+} // namespace wide
+} // namespace op
+
+/**
+ * Multi-limb binary field element: \c GF(2^m) with the sparse modulus
+ * <tt>x^m + x^k1 + ... + x^kr + 1</tt> (\c taps are the middle exponents \c k, one for a trinomial and
+ * three for a pentanomial, e.g. <tt>WideBinPolynomial<163, 7, 6, 3></tt> for NIST B-163).
+ *
+ * The value is stored in \c limbs 64 bit words, least significant first. The interface matches
+ * \c BasicBinPolynomial except for \c gfOrder(), which does not fit in a \c size_t.
+ *
+ * Multiplication uses carry-less 64 bit products (\c PCLMUL or \c op::ClmulPortable) with Karatsuba
+ * above \c op::wide::karatsubaCutoff limbs. Reduction folds whole limbs with one shift-XOR per
+ * modulus term, which needs <tt>m - k >= 64</tt> for every tap. The modulus is assumed to be
+ * irreducible.
+ *
+ * Time complexity:
+ * <ul>
+ *  <li>"+" - O(L)</li>
+ *  <li>"*" - O(L^1.58) carry-less products and O(L) for the reduction</li>
+ *  <li>squaring - O(L)</li>
+ *  <li>"/" - m squarings and O(log(m)) multiplications (Itoh-Tsujii)</li>
+ * </ul>
+ */
+template <size_t m, size_t... taps>
+class WideBinPolynomial {
+public:
+    static constexpr size_t limbs = (m + 63) / 64;
+
+    using Limbs = std::array<uint64_t, limbs>;
+
+    static_assert(sizeof...(taps) == 1 || sizeof...(taps) == 3, "Modulus must be a trinomial or a pentanomial");
+    static_assert(((taps > 0 && m >= taps + 64) && ...), "Middle terms must be at least 64 below the degree");
+
+private:
+    Limbs value;
+
+    /**
+     * Reduce a double width product.
+     */
+    static Limbs reduceWide(std::array<uint64_t, 2 * limbs>& c) noexcept {
+        // Whole limbs above the field, top down: bits land at least 64 positions lower
+        for (size_t i = 2 * limbs - 1; i >= limbs; --i) {
+            uint64_t t = c[i];
+
+            c[i] = 0;
+            op::wide::xorShifted(c.data(), 64 * i - m, t);
+            (op::wide::xorShifted(c.data(), 64 * i - m + taps, t), ...);
+        }
+
+        Limbs res;
+
+        for (size_t i = 0; i < limbs; ++i)
+            res[i] = c[i];
+
+        if constexpr (m % 64 != 0) {
+            uint64_t t = res[limbs - 1] >> (m % 64);
+
+            res[limbs - 1] &= (uint64_t(1) << (m % 64)) - 1;
+            res[0] ^= t;
+            (op::wide::xorShifted(res.data(), taps, t), ...);
+        }
+
+        return res;
+    }
+
+public:
+    explicit WideBinPolynomial() : value{} {}
+
+    /**
+     * @param val low 64 coefficients
+     */
+    explicit WideBinPolynomial(uint64_t val) : value{} { value[0] = val; }
+
+    /**
+     * @param val limbs, least significant first
+     * @param doReduce clear the bits above \c m - 1 by reduction
+     */
+    explicit WideBinPolynomial(const Limbs& val, bool doReduce = true) : value(val) {
+        if (doReduce)
+            reduce();
+    }
+
+    /**
+     * Construct from a container of coefficients, passed left to right (highest power first).
+     */
+    template <typename Iter>
+    explicit WideBinPolynomial(Iter first, Iter last) : value{} {
+        std::array<uint64_t, 2 * limbs> c{};
+
+        for (; first != last; ++first) {
+            for (size_t i = 2 * limbs; i-- > 1;)
+                c[i] = (c[i] << 1) | (c[i - 1] >> 63);
+
+            c[0] = (c[0] << 1) | (static_cast<uint64_t>(*first) & 1);
+        }
+
+        value = reduceWide(c);
+    }
+
+    const Limbs& val() const noexcept { return value; }
+
+    Limbs& val() noexcept { return value; }
+
+    /**
+     * @return Middle exponents of the modulus <tt>x^m + x^k1 + ... + 1</tt>.
+     */
+    static constexpr std::array<size_t, sizeof...(taps)> getTaps() { return {taps...}; }
+
+    //! For GF(2^m) returns m
+    static constexpr size_t gfDegree() { return m; }
+
+    //! Degree of the polynomial, 0 for 0
+    size_t degree() const noexcept {
+        for (size_t i = limbs; i-- > 0;)
+            if (value[i])
+                return 64 * i + 63 - __builtin_clzll(value[i]);
+
+        return 0;
+    }
+
+    bool isZero() const noexcept {
+        uint64_t acc = 0;
+
+        for (uint64_t v : value)
+            acc |= v;
+
+        return acc == 0;
+    }
+
+    //! Reduces the top limb by the modulus
+    const Limbs& reduce() noexcept {
+        std::array<uint64_t, 2 * limbs> c{};
+
+        for (size_t i = 0; i < limbs; ++i)
+            c[i] = value[i];
+
+        value = reduceWide(c);
+        return value;
+    }
+
+    WideBinPolynomial square() const noexcept {
+        std::array<uint64_t, 2 * limbs> c;
+
+        for (size_t i = 0; i < limbs; ++i)
+            op::spread64(value[i], c[2 * i], c[2 * i + 1]);
+
+        WideBinPolynomial res;
+        res.value = reduceWide(c);
+        return res;
+    }
+
+    /**
+     * <tt>a^(2^k)</tt>
+     */
+    WideBinPolynomial frobenius(size_t k) const noexcept {
+        WideBinPolynomial res(*this);
+
+        for (size_t i = 0; i < k; ++i)
+            res = res.square();
+
+        return res;
+    }
+
+    /**
+     * Itoh-Tsujii inversion <tt>a^(-1) = (a^(2^(m-1) - 1))^2</tt>, zero is mapped to zero.
+     */
+    WideBinPolynomial getInverse() const noexcept {
+        // res = a^(2^k - 1), processed over the bits of m - 1 from the top
+        constexpr size_t e = m - 1;
+
+        size_t top = 0;
+        while ((e >> (top + 1)) != 0)
+            ++top;
+
+        WideBinPolynomial res(*this);
+        size_t k = 1;
+
+        for (size_t i = top; i-- > 0;) {
+            res = res.frobenius(k) * res;
+            k <<= 1;
+
+            if ((e >> i) & 1) {
+                res = res.square() * *this;
+                ++k;
+            }
+        }
+
+        return res.square();
+    }
+
+    WideBinPolynomial& invert() noexcept {
+        *this = getInverse();
+        return *this;
+    }
+
+    friend WideBinPolynomial operator+(const WideBinPolynomial& a, const WideBinPolynomial& b) noexcept {
+        WideBinPolynomial res;
+
+        for (size_t i = 0; i < limbs; ++i)
+            res.value[i] = a.value[i] ^ b.value[i];
+
+        return res;
+    }
+
+    friend WideBinPolynomial operator-(const WideBinPolynomial& a, const WideBinPolynomial& b) noexcept {
+        return a + b;
+    }
+
+    WideBinPolynomial& operator+=(const WideBinPolynomial& other) noexcept {
+        for (size_t i = 0; i < limbs; ++i)
+            value[i] ^= other.value[i];
+
+        return *this;
+    }
+
+    friend WideBinPolynomial operator*(const WideBinPolynomial& a, const WideBinPolynomial& b) noexcept {
+        std::array<uint64_t, 2 * limbs> c;
+
+        op::wide::mulLimbs<limbs>(a.value.data(), b.value.data(), c.data());
+
+        WideBinPolynomial res;
+        res.value = reduceWide(c);
+        return res;
+    }
+
+    WideBinPolynomial& operator*=(const WideBinPolynomial& other) noexcept {
+        *this = *this * other;
+        return *this;
+    }
+
+    friend WideBinPolynomial operator/(const WideBinPolynomial& a, const WideBinPolynomial& b) {
+        if (b.isZero())
+            throw std::out_of_range("Division by zero");
+
+        return a * b.getInverse();
+    }
+
+    WideBinPolynomial& operator/=(const WideBinPolynomial& other) {
+        *this = *this / other;
+        return *this;
+    }
+
+    friend bool operator==(const WideBinPolynomial& a, const WideBinPolynomial& b) noexcept {
+        return a.value == b.value;
+    }
+
+    friend bool operator!=(const WideBinPolynomial& a, const WideBinPolynomial& b) noexcept {
+        return a.value != b.value;
+    }
+
+    /**
+     * Element is written as a hexadecimal number, most significant limb first.
+     */
+    friend std::ostream& operator<<(std::ostream& out, const WideBinPolynomial& a) {
+        constexpr char digits[] = "0123456789abcdef";
+
+        std::string text = "0x";
+
+        for (size_t i = limbs; i-- > 0;)
+            for (size_t k = 16; k-- > 0;)
+                text.push_back(digits[(a.value[i] >> (4 * k)) & 15]);
+
+        return out.write(text.data(), static_cast<std::streamsize>(text.size()));
+    }
+};
+
+template <size_t m, size_t... taps>
+WideBinPolynomial<m, taps...> pow(const WideBinPolynomial<m, taps...>& val, size_t power) {
+    WideBinPolynomial<m, taps...> res(1);
+    WideBinPolynomial<m, taps...> sq(val);
+
+    while (power) {
+        if (power & 1)
+            res *= sq;
+
+        sq = sq.square();
+        power >>= 1;
+    }
+
+    return res;
+}
+
+/// NIST binary field polynomials (FIPS 186-4, D.1.3)
+using GF2m163 = WideBinPolynomial<163, 7, 6, 3>;
+using GF2m233 = WideBinPolynomial<233, 74>;
+using GF2m283 = WideBinPolynomial<283, 12, 7, 5>;
+using GF2m409 = WideBinPolynomial<409, 87>;
+using GF2m571 = WideBinPolynomial<571, 10, 5, 2>;
+}
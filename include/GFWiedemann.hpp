@@ -0,0 +1,484 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "GFBerlekampMassey.hpp"
+#include "GFSparse.hpp"
+#include "GFTrace.hpp"
+
+/**
+ * @defgroup Wiedemann
+ *
+ * Iterative black box solver for large sparse square systems <tt>A x = b</tt>, the matrix is only used
+ * through products with vectors.
+ */
+
+namespace GFlinalg {
+namespace op {
+
+/*
+ * Polynomials over the field of Elem as coefficient vectors, lowest degree first and without leading
+ * zeros; the zero polynomial is empty.
+ */
+
+template <class Elem>
+void polyTrim(std::vector<Elem>& a) {
+    while (!a.empty() && a.back().val() == 0)
+        a.pop_back();
+}
+
+template <class Elem>
+std::vector<Elem> polyMul(const std::vector<Elem>& a, const std::vector<Elem>& b) {
+    if (a.empty() || b.empty())
+        return {};
+
+    std::vector<Elem> res(a.size() + b.size() - 1, Elem(0));
+
+    for (size_t i = 0; i < a.size(); ++i)
+        for (size_t j = 0; j < b.size(); ++j)
+            res[i + j] += a[i] * b[j];
+
+    return res;
+}
+
+/**
+ * <tt>a = q * b + r</tt>, \c b nonzero.
+ */
+template <class Elem>
+void polyDivMod(std::vector<Elem> a, const std::vector<Elem>& b, std::vector<Elem>& q, std::vector<Elem>& r) {
+    const Elem lead = Elem(1) / b.back();
+
+    q.assign(a.size() >= b.size() ? a.size() - b.size() + 1 : 0, Elem(0));
+
+    for (size_t i = a.size(); i-- >= b.size();) {
+        if (a[i].val() == 0)
+            continue;
+
+        const Elem c = a[i] * lead;
+        const size_t shift = i + 1 - b.size();
+
+        q[shift] = c;
+
+        for (size_t j = 0; j < b.size(); ++j)
+            a[shift + j] += c * b[j];
+    }
+
+    polyTrim(a);
+    r = std::move(a);
+}
+
+//! Monic greatest common divisor
+template <class Elem>
+std::vector<Elem> polyGcd(std::vector<Elem> a, std::vector<Elem> b) {
+    std::vector<Elem> q, r;
+
+    while (!b.empty()) {
+        polyDivMod(a, b, q, r);
+        a = std::move(b);
+        b = std::move(r);
+    }
+
+    if (!a.empty()) {
+        const Elem lead = Elem(1) / a.back();
+
+        for (auto& c : a)
+            c *= lead;
+    }
+
+    return a;
+}
+
+//! Monic least common multiple of two nonzero polynomials
+template <class Elem>
+std::vector<Elem> polyLcm(const std::vector<Elem>& a, const std::vector<Elem>& b) {
+    std::vector<Elem> q, r;
+
+    polyDivMod(a, polyGcd(a, b), q, r);
+
+    auto res = polyMul(q, b);
+    const Elem lead = Elem(1) / res.back();
+
+    for (auto& c : res)
+        c *= lead;
+
+    return res;
+}
+
+} // namespace op
+
+enum class WiedemannStatus { Solution, Nullspace, Failed };
+
+template <class Elem>
+struct WiedemannResult {
+    WiedemannStatus status;
+    std::vector<Elem> vector;       /*!<x with <tt>A x = b</tt> or a nonzero v with <tt>A v = 0</tt>*/
+};
+
+/**
+ * Wiedemann solver for a square \c CsrMatrix over the field of \c Elem.
+ *
+ * The Krylov sequence <tt>b, A b, A^2 b, ...</tt> is projected on a block of \c blockSize random vectors
+ * at once, giving as many scalar sequences for the cost of one matrix product per term. Each sequence
+ * is fed to \c BerlekampMassey as it grows, and generation stops once every connection polynomial
+ * has predicted the last \c margin terms and has seen at least <tt>2L + margin</tt>, at most <tt>2n + margin</tt>. The least common multiple
+ * \c f of the reversed connection polynomials annihilates \c b with high probability:
+ * <ul>
+ *   <li><tt>f(0) != 0</tt> - <tt>x = f(0)^-1 (f(A) - f(0)) A^-1 b</tt>, evaluated by Horner's rule</li>
+ *   <li><tt>f = x^k g</tt> - <tt>A^k g(A) b = 0</tt>, the last nonzero of <tt>g(A) b, A g(A) b, ...</tt> is in the nullspace</li>
+ * </ul>
+ * Every result is checked against \c A and a failed attempt is repeated with new projections.
+ *
+ * The products and the Berlekamp-Massey updates of the block run on \c threads threads when the
+ * matrix has at least \c threadNonzeros nonzeros per thread, enough to pay for starting them.
+ *
+ * Systems over \c GF(2) are solved over an extension field by \c solveBinary: the entries of \c A and
+ * \c b are 0 or 1 and the result is mapped back by the trace.
+ *
+ * Time complexity: O(n * (nonzeros + n * blockSize)) per attempt
+ */
+template <class Elem>
+class WiedemannSolver {
+public:
+    //! Extra terms that confirm a linear complexity
+    static constexpr size_t margin = 16;
+
+    //! Default nonzeros per thread below which the matrix is processed on one thread
+    static constexpr size_t parallelNonzeros = size_t(1) << 15;
+
+    /**
+     * The matrix is not copied and must outlive the solver.
+     *
+     * @throws std::invalid_argument if the matrix is not square or \c blockSize is zero.
+     */
+    WiedemannSolver(const CsrMatrix<Elem>& a, size_t blockSize = 4, unsigned threads = std::thread::hardware_concurrency(),
+                    uint64_t seed = 1, size_t threadNonzeros = parallelNonzeros) :
+        mA(a), mBlock(blockSize), mRandom(seed) {
+        if (a.rows() != a.columns())
+            throw std::invalid_argument("Wiedemann solver needs a square matrix");
+
+        if (blockSize == 0)
+            throw std::invalid_argument("Block size must be positive");
+
+        // Row ranges with about the same number of nonzeros, one per thread
+        if (threads < 2 || a.nonzeros() < threads * threadNonzeros)
+            threads = 1;
+
+        const auto& offsets = a.offsets();
+
+        mParts.push_back(0);
+
+        for (unsigned t = 1; t < threads; ++t) {
+            size_t target = a.nonzeros() * t / threads;
+            mParts.push_back(std::lower_bound(offsets.begin() + mParts.back(), offsets.end() - 1, target) - offsets.begin());
+        }
+
+        mParts.push_back(a.rows());
+    }
+
+    size_t size() const noexcept { return mA.rows(); }
+
+    size_t blockSize() const noexcept { return mBlock; }
+
+    unsigned threads() const noexcept { return static_cast<unsigned>(mParts.size() - 1); }
+
+    /**
+     * @return \c Solution with \c x, \c Nullspace with a null vector of a singular \c A, or \c Failed
+     * after \c attempts tries.
+     * @throws std::invalid_argument if \c b does not have \c size() entries.
+     */
+    WiedemannResult<Elem> solve(const std::vector<Elem>& b, size_t attempts = 3) {
+        if (b.size() != size())
+            throw std::invalid_argument("Vector size does not match the matrix");
+
+        for (size_t attempt = 0; attempt < attempts; ++attempt) {
+            std::vector<Elem> f = generator(b);
+            size_t k = 0;
+
+            while (k < f.size() && f[k].val() == 0)
+                ++k;
+
+            std::vector<Elem> g(f.begin() + k, f.end());
+
+            if (k == 0) {
+                // x = g_0^-1 (g_1 b + g_2 A b + ... + g_d A^(d-1) b)
+                std::vector<Elem> x(size(), Elem(0));
+
+                for (size_t i = g.size(); i-- > 1;)
+                    x = axpy(product(x), g[i], b);
+
+                const Elem inv = Elem(1) / g[0];
+
+                for (auto& e : x)
+                    e *= inv;
+
+                if (product(x) == b)
+                    return {WiedemannStatus::Solution, std::move(x)};
+            } else {
+                std::vector<Elem> w(size(), Elem(0));
+
+                for (size_t i = g.size(); i-- > 0;)
+                    w = axpy(i + 1 == g.size() ? w : product(w), g[i], b);
+
+                for (size_t j = 0; j < k && !isZero(w); ++j) {
+                    std::vector<Elem> z = product(w);
+
+                    if (isZero(z))
+                        return {WiedemannStatus::Nullspace, std::move(w)};
+
+                    w = std::move(z);
+                }
+            }
+        }
+
+        return {WiedemannStatus::Failed, {}};
+    }
+
+    /**
+     * A nonzero null vector: <tt>A x = A y</tt> is solved for a random \c y, <tt>x - y</tt> is in the
+     * nullspace.
+     *
+     * @return \c Nullspace, or \c Failed if none was found, e.g. for a nonsingular matrix.
+     */
+    WiedemannResult<Elem> nullspace(size_t attempts = 3) {
+        for (size_t attempt = 0; attempt < attempts; ++attempt) {
+            std::vector<Elem> y = randomVector();
+            auto res = solve(product(y), 1);
+
+            if (res.status == WiedemannStatus::Solution) {
+                for (size_t i = 0; i < size(); ++i)
+                    res.vector[i] += y[i];
+
+                if (isZero(res.vector))
+                    continue;
+
+                res.status = WiedemannStatus::Nullspace;
+            }
+
+            if (res.status == WiedemannStatus::Nullspace)
+                return res;
+        }
+
+        return {WiedemannStatus::Failed, {}};
+    }
+
+    /**
+     * \c solve for a system over \c GF(2): the solution is mapped componentwise by <tt>Tr(c x)</tt> with
+     * <tt>Tr(c) = 1</tt>, a null vector by <tt>Tr(c v)</tt> for the first basis element \c c that gives a
+     * nonzero result. The entries of the result are 0 or 1.
+     *
+     * @throws std::invalid_argument if \c A or \c b has an entry other than 0 and 1.
+     */
+    WiedemannResult<Elem> solveBinary(const std::vector<Elem>& b, size_t attempts = 3) {
+        for (const auto& v : mA.values())
+            if (v != 1)
+                throw std::invalid_argument("Binary system expected");
+
+        for (const auto& e : b)
+            if (e.val() > 1)
+                throw std::invalid_argument("Binary system expected");
+
+        auto res = solve(b, attempts);
+
+        if (res.status == WiedemannStatus::Failed)
+            return res;
+
+        for (size_t i = 0; i < Elem::gfDegree(); ++i) {
+            Elem c(static_cast<typename CsrMatrix<Elem>::Value>(1) << i);
+
+            if (res.status == WiedemannStatus::Solution && trace(c) == 0)
+                continue;
+
+            std::vector<Elem> bits;
+
+            for (const auto& e : res.vector)
+                bits.push_back(Elem(trace(c * e)));
+
+            if (res.status == WiedemannStatus::Solution || !isZero(bits))
+                return {res.status, std::move(bits)};
+        }
+
+        return {WiedemannStatus::Failed, {}};
+    }
+
+private:
+    const CsrMatrix<Elem>& mA;
+    size_t mBlock;
+    std::mt19937_64 mRandom;
+    std::vector<size_t> mParts;     /*!<Row ranges of the threads*/
+
+    /**
+     * @return Least common multiple of the minimal polynomials of the projected sequences.
+     */
+    std::vector<Elem> generator(const std::vector<Elem>& b) {
+        const size_t chunk = 64;
+        const size_t limit = 2 * size() + margin;
+
+        std::vector<std::vector<Elem>> u(mBlock), terms(mBlock);
+        std::vector<BerlekampMassey<Elem>> bm(mBlock);
+
+        for (auto& p : u)
+            p = randomVector();
+
+        // The projections u_k . A^i b of the next term
+        std::vector<Elem> v = b, proj = project(u, v);
+        size_t generated = 0;
+        bool done = false;
+
+        while (!done && generated < limit) {
+            for (auto& t : terms)
+                t.clear();
+
+            for (size_t i = 0; i < chunk && generated < limit; ++i, ++generated) {
+                for (size_t k = 0; k < mBlock; ++k)
+                    terms[k].push_back(proj[k]);
+
+                v = product(v, u, proj);
+            }
+
+            parallel(mBlock, [&](size_t k) { bm[k].update(terms[k].begin(), terms[k].end()); });
+
+            done = true;
+
+            for (const auto& m : bm)
+                done = done && m.agreeing() >= margin && m.size() >= 2 * m.complexity() + margin;
+        }
+
+        std::vector<Elem> f{Elem(1)};
+
+        for (const auto& m : bm) {
+            auto c = m.connection();
+
+            // x^L C(1/x)
+            std::reverse(c.begin(), c.end());
+            f = op::polyLcm(f, c);
+        }
+
+        return f;
+    }
+
+    std::vector<Elem> product(const std::vector<Elem>& x) const {
+        std::vector<Elem> proj;
+        return product(x, {}, proj);
+    }
+
+    /**
+     * <tt>A x</tt>, and <tt>proj[k] = u[k] . A x</tt> summed by each thread over its rows while they are
+     * still in cache.
+     */
+    std::vector<Elem> product(const std::vector<Elem>& x, const std::vector<std::vector<Elem>>& u,
+                              std::vector<Elem>& proj) const {
+        std::vector<Elem> y(size(), Elem(0));
+        std::vector<std::vector<Elem>> partial(threads());
+        const auto& offsets = mA.offsets();
+        const auto& indices = mA.indices();
+        const auto& values  = mA.values();
+
+        parallel(threads(), [&](size_t t) {
+            // Locals, so that the stores to y need not reload the matrix
+            const auto* off = offsets.data();
+            const auto* idx = indices.data();
+            const auto* val = values.data();
+            const Elem* in  = x.data();
+            Elem* out       = y.data();
+
+            for (size_t i = mParts[t], end = mParts[t + 1]; i < end; ++i) {
+                Elem s(0);
+
+                for (size_t q = off[i]; q < off[i + 1]; ++q)
+                    s += Elem(val[q]) * in[idx[q]];
+
+                out[i] = s;
+            }
+
+            partial[t] = projectRows(t, u, y);
+        });
+
+        proj = reduce(partial, u.size());
+        return y;
+    }
+
+    //! <tt>u[k] . y</tt> for every \c k
+    std::vector<Elem> project(const std::vector<std::vector<Elem>>& u, const std::vector<Elem>& y) const {
+        std::vector<std::vector<Elem>> partial(threads());
+
+        parallel(threads(), [&](size_t t) { partial[t] = projectRows(t, u, y); });
+
+        return reduce(partial, u.size());
+    }
+
+    //! <tt>u[k] . y</tt> over the rows of thread \c t
+    std::vector<Elem> projectRows(size_t t, const std::vector<std::vector<Elem>>& u, const std::vector<Elem>& y) const {
+        std::vector<Elem> sums(u.size(), Elem(0));
+
+        for (size_t k = 0; k < u.size(); ++k) {
+            Elem s(0);
+
+            for (size_t i = mParts[t]; i < mParts[t + 1]; ++i)
+                s += u[k][i] * y[i];
+
+            sums[k] = s;
+        }
+
+        return sums;
+    }
+
+    //! Sum of the partial projections of the threads
+    static std::vector<Elem> reduce(const std::vector<std::vector<Elem>>& partial, size_t count) {
+        std::vector<Elem> sums(count, Elem(0));
+
+        for (const auto& p : partial)
+            for (size_t k = 0; k < count; ++k)
+                sums[k] += p[k];
+
+        return sums;
+    }
+
+    //! <tt>w + c * b</tt>
+    static std::vector<Elem> axpy(std::vector<Elem> w, const Elem& c, const std::vector<Elem>& b) {
+        for (size_t i = 0; i < w.size(); ++i)
+            w[i] += c * b[i];
+
+        return w;
+    }
+
+    static bool isZero(const std::vector<Elem>& x) {
+        return std::all_of(x.begin(), x.end(), [](const Elem& e) { return e.val() == 0; });
+    }
+
+    std::vector<Elem> randomVector() {
+        std::vector<Elem> res;
+
+        res.reserve(size());
+
+        for (size_t i = 0; i < size(); ++i)
+            res.push_back(Elem(static_cast<typename CsrMatrix<Elem>::Value>(mRandom() % Elem::gfOrder())));
+
+        return res;
+    }
+
+    //! Runs <tt>fn(0..count-1)</tt>, on separate threads for a large matrix
+    template <class Fn>
+    void parallel(size_t count, Fn fn) const {
+        if (count < 2 || threads() < 2) {
+            for (size_t t = 0; t < count; ++t)
+                fn(t);
+
+            return;
+        }
+
+        std::vector<std::thread> workers;
+
+        for (size_t t = 0; t < count; ++t)
+            workers.emplace_back([&fn, t] { fn(t); });
+
+        for (auto& w : workers)
+            w.join();
+    }
+};
+
+} // namespace GFlinalg
@@ -3,6 +3,10 @@
 #include <iostream>
 #include <memory>
 #include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "GFModulus.hpp"
 
 namespace GFlinalg {
 
@@ -56,6 +60,16 @@ class MatrixEngine;
 
 namespace op {
 
+/**
+ * Enables operand validation in the otherwise unchecked fast paths (see \c GFScope).
+ * Define \c GFLINALG_DEBUG to keep the checks.
+ */
+#ifdef GFLINALG_DEBUG
+constexpr bool checkedArithmetic = true;
+#else
+constexpr bool checkedArithmetic = false;
+#endif
+
 /**
  * @return Position of the leading 1 in the polynomial.
  */
@@ -91,6 +105,108 @@ constexpr uint8_t modPolDegree(const T& modPol) {
     return pos;
 }
 
+/**
+ * Reduction descriptor of a trinomial <tt>x^n + x^k + 1</tt> or a pentanomial
+ * <tt>x^n + x^k1 + x^k2 + x^k3 + 1</tt> modulus.
+ *
+ * For such moduli <tt>x^n = x^k1 + ... + 1</tt>, so the bits above \c n are folded
+ * back by a handful of shifts and XORs instead of a bit-by-bit long division.
+ */
+struct SparseModulus {
+    uint8_t degree = 0;              /*!<Degree \c n of the modulus*/
+    uint8_t count  = 0;              /*!<Number of low order terms, including the constant one*/
+    std::array<uint8_t, 4> taps{};   /*!<Exponents of the low order terms, highest first*/
+    bool sparse    = false;          /*!<Whether the modulus is a trinomial or a pentanomial*/
+
+    /**
+     * @return Number of bits one fold is guaranteed to clear above the degree.
+     */
+    constexpr uint8_t gap() const { return degree - taps[0]; }
+};
+
+/**
+ * @return Descriptor of \c modPol; \c sparse is set for trinomials and pentanomials only.
+ */
+template <class T>
+constexpr SparseModulus sparseModulus(const T& modPol) {
+    SparseModulus d;
+
+    d.degree = modPolDegree<T>(modPol);
+
+    for (size_t i = d.degree; i-- > 0;) {
+        if (!((modPol >> i) & 1))
+            continue;
+
+        if (d.count == d.taps.size())
+            return SparseModulus{d.degree, 0, {}, false};
+
+        d.taps[d.count++] = i;
+    }
+
+    d.sparse = d.degree > 1 && (d.count == 2 || d.count == 4) && d.taps[d.count - 1] == 0;
+
+    return d;
+}
+
+/**
+ * Reduces \c v, whose set bits all lie below \c width, by a sparse modulus.
+ *
+ * Every fold clears at least \c gap() bits above the degree, so the number of passes depends only
+ * on \c width and the descriptor; for a constant descriptor both loops are fully unrolled.
+ */
+template <class W>
+constexpr W foldReduce(W v, const SparseModulus& d, size_t width) {
+    const W mask = (W(1) << d.degree) - 1;
+
+    while (width > d.degree) {
+        W hi = v >> d.degree;
+        v &= mask;
+
+        for (size_t k = 0; k < d.count; ++k)
+            v ^= hi << d.taps[k];
+
+        width = width - d.gap() > d.degree ? width - d.gap() : d.degree;
+    }
+
+    return v;
+}
+
+/**
+ * Word type wide enough to hold a carry-less product of two \c T.
+ */
+template <class T>
+using ProductWord = std::conditional_t<(sizeof(T) < 4), uint32_t,
+                                       std::conditional_t<(sizeof(T) == 4), uint64_t, unsigned __int128>>;
+
+/**
+ * Multiplies reduced polynomials \c a and \c b of a degree \c d.degree field: the whole carry-less
+ * product is accumulated first and then folded by the sparse modulus.
+ */
+template <class T>
+constexpr T sparseMul(T a, T b, const SparseModulus& d) {
+    using W = ProductWord<T>;
+
+    W acc = 0;
+    W av  = a;
+
+    for (size_t i = 0; i < d.degree; ++i, av <<= 1)
+        acc ^= av & (W(0) - ((W(b) >> i) & 1));
+
+    return static_cast<T>(foldReduce<W>(acc, d, 2 * d.degree - 1));
+}
+
+/**
+ * Bit-by-bit reduction of \c v by \c modPol; works for any modulus and any stored value.
+ */
+template <class T>
+constexpr T longReduce(T v, const T& modPol, size_t SZ) {
+    for (size_t i = sizeof(T) << 3; i-- > SZ;)
+        if ((v >> i) & 1)
+            v ^= static_cast<T>(modPol << (i - SZ));
+
+    return v;
+}
+
 /**
  * Internal polynomial addition (equivalent to \c XOR).
  */
@@ -221,6 +337,10 @@ struct LUTArrPair {
         BasicBinPolynomial<T, modPol> modifier{2};
 
         for (size_t i = 0; i < order - 1; ++i) {
+            // x must generate the whole multiplicative group, a short cycle means a broken table
+            if (i > 0 && counter.val() == 1)
+                throw std::invalid_argument("Modulus polynomial is not primitive");
+
             indToPol[i]           = counter.val();
             polToInd[indToPol[i]] = i;
 
@@ -254,6 +374,10 @@ struct LUTVectPair {
         BasicGFElem<T> modifier{2, modPol};
 
         for (size_t i = 0; i < order - 1; ++i) {
+            // x must generate the whole multiplicative group, a short cycle means a broken table
+            if (i > 0 && counter.val() == 1)
+                throw std::invalid_argument("Modulus polynomial is not primitive");
+
             indToPol[i]           = counter.val();
             polToInd[indToPol[i]] = i;
             counter *= modifier;
@@ -0,0 +1,103 @@
+#include <random>
+#include <set>
+#include <vector>
+
+#include "catch.hpp"
+#include "GFBch.hpp"
+
+using Bch8 = GFlinalg::BchCode<uint16_t, 0x11d>;
+using Bch13 = GFlinalg::BchCode<uint16_t, 0x201b>;
+using Bch14 = GFlinalg::BchCode<uint16_t, 0x4443>;
+
+TEST_CASE("BCH generator construction", "[BCH]") {
+    using Cosets = std::vector<std::vector<size_t>>;
+
+    REQUIRE(GFlinalg::op::cyclotomicCosets(4) == Cosets{{0}, {1, 2, 4, 8}, {3, 6, 12, 9}, {5, 10}, {7, 14, 13, 11}});
+
+    // BCH(255, 247) and BCH(255, 239)
+    REQUIRE(Bch8::generator(1) == std::vector<uint64_t>{0x11d});
+    REQUIRE(Bch8::generator(2) == std::vector<uint64_t>{0x16f63});
+    REQUIRE(&Bch8::generator(2) == &Bch8::generator(2));
+
+    REQUIRE(Bch13(8, 512).parityBits() == 104);
+    REQUIRE(Bch14(40, 1024).parityBits() == 560);
+
+    REQUIRE_THROWS_AS(Bch8(0, 10), std::invalid_argument);
+    REQUIRE_THROWS_AS(Bch8(2, 30), std::invalid_argument);
+    REQUIRE_THROWS_AS((GFlinalg::BchCode<uint16_t, 0x11b>(2, 10)), std::invalid_argument);
+}
+
+TEMPLATE_TEST_CASE_SIG("BCH correction", "[BCH]", ((class Code, size_t t, size_t bytes), Code, t, bytes),
+                       (Bch8, 2, 29), (Bch8, 6, 20), (Bch13, 8, 512), (Bch14, 24, 1024)) {
+    const Code code(t, bytes);
+    const size_t bits = 8 * bytes + code.parityBits();
+
+    std::mt19937 rd(static_cast<unsigned>(t));
+    std::vector<uint8_t> data(bytes), parity(code.parityBytes());
+
+    for (auto& b : data)
+        b = static_cast<uint8_t>(rd());
+
+    code.encode(data.data(), parity.data());
+
+    auto received = data;
+    auto receivedParity = parity;
+
+    REQUIRE(code.decode(received.data(), receivedParity.data()) == 0);
+
+    auto flip = [&](size_t p) {
+        if (p < 8 * bytes)
+            received[p / 8] ^= uint8_t(0x80 >> (p % 8));
+        else
+            receivedParity[(p - 8 * bytes) / 8] ^= uint8_t(0x80 >> ((p - 8 * bytes) % 8));
+    };
+
+    for (size_t errors = 1; errors <= t; ++errors) {
+        for (size_t trial = 0; trial < 10; ++trial) {
+            std::set<size_t> positions;
+
+            while (positions.size() < errors)
+                positions.insert(rd() % bits);
+
+            for (size_t p : positions)
+                flip(p);
+
+            REQUIRE(code.decode(received.data(), receivedParity.data()) == static_cast<int>(errors));
+            REQUIRE(received == data);
+            REQUIRE(receivedParity == parity);
+        }
+    }
+
+    // Bits first and last in the codeword
+    flip(0);
+    flip(bits - 1);
+    REQUIRE(code.decode(received.data(), receivedParity.data()) == 2);
+    REQUIRE(received == data);
+    REQUIRE(receivedParity == parity);
+}
+
+TEST_CASE("BCH detects too many errors", "[BCH]") {
+    const Bch13 code(8, 512);
+
+    std::mt19937 rd;
+    std::vector<uint8_t> data(512), parity(code.parityBytes());
+
+    for (auto& b : data)
+        b = static_cast<uint8_t>(rd());
+
+    code.encode(data.data(), parity.data());
+
+    for (size_t trial = 0; trial < 20; ++trial) {
+        auto received = data;
+
+        for (size_t i = 0; i < 12; ++i)
+            received[rd() % 512] ^= uint8_t(1 << (rd() % 8));
+
+        auto before = received;
+
+        if (code.decode(received.data(), parity.data()) < 0)
+            REQUIRE(received == before);
+        else
+            REQUIRE(received != data);
+    }
+}
@@ -0,0 +1,123 @@
+#include <random>
+#include <vector>
+
+#include "catch.hpp"
+#include "GFBerlekampMassey.hpp"
+#include "GFLfsr.hpp"
+#include "GFSPlinalg.hpp"
+
+using GFlinalg::BerlekampMassey;
+using GFlinalg::BerlekampMasseyGF2;
+
+TEMPLATE_TEST_CASE("Linear complexity of LFSR output", "[BerlekampMassey]", (GFlinalg::Lfsr<uint32_t, 0x800021>),
+                   (GFlinalg::Lfsr<uint64_t, 0x900000000000f12d>)) {
+    constexpr size_t n = TestType::degree;
+
+    TestType lfsr(12345);
+    std::vector<uint8_t> stream(64);
+
+    lfsr.generate(stream.data(), stream.size());
+
+    BerlekampMasseyGF2 whole(true), chunked;
+
+    whole.update(stream.data(), stream.size() * 8);
+
+    // The connection polynomial is the reciprocal of the feedback polynomial
+    uint64_t expected = 0;
+
+    for (size_t i = 0; i <= n; ++i)
+        expected |= uint64_t((TestType::Polynomial::getMod() >> (n - i)) & 1) << i;
+
+    REQUIRE(whole.complexity() == n);
+    REQUIRE(whole.connection() == std::vector<uint64_t>{expected});
+    REQUIRE(whole.profile().back().second == n);
+
+    for (size_t pos = 0, step = 1; pos < stream.size(); pos += step, step += 2) {
+        step = std::min(step, stream.size() - pos);
+        chunked.update(stream.data() + pos, step * 8);
+    }
+
+    REQUIRE(chunked.size() == whole.size());
+    REQUIRE(chunked.connection() == whole.connection());
+}
+
+TEST_CASE("Word-parallel GF(2) agrees with the field version", "[BerlekampMassey]") {
+    using Bit = GFlinalg::BasicBinPolynomial<uint8_t, 0x3>;
+
+    std::mt19937 rd;
+    BerlekampMasseyGF2 packed(true);
+    BerlekampMassey<Bit> generic;
+    size_t lastL = 0;
+
+    for (size_t i = 1; i <= 3000; ++i) {
+        bool bit = rd() & 1;
+
+        packed.update(bit);
+        generic.update(Bit(bit));
+
+        REQUIRE(packed.complexity() == generic.complexity());
+
+        if (packed.complexity() != lastL) {
+            REQUIRE(packed.profile().back() == std::make_pair(uint64_t(i), packed.complexity()));
+            lastL = packed.complexity();
+        }
+
+        if (i % 250 == 0) {
+            auto words = packed.connection();
+            auto coeffs = generic.connection();
+
+            for (size_t k = 0; k < coeffs.size(); ++k)
+                REQUIRE(((words[k >> 6] >> (k & 63)) & 1) == coeffs[k].val());
+        }
+    }
+
+    // A random sequence has the complexity of about half its length
+    REQUIRE(packed.complexity() >= 1490);
+    REQUIRE(packed.complexity() <= 1510);
+}
+
+TEMPLATE_TEST_CASE("Recurrence over GF(2^8)", "[BerlekampMassey]", (GFlinalg::BasicBinPolynomial<uint16_t, 0x11d>),
+                   GFlinalg::BasicGFElem<uint32_t>) {
+    std::mt19937 rd;
+
+    auto elem = [](uint32_t v) {
+        if constexpr (std::is_same_v<TestType, GFlinalg::BasicGFElem<uint32_t>>)
+            return TestType(v, 0x11d);
+        else
+            return TestType(v);
+    };
+
+    // s_k = a_1 s_(k-1) + ... + a_6 s_(k-6)
+    std::vector<TestType> a, s;
+
+    for (size_t i = 0; i < 6; ++i) {
+        a.push_back(elem(rd() % 255 + (i == 5)));
+        s.push_back(elem(rd() % 256));
+    }
+
+    for (size_t k = 6; k < 40; ++k) {
+        TestType next = elem(0);
+
+        for (size_t i = 0; i < 6; ++i)
+            next += a[i] * s[k - 1 - i];
+
+        s.push_back(next);
+    }
+
+    BerlekampMassey<TestType> bm;
+
+    bm.update(s.begin(), s.begin() + 17);
+    bm.update(s.begin() + 17, s.end());
+
+    auto c = bm.connection();
+
+    REQUIRE(bm.complexity() == 6);
+    REQUIRE(c.size() == 7);
+    REQUIRE(c[0] == elem(1));
+
+    for (size_t i = 0; i < 6; ++i)
+        REQUIRE(c[i + 1] == a[i]);
+
+    bm.reset();
+    REQUIRE(bm.connection().empty());
+}
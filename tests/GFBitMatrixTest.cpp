@@ -0,0 +1,217 @@
+#include <random>
+#include <vector>
+
+#include "catch.hpp"
+#include "GFBitMatrix.hpp"
+#include "GFTPlinalg.hpp"
+
+using GFlinalg::BitMatrix;
+using Elem = GFlinalg::BasicBinPolynomial<uint16_t, 0x11d>;
+
+static BitMatrix randomBits(std::mt19937_64& rd, size_t rows, size_t cols) {
+    BitMatrix res(rows, cols);
+
+    for (size_t i = 0; i < rows; ++i)
+        for (size_t j = 0; j < cols; ++j)
+            res.set(i, j, rd() & 1);
+
+    return res;
+}
+
+static BitMatrix naiveMultiply(const BitMatrix& a, const BitMatrix& b) {
+    BitMatrix c(a.rows(), b.columns());
+
+    for (size_t i = 0; i < a.rows(); ++i) {
+        for (size_t j = 0; j < b.columns(); ++j) {
+            bool bit = false;
+
+            for (size_t k = 0; k < a.columns(); ++k)
+                bit ^= a(i, k) && b(k, j);
+
+            c.set(i, j, bit);
+        }
+    }
+
+    return c;
+}
+
+// Rank by plain Gaussian elimination, one bit at a time
+static size_t naiveRank(BitMatrix a) {
+    size_t r = 0;
+
+    for (size_t j = 0; j < a.columns() && r < a.rows(); ++j) {
+        size_t p = r;
+
+        while (p < a.rows() && !a(p, j))
+            ++p;
+
+        if (p == a.rows())
+            continue;
+
+        for (size_t k = 0; k < a.columns(); ++k) {
+            bool t = a(p, k);
+            a.set(p, k, a(r, k));
+            a.set(r, k, t);
+        }
+
+        for (size_t i = r + 1; i < a.rows(); ++i)
+            if (a(i, j))
+                for (size_t k = 0; k < a.columns(); ++k)
+                    a.set(i, k, a(i, k) ^ a(r, k));
+
+        ++r;
+    }
+
+    return r;
+}
+
+// Bit matrices are compared in double parentheses, the stream operator of the elements is too greedy
+TEST_CASE("Bit matrix product", "[BitMatrix]") {
+    std::mt19937_64 rd;
+
+    for (auto [m, l, n] : {std::tuple<size_t, size_t, size_t>{1, 1, 1}, {7, 13, 5}, {64, 64, 64}, {65, 130, 70},
+                           {100, 200, 600}, {3, 513, 1}}) {
+        BitMatrix a = randomBits(rd, m, l), b = randomBits(rd, l, n);
+
+        REQUIRE((a * b == naiveMultiply(a, b)));
+    }
+
+    BitMatrix a = randomBits(rd, 90, 90);
+
+    REQUIRE((a * BitMatrix::identity(90) == a));
+    REQUIRE((BitMatrix::identity(90) * a == a));
+    REQUIRE((a + a == BitMatrix(90, 90)));
+    REQUIRE_THROWS_AS(a * BitMatrix(89, 3), std::invalid_argument);
+}
+
+TEST_CASE("Bit matrix transpose", "[BitMatrix]") {
+    std::mt19937_64 rd;
+
+    for (auto [m, n] : {std::pair<size_t, size_t>{1, 1}, {64, 64}, {5, 200}, {130, 67}, {257, 129}}) {
+        BitMatrix a = randomBits(rd, m, n);
+        BitMatrix t = a.transpose();
+
+        REQUIRE(t.rows() == n);
+        REQUIRE(t.columns() == m);
+
+        for (size_t i = 0; i < m; ++i)
+            for (size_t j = 0; j < n; ++j)
+                REQUIRE(a(i, j) == t(j, i));
+
+        REQUIRE((t.transpose() == a));
+    }
+}
+
+TEST_CASE("Bit matrix elimination", "[BitMatrix]") {
+    std::mt19937_64 rd;
+
+    SECTION("Rank") {
+        for (auto [m, n] : {std::pair<size_t, size_t>{1, 1}, {10, 30}, {30, 10}, {100, 100}, {150, 300}}) {
+            BitMatrix a = randomBits(rd, m, n);
+
+            REQUIRE(a.rank() == naiveRank(a));
+        }
+
+        // Rank deficient products
+        BitMatrix a = randomBits(rd, 120, 37) * randomBits(rd, 37, 140);
+
+        REQUIRE(a.rank() <= 37);
+        REQUIRE(a.rank() == naiveRank(a));
+        REQUIRE(BitMatrix(20, 20).rank() == 0);
+    }
+
+    SECTION("Reduced echelon form") {
+        BitMatrix a = randomBits(rd, 60, 25) * randomBits(rd, 25, 90);
+        BitMatrix e = a;
+        size_t rank = e.echelonize();
+
+        REQUIRE(rank == naiveRank(a));
+
+        // Every pivot column is a unit column, the rows below the rank are zero
+        size_t lead = 0;
+
+        for (size_t i = 0; i < rank; ++i) {
+            while (!e(i, lead))
+                ++lead;
+
+            for (size_t k = 0; k < e.rows(); ++k)
+                REQUIRE(e(k, lead) == (k == i));
+        }
+
+        for (size_t i = rank; i < e.rows(); ++i)
+            for (size_t j = 0; j < e.columns(); ++j)
+                REQUIRE_FALSE(e(i, j));
+
+        // The row space is kept
+        BitMatrix both(120, 90);
+
+        for (size_t i = 0; i < 60; ++i) {
+            for (size_t j = 0; j < 90; ++j) {
+                both.set(i, j, a(i, j));
+                both.set(60 + i, j, e(i, j));
+            }
+        }
+
+        REQUIRE(both.rank() == rank);
+    }
+
+    SECTION("Inverse") {
+        for (size_t n : {1, 8, 63, 64, 65, 200}) {
+            BitMatrix a = randomBits(rd, n, n);
+
+            while (a.rank() < n)
+                a = randomBits(rd, n, n);
+
+            BitMatrix inv = a.inverse();
+
+            REQUIRE((a * inv == BitMatrix::identity(n)));
+            REQUIRE((inv * a == BitMatrix::identity(n)));
+        }
+
+        REQUIRE_THROWS_AS(BitMatrix(5, 5).inverse(), std::invalid_argument);
+        REQUIRE_THROWS_AS(BitMatrix(5, 6).inverse(), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Bit matrix expansion", "[BitMatrix]") {
+    std::mt19937 rd;
+    const size_t rows = 5, inner = 7, cols = 3;
+    std::vector<Elem> a(rows * inner), b(inner * cols), c(rows * cols, Elem(0));
+
+    for (auto& e : a)
+        e = Elem(static_cast<uint16_t>(rd() % 256));
+
+    for (auto& e : b)
+        e = Elem(static_cast<uint16_t>(rd() % 256));
+
+    for (size_t i = 0; i < rows; ++i)
+        for (size_t j = 0; j < cols; ++j)
+            for (size_t k = 0; k < inner; ++k)
+                c[i * cols + j] += a[i * inner + k] * b[k * cols + j];
+
+    BitMatrix ea = BitMatrix::expand(a, rows, inner);
+
+    REQUIRE(ea.rows() == rows * 8);
+    REQUIRE(ea.columns() == inner * 8);
+    REQUIRE((ea * BitMatrix::expand(b, inner, cols) == BitMatrix::expand(c, rows, cols)));
+    REQUIRE((ea.compress<Elem>() == a));
+
+    // A bit vector of elements is multiplied like the elements
+    BitMatrix x(inner * 8, 1);
+
+    for (size_t k = 0; k < inner; ++k)
+        for (size_t s = 0; s < 8; ++s)
+            x.set(k * 8 + s, 0, (b[k * cols].val() >> s) & 1);
+
+    BitMatrix y = ea * x;
+
+    for (size_t i = 0; i < rows; ++i)
+        for (size_t s = 0; s < 8; ++s)
+            REQUIRE(y(i * 8 + s, 0) == bool((c[i * cols].val() >> s) & 1));
+
+    BitMatrix broken = ea;
+    broken.set(3, 1, !broken(3, 1));
+
+    REQUIRE_THROWS_AS(broken.compress<Elem>(), std::invalid_argument);
+    REQUIRE_THROWS_AS(BitMatrix(9, 8).compress<Elem>(), std::invalid_argument);
+}
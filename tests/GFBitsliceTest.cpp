@@ -0,0 +1,68 @@
+#include <vector>
+
+#include "catch.hpp"
+#include "GFBitslice.hpp"
+#include "GFTPlinalg.hpp"
+
+using Pol = GFlinalg::BasicBinPolynomial<uint16_t, 0x11d>;
+
+TEMPLATE_TEST_CASE("Bitsliced GF(2^8) arithmetic", "[BitsliceGF256]", (GFlinalg::BitsliceGF256<0x11d, 64>),
+                   (GFlinalg::BitsliceGF256<0x11d, 128>), (GFlinalg::BitsliceGF256<0x11d, 256>)) {
+    // every pair of field elements, the size is not a multiple of the lane count to cover the tail
+    std::vector<uint8_t> a, b;
+    for (size_t i = 0; i < 256; ++i) {
+        for (size_t j = 0; j < 256; ++j) {
+            a.push_back(static_cast<uint8_t>(i));
+            b.push_back(static_cast<uint8_t>(j));
+        }
+    }
+    a.resize(a.size() - 17);
+    b.resize(b.size() - 17);
+
+    std::vector<uint8_t> out(a.size());
+
+    SECTION("Transposition") {
+        typename TestType::Slice s = TestType::load(a.data() + 512);
+        TestType::store(s, out.data());
+        REQUIRE(std::equal(out.begin(), out.begin() + TestType::lanes, a.begin() + 512));
+    }
+    SECTION("Multiplication") {
+        TestType::mul(a.data(), b.data(), out.data(), a.size());
+        for (size_t i = 0; i < a.size(); ++i)
+            REQUIRE(out[i] == (Pol(a[i]) * Pol(b[i])).val());
+    }
+    SECTION("Squaring") {
+        TestType::square(b.data(), out.data(), 256);
+        for (size_t i = 0; i < 256; ++i)
+            REQUIRE(out[i] == (Pol(b[i]) * Pol(b[i])).val());
+    }
+    SECTION("Inversion") {
+        TestType::inverse(b.data(), out.data(), 256);
+        REQUIRE(out[0] == 0);
+        for (size_t i = 1; i < 256; ++i)
+            REQUIRE((Pol(out[i]) * Pol(b[i])).val() == 1);
+
+        // Planes in the polynomial basis go through the basis change maps
+        std::vector<uint8_t> planes(TestType::lanes);
+        TestType::store(TestType::inverse(TestType::load(b.data() + 256 - TestType::lanes)), planes.data());
+        REQUIRE(std::equal(planes.begin(), planes.end(), out.begin() + 256 - TestType::lanes));
+    }
+}
+
+TEST_CASE("Bitsliced inversion for an irreducible modulus", "[BitsliceGF256]") {
+    using AesPol = GFlinalg::BasicBinPolynomial<uint16_t, 0x11b>;
+
+    std::vector<uint8_t> a(256), out(256);
+    for (size_t i = 0; i < 256; ++i)
+        a[i] = static_cast<uint8_t>(i);
+
+    GFlinalg::BitsliceGF256<0x11b>::inverse(a.data(), out.data(), a.size());
+
+    REQUIRE(out[1] == 1);
+    REQUIRE(out[0x53] == 0xca);
+    for (size_t i = 1; i < 256; ++i)
+        REQUIRE((AesPol(out[i]) * AesPol(a[i])).val() == 1);
+
+    // x^8 + x^2 + 1 = (x^4 + x + 1)^2 has no inverses to compute
+    REQUIRE_THROWS_AS(GFlinalg::BitsliceGF256<0x105>::inverse(a.data(), out.data(), a.size()), std::invalid_argument);
+}
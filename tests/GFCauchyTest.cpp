@@ -0,0 +1,187 @@
+#include <random>
+#include <vector>
+
+#include "catch.hpp"
+#include "GFCauchy.hpp"
+
+using Code8 = GFlinalg::CauchyCode<uint16_t, 0x11d>;
+using Code4 = GFlinalg::CauchyCode<uint8_t, 0x13>;
+
+static std::vector<std::vector<uint8_t>> randomDevices(std::mt19937& rd, size_t count, size_t size) {
+    std::vector<std::vector<uint8_t>> res(count, std::vector<uint8_t>(size));
+
+    for (auto& d : res)
+        for (auto& b : d)
+            b = static_cast<uint8_t>(rd());
+
+    return res;
+}
+
+static std::vector<uint8_t*> pointers(std::vector<std::vector<uint8_t>>& devices) {
+    std::vector<uint8_t*> res;
+
+    for (auto& d : devices)
+        res.push_back(d.data());
+
+    return res;
+}
+
+// Element of device d in a strip: bit t comes from packet t, at byte p and bit b of the packets
+template <class Code>
+static typename Code::Polynomial element(const Code& code, const std::vector<uint8_t>& device, size_t strip, size_t p, size_t b) {
+    unsigned v = 0;
+
+    for (size_t t = 0; t < code.wordSize(); ++t)
+        v |= ((device[strip * code.stripSize() + t * code.packetSize() + p] >> b) & 1U) << t;
+
+    return typename Code::Polynomial(static_cast<uint8_t>(v));
+}
+
+template <class Code>
+static void checkEncoding(const Code& code, const std::vector<std::vector<uint8_t>>& devices, size_t strips) {
+    const size_t k = code.dataDevices(), m = code.codingDevices();
+
+    for (size_t s = 0; s < strips; ++s) {
+        for (size_t p = 0; p < code.packetSize(); ++p) {
+            for (size_t b = 0; b < 8; ++b) {
+                for (size_t i = 0; i < m; ++i) {
+                    typename Code::Polynomial sum(0);
+
+                    for (size_t j = 0; j < k; ++j)
+                        sum += code.matrix()[i * k + j] * element(code, devices[j], s, p, b);
+
+                    REQUIRE(element(code, devices[k + i], s, p, b) == sum);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Cauchy coding matrix", "[Cauchy]") {
+    Code8 code(6, 4, 16);
+
+    for (size_t j = 0; j < 6; ++j)
+        REQUIRE(code.matrix()[j] == Code8::Polynomial(1));
+
+    REQUIRE(code.bitMatrix().rows() == 4 * 8);
+    REQUIRE(code.bitMatrix().columns() == 6 * 8);
+    REQUIRE((code.bitMatrix().compress<Code8::Polynomial>() == code.matrix()));
+
+    // Every 2 x 2 submatrix is nonsingular
+    for (size_t i = 0; i < 4; ++i)
+        for (size_t r = i + 1; r < 4; ++r)
+            for (size_t j = 0; j < 6; ++j)
+                for (size_t c = j + 1; c < 6; ++c)
+                    REQUIRE(code.matrix()[i * 6 + j] * code.matrix()[r * 6 + c] != code.matrix()[i * 6 + c] * code.matrix()[r * 6 + j]);
+
+    REQUIRE_THROWS_AS(Code4(10, 7, 16), std::invalid_argument);
+    REQUIRE_THROWS_AS(Code8(0, 2, 16), std::invalid_argument);
+    REQUIRE_THROWS_AS(Code8(2, 2, 0), std::invalid_argument);
+}
+
+TEST_CASE("XOR schedule", "[Cauchy]") {
+    std::mt19937 rd;
+    GFlinalg::BitMatrix a(20, 30);
+
+    for (size_t i = 0; i < 20; ++i)
+        for (size_t j = 0; j < 30; ++j)
+            a.set(i, j, rd() % 3 == 0);
+
+    GFlinalg::op::XorSchedule plain(a, false), shared(a, true);
+
+    REQUIRE(plain.temporaries() == 0);
+    REQUIRE(shared.xors() < plain.xors());
+
+    // Bit i of a byte is one independent evaluation
+    auto in = randomDevices(rd, 30, 8);
+    std::vector<std::vector<uint8_t>> out1(20, std::vector<uint8_t>(8)), out2 = out1;
+    std::vector<const uint8_t*> inPtr;
+    std::vector<uint8_t> temp(shared.temporaries() * 8);
+
+    for (auto& d : in)
+        inPtr.push_back(d.data());
+
+    plain.run(inPtr.data(), pointers(out1).data(), nullptr, 8);
+    shared.run(inPtr.data(), pointers(out2).data(), temp.data(), 8);
+
+    REQUIRE(out1 == out2);
+
+    for (size_t i = 0; i < 20; ++i) {
+        for (size_t p = 0; p < 8; ++p) {
+            uint8_t sum = 0;
+
+            for (size_t j = 0; j < 30; ++j)
+                if (a(i, j))
+                    sum ^= in[j][p];
+
+            REQUIRE(out1[i][p] == sum);
+        }
+    }
+}
+
+TEST_CASE("Cauchy encoding", "[Cauchy]") {
+    std::mt19937 rd;
+
+    SECTION("GF(2^8)") {
+        Code8 code(5, 3, 24);
+        auto devices = randomDevices(rd, 8, 3 * code.stripSize());
+        auto ptr = pointers(devices);
+
+        code.encode(ptr.data(), ptr.data() + 5, devices[0].size());
+        checkEncoding(code, devices, 3);
+
+        Code8 plain(5, 3, 24, false);
+        auto copy = devices;
+        auto copyPtr = pointers(copy);
+
+        plain.encode(copyPtr.data(), copyPtr.data() + 5, copy[0].size());
+
+        REQUIRE(copy == devices);
+        REQUIRE(code.schedule().xors() < plain.schedule().xors());
+        REQUIRE_THROWS_AS(code.encode(ptr.data(), ptr.data() + 5, code.stripSize() + 1), std::invalid_argument);
+    }
+
+    SECTION("GF(2^4)") {
+        Code4 code(10, 6, 8);
+        auto devices = randomDevices(rd, 16, 2 * code.stripSize());
+        auto ptr = pointers(devices);
+
+        code.encode(ptr.data(), ptr.data() + 10, devices[0].size());
+        checkEncoding(code, devices, 2);
+    }
+}
+
+TEST_CASE("Cauchy decoding", "[Cauchy]") {
+    std::mt19937 rd;
+    const size_t k = 5, m = 3, n = k + m;
+    Code8 code(k, m, 16);
+    auto devices = randomDevices(rd, n, 2 * code.stripSize());
+    auto ptr = pointers(devices);
+
+    code.encode(ptr.data(), ptr.data() + k, devices[0].size());
+
+    // Every set of erased devices, more than m are refused
+    for (unsigned mask = 0; mask < (1U << n); ++mask) {
+        std::vector<size_t> erased;
+
+        for (size_t d = 0; d < n; ++d)
+            if ((mask >> d) & 1)
+                erased.push_back(d);
+
+        auto damaged = devices;
+        auto damagedPtr = pointers(damaged);
+
+        for (size_t d : erased)
+            std::fill(damaged[d].begin(), damaged[d].end(), 0xA5);
+
+        bool ok = code.decode(damagedPtr.data(), erased, damaged[0].size());
+
+        REQUIRE(ok == (erased.size() <= m));
+
+        if (ok)
+            REQUIRE(damaged == devices);
+    }
+
+    REQUIRE_THROWS_AS(code.decode(ptr.data(), {1, 1}, devices[0].size()), std::invalid_argument);
+    REQUIRE_THROWS_AS(code.decode(ptr.data(), {n}, devices[0].size()), std::invalid_argument);
+}
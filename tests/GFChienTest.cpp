@@ -0,0 +1,117 @@
+#include <random>
+#include <set>
+#include <vector>
+
+#include "catch.hpp"
+#include "GFChien.hpp"
+#include "GFSPlinalg.hpp"
+#include "GFTPlinalg.hpp"
+
+using GFlinalg::ChienSearch;
+
+TEST_CASE("Planar 16-bit region map", "[Chien]") {
+    const uint64_t low = 0x1b, n = 13;
+    const uint16_t c = 0x1234 & 0x1fff;
+
+    std::array<uint16_t, 16> columns{};
+
+    for (size_t i = 0; i < n; ++i)
+        columns[i] = static_cast<uint16_t>(GFlinalg::op::modulus::mulMod(c, uint64_t(1) << i, low, n));
+
+    auto map = GFlinalg::op::NibbleMap16::fromColumns(columns);
+
+    std::mt19937 rd;
+    std::vector<uint8_t> lo(37), hi(37);
+
+    for (size_t i = 0; i < lo.size(); ++i) {
+        lo[i] = static_cast<uint8_t>(rd());
+        hi[i] = static_cast<uint8_t>(rd() & 0x1f);
+    }
+
+    auto inLo = lo, inHi = hi;
+
+    GFlinalg::op::applyNibbleMap16(map, lo.data(), hi.data(), lo.data(), hi.data(), lo.size());
+
+    for (size_t i = 0; i < lo.size(); ++i)
+        REQUIRE((lo[i] | (hi[i] << 8)) == GFlinalg::op::modulus::mulMod(c, inLo[i] | (inHi[i] << 8), low, n));
+}
+
+/**
+ * Locator prod (1 + a^(-e) x) with the roots a^e, and the exponents e.
+ */
+template <class Elem>
+static std::vector<Elem> locatorOf(const Elem& one, const std::vector<size_t>& exponents) {
+    Elem x = one;
+    x.val() = 2;
+
+    std::vector<Elem> res{one};
+
+    for (size_t e : exponents) {
+        Elem root = one / GFlinalg::op::pow(x, e);
+        Elem zero = one;
+        zero.val() = 0;
+
+        std::vector<Elem> next(res.size() + 1, zero);
+
+        for (size_t i = 0; i < res.size(); ++i) {
+            next[i] += res[i];
+            next[i + 1] += res[i] * root;
+        }
+
+        res = std::move(next);
+    }
+
+    return res;
+}
+
+TEMPLATE_TEST_CASE("Chien search finds the roots", "[Chien]", (GFlinalg::BasicBinPolynomial<uint16_t, 0x11d>),
+                   (GFlinalg::BasicBinPolynomial<uint16_t, 0x201b>), GFlinalg::BasicGFElem<uint32_t>) {
+    TestType one = [] {
+        if constexpr (std::is_same_v<TestType, GFlinalg::BasicGFElem<uint32_t>>)
+            return TestType(1, 0x4443);
+        else
+            return TestType(1);
+    }();
+
+    const ChienSearch search = ChienSearch::forField(one, 20);
+    const size_t order = search.order();
+
+    std::mt19937 rd;
+    std::vector<std::vector<size_t>> expected;
+    std::vector<std::vector<TestType>> locators;
+
+    for (size_t degree : {1, 2, 7, 20, 0}) {
+        std::set<size_t> roots;
+
+        while (roots.size() < degree)
+            roots.insert(rd() % order);
+
+        std::vector<size_t> exponents(roots.begin(), roots.end());
+        auto locator = locatorOf(one, exponents);
+
+        REQUIRE(search.roots(locator) == exponents);
+
+        // A wrapping range keeps the order of the points
+        size_t first = order - 100;
+        std::vector<size_t> wrapped;
+
+        for (size_t e : exponents)
+            if (e >= first)
+                wrapped.push_back(e);
+
+        for (size_t e : exponents)
+            if (e < 200 - 100)
+                wrapped.push_back(e);
+
+        REQUIRE(search.roots(locator, first, 200) == wrapped);
+
+        expected.push_back(exponents);
+        locators.push_back(locator);
+    }
+
+    REQUIRE(search.rootsBatch(locators, 0, order) == expected);
+
+    locators.push_back(locatorOf(one, std::vector<size_t>(21, 1)));
+    REQUIRE_THROWS_AS(search.rootsBatch(locators, 0, order), std::invalid_argument);
+    REQUIRE_THROWS_AS(ChienSearch(0x11b, 4), std::invalid_argument);
+}
@@ -0,0 +1,61 @@
+#include "catch.hpp"
+#include "GFComposite.hpp"
+
+using Base = GFlinalg::BasicBinPolynomial<uint8_t, 19>;
+using PowBase = GFlinalg::PowBinPolynomial<uint8_t, 19>;
+template<>
+const GFlinalg::LUTArrPair<uint8_t, 19> PowBase::alphaToIndex{};
+
+using Binary = GFlinalg::BasicBinPolynomial<uint16_t, 0x11d>;
+
+TEMPLATE_TEST_CASE("Composite field arithmetic", "[CompositeGFElem]", (GFlinalg::CompositeGFElem<Base, 8>),
+                   (GFlinalg::CompositeGFElem<PowBase, 8>)) {
+    SECTION("Data access") {
+        TestType a(0x5c);
+        REQUIRE(a.val() == 0x5c);
+        REQUIRE(a.high().val() == 5);
+        REQUIRE(a.low().val() == 0xc);
+        REQUIRE(TestType::gfDegree() == 8);
+        REQUIRE(TestType::gfOrder() == 256);
+    }
+    SECTION("Inversion") {
+        REQUIRE(TestType(0).getInverse() == TestType(0));
+        for (size_t a = 1; a < 256; ++a) {
+            TestType e(static_cast<uint8_t>(a));
+            REQUIRE(e * e.getInverse() == TestType(1));
+            REQUIRE(TestType(1) / e == e.getInverse());
+        }
+    }
+    SECTION("Isomorphism") {
+        const auto& iso = GFlinalg::CompositeIsomorphism<TestType, 0x11d>::get();
+
+        for (uint16_t a = 0; a < 256; ++a) {
+            REQUIRE(iso.fromComposite(iso.toComposite(Binary(a))) == Binary(a));
+            for (uint16_t b = 0; b < 256; b += 7) {
+                REQUIRE(iso.toComposite(Binary(a)) + iso.toComposite(Binary(b)) == iso.toComposite(Binary(a) + Binary(b)));
+                REQUIRE(iso.toComposite(Binary(a)) * iso.toComposite(Binary(b)) == iso.toComposite(Binary(a) * Binary(b)));
+            }
+        }
+    }
+}
+
+TEST_CASE("Composite field bulk conversion", "[CompositeIsomorphism]") {
+    using Composite = GFlinalg::CompositeGFElem<Base, 8>;
+    GFlinalg::CompositeIsomorphism<Composite, 0x11b> iso;
+
+    std::vector<uint8_t> in(300), out(300), back(300);
+    for (size_t i = 0; i < in.size(); ++i)
+        in[i] = static_cast<uint8_t>(i * 37 + 11);
+
+    iso.toComposite(in.data(), out.data(), in.size());
+    iso.fromComposite(out.data(), back.data(), out.size());
+
+    REQUIRE(back == in);
+    for (size_t i = 0; i < in.size(); ++i)
+        REQUIRE(out[i] == iso.toComposite(GFlinalg::BasicBinPolynomial<uint16_t, 0x11b>(in[i])).val());
+
+    // x^8 + 1 = (x + 1)^8 has no root besides 1
+    REQUIRE_THROWS_AS((GFlinalg::CompositeIsomorphism<Composite, 0x101>()), std::invalid_argument);
+    // x^8 + x^2 + 1 = (x^4 + x + 1)^2 has roots, but they lie in GF(2^4)
+    REQUIRE_THROWS_AS((GFlinalg::CompositeIsomorphism<Composite, 0x105>()), std::invalid_argument);
+}
@@ -0,0 +1,116 @@
+#include <random>
+#include <string>
+#include <vector>
+
+#include "catch.hpp"
+#include "GFCrc.hpp"
+
+using GFlinalg::CrcMethod;
+
+static const std::string check = "123456789";
+
+/**
+ * Bit-at-a-time CRC of the usual parametrised model.
+ */
+static uint64_t naiveCrc(const uint8_t* data, size_t size, size_t width, uint64_t low, bool reflected, uint64_t init,
+                         uint64_t xorOut) {
+    uint64_t mask = GFlinalg::op::modulus::lowMask(width);
+    uint64_t reg = init & mask;
+
+    for (size_t i = 0; i < size; ++i) {
+        for (size_t j = 0; j < 8; ++j) {
+            size_t bit = reflected ? j : 7 - j;
+            uint64_t top = ((reg >> (width - 1)) ^ (data[i] >> bit)) & 1;
+
+            reg = ((reg << 1) & mask) ^ (low & (uint64_t(0) - top));
+        }
+    }
+
+    if (reflected) {
+        uint64_t r = 0;
+
+        for (size_t j = 0; j < width; ++j)
+            r |= ((reg >> j) & 1) << (width - 1 - j);
+
+        reg = r;
+    }
+
+    return reg ^ (xorOut & mask);
+}
+
+TEST_CASE("CRC check values", "[CRC]") {
+    using Crc32 = GFlinalg::CrcEngine<uint64_t, 0x104C11DB7>;
+    using Crc16 = GFlinalg::CrcEngine<uint32_t, 0x11021>;
+
+    REQUIRE(Crc32(true, 0xFFFFFFFF, 0xFFFFFFFF).checksum(check) == 0xCBF43926);
+    REQUIRE(Crc32(false, 0xFFFFFFFF, 0xFFFFFFFF).checksum(check) == 0xFC891918);
+    REQUIRE(GFlinalg::CrcEngine<uint64_t, 0x11EDC6F41>(true, 0xFFFFFFFF, 0xFFFFFFFF).checksum(check) == 0xE3069283);
+    REQUIRE(Crc16(false, 0xFFFF).checksum(check) == 0x29B1);
+    REQUIRE(GFlinalg::CrcEngine<uint32_t, 0x18005>(true).checksum(check) == 0xBB3D);
+
+    // CRC-3/GSM and CRC-4/G-704
+    REQUIRE(GFlinalg::CrcEngine<uint8_t, 0xB>(false, 0, 0x7).checksum(check) == 0x4);
+    REQUIRE(GFlinalg::CrcEngine<uint8_t, 0x13>(true).checksum(check) == 0x7);
+
+    // CRC-64/XZ
+    using Crc64 = GFlinalg::CrcEngine<unsigned __int128, (static_cast<unsigned __int128>(1) << 64) | 0x42F0E1EBA9EA3693ULL>;
+    REQUIRE(Crc64(true, ~uint64_t(0), ~uint64_t(0)).checksum(check) == 0x995DC9BBDF1939FAULL);
+
+    REQUIRE(Crc32(true, 0xFFFFFFFF, 0xFFFFFFFF).empty() == 0);
+    REQUIRE(Crc16(false, 0xFFFF).empty() == 0xFFFF);
+}
+
+TEMPLATE_TEST_CASE_SIG("CRC kernels agree with the bitwise definition", "[CRC]", ((uint64_t low, size_t width), low, width),
+                       (0x4C11DB7, 32), (0x1021, 16), (0xD, 4), (0x1B, 64)) {
+    using Engine = GFlinalg::CrcEngine<unsigned __int128, (static_cast<unsigned __int128>(1) << width) | low>;
+
+    static_assert(Engine::width == width);
+
+    std::mt19937_64 rd;
+    std::vector<uint8_t> data(3000);
+
+    for (auto& b : data)
+        b = static_cast<uint8_t>(rd());
+
+    for (bool reflected : {true, false}) {
+        const uint64_t init = rd(), xorOut = rd();
+        const Engine crc(reflected, init, xorOut);
+
+        SECTION(std::string("Methods ") + (reflected ? "reflected" : "normal")) {
+            for (size_t size : {0, 1, 7, 8, 15, 16, 17, 63, 64, 255, 256, 257, 320, 1000, 3000}) {
+                uint64_t expected = naiveCrc(data.data(), size, width, low, reflected, init, xorOut);
+
+                REQUIRE(crc.checksum(data.data(), size, CrcMethod::Slicing8) == expected);
+                REQUIRE(crc.checksum(data.data(), size, CrcMethod::Slicing16) == expected);
+                REQUIRE(crc.checksum(data.data(), size, CrcMethod::Clmul) == expected);
+                REQUIRE(crc.checksum(data.data(), size) == expected);
+            }
+        }
+        SECTION(std::string("Update and combine ") + (reflected ? "reflected" : "normal")) {
+            const uint64_t whole = crc.checksum(data.data(), data.size());
+
+            for (size_t split : {0, 1, 100, 1024, 2999, 3000}) {
+                uint64_t a = crc.checksum(data.data(), split);
+                uint64_t b = crc.checksum(data.data() + split, data.size() - split);
+
+                REQUIRE(crc.update(a, data.data() + split, data.size() - split) == whole);
+                REQUIRE(crc.combine(a, b, data.size() - split) == whole);
+            }
+        }
+    }
+}
+
+TEST_CASE("Parallel CRC", "[CRC]") {
+    GFlinalg::CrcEngine<uint64_t, 0x104C11DB7> crc(true, 0xFFFFFFFF, 0xFFFFFFFF);
+
+    std::mt19937_64 rd;
+    std::vector<uint8_t> data((1 << 20) + 12345);
+
+    for (auto& b : data)
+        b = static_cast<uint8_t>(rd());
+
+    const uint64_t whole = crc.checksum(data);
+
+    for (unsigned threads : {1, 2, 3, 7})
+        REQUIRE(crc.checksumParallel(data.data(), data.size(), threads) == whole);
+}
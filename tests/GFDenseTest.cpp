@@ -0,0 +1,73 @@
+#include <random>
+#include <vector>
+
+#include "catch.hpp"
+#include "GFDense.hpp"
+
+using Elem = GFlinalg::BasicBinPolynomial<uint16_t, 0x11d>;
+using Elem4 = GFlinalg::BasicBinPolynomial<uint8_t, 0x13>;
+
+template <class E>
+static std::vector<E> randomElements(std::mt19937& rd, size_t count, unsigned order) {
+    std::vector<E> res;
+
+    for (size_t i = 0; i < count; ++i)
+        res.push_back(E(static_cast<uint8_t>(rd() % order)));
+
+    return res;
+}
+
+template <class E>
+static std::vector<E> naiveMultiply(const std::vector<E>& a, const std::vector<E>& b, size_t m, size_t k, size_t n) {
+    std::vector<E> c(m * n, E(0));
+
+    for (size_t i = 0; i < m; ++i)
+        for (size_t j = 0; j < n; ++j)
+            for (size_t l = 0; l < k; ++l)
+                c[i * n + j] += a[i * k + l] * b[l * n + j];
+
+    return c;
+}
+
+// Vectors of elements and matrices are compared in double parentheses, the stream operator of the elements is too greedy
+TEST_CASE("Dense matrix", "[Dense]") {
+    std::mt19937 rd;
+
+    SECTION("Construction") {
+        auto data = randomElements<Elem>(rd, 6 * 7, 256);
+        auto a = GFlinalg::DenseMatrix<Elem>::fromElements(data, 6, 7);
+
+        REQUIRE(a.rows() == 6);
+        REQUIRE(a.columns() == 7);
+        REQUIRE((a.toElements() == data));
+        REQUIRE(a(2, 3) == data[2 * 7 + 3]);
+
+        a.set(2, 3, Elem(0x55));
+
+        REQUIRE(a(2, 3) == Elem(0x55));
+        REQUIRE(((a + a) == GFlinalg::DenseMatrix<Elem>(6, 7)));
+        REQUIRE_THROWS_AS(GFlinalg::DenseMatrix<Elem>::fromElements(data, 7, 7), std::invalid_argument);
+    }
+
+    SECTION("Product over GF(2^8)") {
+        // Larger than one block of columns and of depth
+        for (auto [m, k, n] : {std::tuple<size_t, size_t, size_t>{1, 1, 1}, {9, 17, 5}, {20, 300, 1100}}) {
+            auto a = randomElements<Elem>(rd, m * k, 256), b = randomElements<Elem>(rd, k * n, 256);
+            auto c = GFlinalg::DenseMatrix<Elem>::fromElements(a, m, k) * GFlinalg::DenseMatrix<Elem>::fromElements(b, k, n);
+
+            REQUIRE((c.toElements() == naiveMultiply(a, b, m, k, n)));
+        }
+
+        auto a = GFlinalg::DenseMatrix<Elem>::fromElements(randomElements<Elem>(rd, 30 * 30, 256), 30, 30);
+
+        REQUIRE((a * GFlinalg::DenseMatrix<Elem>::identity(30) == a));
+        REQUIRE_THROWS_AS(a * GFlinalg::DenseMatrix<Elem>(29, 2), std::invalid_argument);
+    }
+
+    SECTION("Product over GF(2^4)") {
+        auto a = randomElements<Elem4>(rd, 13 * 8, 16), b = randomElements<Elem4>(rd, 8 * 11, 16);
+        auto c = GFlinalg::DenseMatrix<Elem4>::fromElements(a, 13, 8) * GFlinalg::DenseMatrix<Elem4>::fromElements(b, 8, 11);
+
+        REQUIRE((c.toElements() == naiveMultiply(a, b, 13, 8, 11)));
+    }
+}
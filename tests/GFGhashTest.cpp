@@ -0,0 +1,148 @@
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "catch.hpp"
+#include "GFGhash.hpp"
+
+using GFlinalg::GcmBinPolynomial;
+using GFlinalg::GhashHasher;
+
+static std::vector<uint8_t> fromHex(const std::string& hex) {
+    std::vector<uint8_t> res;
+
+    for (size_t i = 0; i < hex.size(); i += 2)
+        res.push_back(static_cast<uint8_t>(std::stoul(hex.substr(i, 2), nullptr, 16)));
+
+    return res;
+}
+
+static GcmBinPolynomial elem(const std::string& hex) {
+    return GcmBinPolynomial::fromBytes(fromHex(hex).data());
+}
+
+/**
+ * Multiplication as specified for GCM: bit by bit, with <tt>R = 11100001 || 0^120</tt>.
+ */
+static GcmBinPolynomial naiveMul(const GcmBinPolynomial& x, const GcmBinPolynomial& y) {
+    uint64_t zHi = 0, zLo = 0;
+    uint64_t vHi = y.val()[0], vLo = y.val()[1];
+
+    for (size_t i = 0; i < 128; ++i) {
+        uint64_t word = i < 64 ? x.val()[0] : x.val()[1];
+
+        if ((word >> (63 - i % 64)) & 1) {
+            zHi ^= vHi;
+            zLo ^= vLo;
+        }
+
+        bool carry = vLo & 1;
+
+        vLo = (vLo >> 1) | (vHi << 63);
+        vHi >>= 1;
+
+        if (carry)
+            vHi ^= 0xE100000000000000ULL;
+    }
+
+    return GcmBinPolynomial(zHi, zLo);
+}
+
+TEST_CASE("GF(2^128) in the GCM convention", "[GHASH]") {
+    std::mt19937_64 rd;
+    const GcmBinPolynomial one = GcmBinPolynomial::one();
+
+    SECTION("Test vector") {
+        // GCM test case 2: X1 = C1 * H
+        auto h = elem("66e94bd4ef8a2c3b884cfa59ca342b2e");
+        auto c = elem("0388dace60b6a392f328c2b971b2fe78");
+
+        REQUIRE(c * h == elem("5e2ec746917062882c85b0685353deb7"));
+
+        std::ostringstream out;
+        out << c * h;
+        REQUIRE(out.str() == "5e2ec746917062882c85b0685353deb7");
+    }
+    SECTION("Field axioms") {
+        for (size_t i = 0; i < 1000; ++i) {
+            GcmBinPolynomial a(rd(), rd()), b(rd(), rd()), c(rd(), rd());
+
+            REQUIRE(a * b == naiveMul(a, b));
+            REQUIRE(a * b == b * a);
+            REQUIRE(a * (b + c) == a * b + a * c);
+            REQUIRE(a * one == a);
+        }
+
+        // x^127 * x = x^128 = x^7 + x^2 + x + 1
+        REQUIRE(GcmBinPolynomial(0, 1) * GcmBinPolynomial(uint64_t(1) << 62, 0) == GcmBinPolynomial(0xE100000000000000ULL, 0));
+        REQUIRE(GcmBinPolynomial(0, 1).degree() == 127);
+        REQUIRE(one.degree() == 0);
+    }
+    SECTION("Inversion") {
+        for (size_t i = 0; i < 50; ++i) {
+            GcmBinPolynomial a(rd(), rd());
+
+            REQUIRE(a * a.getInverse() == one);
+            REQUIRE(a / a == one);
+        }
+
+        REQUIRE(GcmBinPolynomial().getInverse() == GcmBinPolynomial());
+        REQUIRE_THROWS_AS(one / GcmBinPolynomial(), std::out_of_range);
+    }
+}
+
+TEST_CASE("Streaming GHASH", "[GHASH]") {
+    SECTION("GCM test vectors") {
+        // Test case 2
+        auto c2 = fromHex("0388dace60b6a392f328c2b971b2fe78");
+        REQUIRE(GFlinalg::ghash(elem("66e94bd4ef8a2c3b884cfa59ca342b2e"), nullptr, 0, c2.data(), c2.size()) ==
+                elem("f38cbb1ad69223dcc3457ae5b6b0f885"));
+
+        // Test cases 3 and 4
+        auto h = elem("b83b533708bf535d0aa6e52980d53b78");
+        auto c = fromHex("42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e"
+                         "21d514b25466931c7d8f6a5aac84aa051ba30b396a0aac973d58e091473f5985");
+        auto a = fromHex("feedfacedeadbeeffeedfacedeadbeefabaddad2");
+
+        REQUIRE(GFlinalg::ghash(h, nullptr, 0, c.data(), c.size()) == elem("7f1b32b81b820d02614f8895ac1d4eac"));
+        REQUIRE(GFlinalg::ghash(h, a.data(), a.size(), c.data(), 60) == elem("698e57f70e6ecc7fd9463b7260a9ae5f"));
+    }
+    SECTION("Aggregation and chunking do not change the result") {
+        std::mt19937_64 rd;
+        std::vector<uint8_t> data(16 * 37 + 5);
+
+        for (auto& b : data)
+            b = static_cast<uint8_t>(rd());
+
+        GcmBinPolynomial h(rd(), rd());
+
+        // Reference: one block at a time through the element arithmetic
+        std::vector<uint8_t> padded(data);
+        padded.resize(16 * 38, 0);
+
+        GcmBinPolynomial y;
+        for (size_t i = 0; i < padded.size(); i += 16)
+            y = (y + GcmBinPolynomial::fromBytes(padded.data() + i)) * h;
+
+        REQUIRE(GhashHasher(h).update(data).digest() == y);
+
+        for (size_t chunk : {1, 3, 16, 17, 100, 129}) {
+            GhashHasher hasher(h);
+
+            for (size_t pos = 0; pos < data.size(); pos += chunk)
+                hasher.update(data.data() + pos, std::min(chunk, data.size() - pos));
+
+            REQUIRE(hasher.digest() == y);
+            REQUIRE(hasher.size() == data.size());
+
+            uint8_t out[16];
+            hasher.digest(out);
+            REQUIRE(GcmBinPolynomial::fromBytes(out) == y);
+        }
+
+        GhashHasher hasher(h);
+        hasher.update(data).reset();
+        REQUIRE(hasher.digest() == GcmBinPolynomial());
+    }
+}
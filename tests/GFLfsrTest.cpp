@@ -0,0 +1,105 @@
+#include <random>
+#include <vector>
+
+#include "catch.hpp"
+#include "GFLfsr.hpp"
+
+using Lfsr8 = GFlinalg::Lfsr<uint16_t, 0x11d>;
+using Lfsr23 = GFlinalg::Lfsr<uint32_t, 0x800021>;
+using Lfsr63 = GFlinalg::Lfsr<uint64_t, 0x8000000000000003>;
+// PRBS7 and the 802.11 scrambler
+using Prbs7 = GFlinalg::Lfsr<uint8_t, 0xC1>;
+using Scrambler = GFlinalg::Lfsr<uint8_t, 0x91>;
+
+static_assert(Lfsr8::wordBits == 0 && Lfsr23::wordBits == 16 && Lfsr63::wordBits == 56 && Prbs7::wordBits == 0,
+              "Step width follows the gap");
+
+TEMPLATE_TEST_CASE("LFSR generation and jump-ahead", "[LFSR]", Lfsr8, Lfsr23, Lfsr63, Prbs7, Scrambler) {
+    constexpr size_t n = TestType::degree;
+
+    SECTION("Bytes agree with single steps and satisfy the recurrence") {
+        TestType bytes(1), bits(1);
+        std::vector<uint8_t> seq;
+
+        for (size_t i = 0; i < 200; ++i) {
+            uint8_t byte = bytes.nextByte();
+
+            for (size_t j = 8; j-- > 0;) {
+                seq.push_back(bits.nextBit());
+                REQUIRE(seq.back() == ((byte >> j) & 1));
+            }
+
+            REQUIRE(bytes.state() == bits.state());
+        }
+
+        // s(t + n) = sum of c_i * s(t + i) over the low terms of modPol
+        const uint64_t low = static_cast<uint64_t>(TestType::Polynomial::getMod()) & ((uint64_t(1) << n) - 1);
+
+        for (size_t t = 0; t + n < seq.size(); ++t) {
+            uint8_t sum = 0;
+
+            for (size_t i = 0; i < n; ++i)
+                sum ^= ((low >> i) & 1) & seq[t + i];
+
+            REQUIRE(seq[t + n] == sum);
+        }
+    }
+    SECTION("Jump equals stepping") {
+        std::mt19937_64 rd;
+
+        for (size_t i = 0; i < 20; ++i) {
+            uint64_t steps = rd() % 5000;
+            // Below 2^7 the seed is already reduced, so it stays nonzero
+            TestType a(1 + rd() % 127), b(a.state());
+
+            for (uint64_t k = 0; k < steps; ++k)
+                a.nextBit();
+
+            REQUIRE(b.jump(steps).state() == a.state());
+            REQUIRE(b.nextWord() == a.nextWord());
+        }
+    }
+    SECTION("Bulk generation") {
+        std::vector<uint8_t> bulk(1001);
+        TestType a(7), b(7);
+
+        a.generate(bulk.data(), bulk.size());
+
+        for (uint8_t byte : bulk)
+            REQUIRE(byte == b.nextByte());
+
+        REQUIRE(a.state() == b.state());
+    }
+    SECTION("Parallel generation") {
+        std::vector<uint8_t> one(100000), many(100000);
+        TestType a(5), b(5);
+
+        a.generate(one.data(), one.size());
+        b.generateParallel(many.data(), many.size(), 3);
+
+        REQUIRE(one == many);
+        REQUIRE(a.state() == b.state());
+    }
+}
+
+TEST_CASE("LFSR period", "[LFSR]") {
+    // Primitive feedback polynomials give the maximal period 2^n - 1
+    Lfsr8 a(1);
+    REQUIRE(a.jump(255).state() == 1);
+
+    Lfsr23 b(1);
+    REQUIRE(b.jump((1 << 23) - 1).state() == 1);
+    REQUIRE(b.jump(12345).state() != 1);
+
+    Lfsr63 c(1);
+    REQUIRE(c.jump(~uint64_t(0) >> 1).state() == 1);
+
+    Prbs7 d(1);
+    REQUIRE(d.jump(127).state() == 1);
+    REQUIRE(d.jump(63).state() != 1);
+
+    Scrambler e(0x7f);
+    REQUIRE(e.jump(127).state() == 0x7f);
+
+    REQUIRE_THROWS_AS(Lfsr8(0), std::invalid_argument);
+}
@@ -0,0 +1,142 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "catch.hpp"
+#include "GFSPlinalg.hpp"
+#include "GFModulus.hpp"
+
+using GFlinalg::op::ModulusKind;
+
+static_assert(GFlinalg::op::isIrreducible<uint16_t>(0x11d), "x^8 + x^4 + x^3 + x^2 + 1 is irreducible");
+static_assert(!GFlinalg::op::isIrreducible<uint8_t>(0x15), "x^4 + x^2 + 1 = (x^2 + x + 1)^2");
+
+/**
+ * Irreducibility by trial division over all polynomials of degree up to n / 2.
+ */
+static bool naiveIrreducible(uint64_t f) {
+    size_t n = GFlinalg::op::modulus::degree64(f);
+
+    for (uint64_t d = 2; GFlinalg::op::modulus::degree64(d) * 2 <= n; ++d) {
+        uint64_t r = f;
+
+        while (r != 0 && GFlinalg::op::modulus::degree64(r) >= GFlinalg::op::modulus::degree64(d))
+            r ^= d << (GFlinalg::op::modulus::degree64(r) - GFlinalg::op::modulus::degree64(d));
+
+        if (r == 0)
+            return false;
+    }
+
+    return n > 0;
+}
+
+/**
+ * Primitivity by walking the powers of x.
+ */
+static bool naivePrimitive(uint64_t f) {
+    size_t n = GFlinalg::op::modulus::degree64(f);
+    uint64_t low = f ^ (uint64_t(1) << n);
+    uint64_t x = GFlinalg::op::modulus::xMod(low, n);
+    uint64_t p = x;
+
+    for (uint64_t k = 1; k < (uint64_t(1) << n) - 1; ++k) {
+        if (p == 1)
+            return false;
+
+        p = GFlinalg::op::modulus::mulMod(p, x, low, n);
+    }
+
+    return p == 1 && naiveIrreducible(f);
+}
+
+TEST_CASE("Irreducibility and primitivity tests", "[Modulus]") {
+    REQUIRE(GFlinalg::op::isPrimitive<uint16_t>(0x11d));
+    REQUIRE(GFlinalg::op::isIrreducible<uint16_t>(0x11b));
+    REQUIRE_FALSE(GFlinalg::op::isPrimitive<uint16_t>(0x11b));
+    REQUIRE(GFlinalg::op::isIrreducible<uint8_t>(0x1f));
+    REQUIRE_FALSE(GFlinalg::op::isPrimitive<uint8_t>(0x1f));
+    REQUIRE_FALSE(GFlinalg::op::isIrreducible<uint8_t>(1));
+    REQUIRE(GFlinalg::op::isPrimitive(0x1b, 64));
+
+    SECTION("Small degrees against trial division") {
+        for (uint64_t f = 2; f < (1 << 11); ++f) {
+            size_t n = GFlinalg::op::modulus::degree64(f);
+            uint64_t low = f ^ (uint64_t(1) << n);
+
+            REQUIRE(GFlinalg::op::isIrreducibleBenOr(low, n) == naiveIrreducible(f));
+            REQUIRE(GFlinalg::op::isIrreducibleRabin(low, n) == naiveIrreducible(f));
+            REQUIRE(GFlinalg::op::isPrimitive(low, n) == naivePrimitive(f));
+        }
+    }
+    SECTION("Ben-Or and Rabin agree") {
+        std::mt19937_64 rd;
+
+        for (size_t i = 0; i < 3000; ++i) {
+            size_t n = 2 + rd() % 63;
+            uint64_t low = rd() & GFlinalg::op::modulus::lowMask(n);
+
+            REQUIRE(GFlinalg::op::isIrreducibleBenOr(low, n) == GFlinalg::op::isIrreducibleRabin(low, n));
+        }
+    }
+    SECTION("Factors of the group order") {
+        for (size_t n = 1; n <= 64; ++n) {
+            uint64_t order = GFlinalg::op::modulus::lowMask(n);
+
+            for (uint64_t p : GFlinalg::op::groupOrderFactors(n)) {
+                REQUIRE(GFlinalg::op::modulus::isPrime64(p));
+                REQUIRE(order % p == 0);
+
+                while (order % p == 0)
+                    order /= p;
+            }
+
+            REQUIRE(order == 1);
+        }
+    }
+}
+
+TEST_CASE("Modulus search", "[Modulus]") {
+    SECTION("Number of irreducible and primitive polynomials") {
+        // Degrees 1..12: (1/n) sum mu(d) 2^(n/d) and phi(2^n - 1) / n
+        const size_t irreducible[] = {2, 1, 2, 3, 6, 9, 18, 30, 56, 99, 186, 335};
+        const size_t primitive[] = {1, 1, 2, 2, 6, 6, 18, 16, 48, 60, 176, 144};
+
+        for (size_t n = 1; n <= 12; ++n) {
+            REQUIRE(GFlinalg::op::findModuli(n, ModulusKind::Irreducible).size() == irreducible[n - 1]);
+            REQUIRE(GFlinalg::op::findModuli(n, ModulusKind::Primitive, SIZE_MAX, 3).size() == primitive[n - 1]);
+        }
+    }
+    SECTION("Limit and thread count do not change the result") {
+        auto one = GFlinalg::op::findModuli(32, ModulusKind::Primitive, 20, 1);
+        auto many = GFlinalg::op::findModuli(32, ModulusKind::Primitive, 20, 4);
+
+        REQUIRE(one.size() == 20);
+        REQUIRE(one == many);
+
+        for (uint64_t low : one)
+            REQUIRE(GFlinalg::op::isPrimitive(low, 32));
+    }
+    SECTION("Lowest weight") {
+        REQUIRE(GFlinalg::op::findLowestWeightModuli(7, ModulusKind::Primitive) ==
+                std::vector<uint64_t>{0x03, 0x09, 0x11, 0x41});
+
+        // No irreducible trinomials of degree 8 (Swan), 0x1d is x^8 + x^4 + x^3 + x^2 + 1
+        auto deg8 = GFlinalg::op::findLowestWeightModuli(8, ModulusKind::Primitive, SIZE_MAX, 2);
+        REQUIRE(std::find(deg8.begin(), deg8.end(), 0x1d) != deg8.end());
+
+        auto deg64 = GFlinalg::op::findLowestWeightModuli(64, ModulusKind::Primitive, 4);
+        REQUIRE(deg64.size() == 4);
+
+        for (uint64_t low : deg64) {
+            REQUIRE(__builtin_popcountll(low) == 4);
+            REQUIRE(GFlinalg::op::isPrimitive(low, 64));
+        }
+    }
+}
+
+TEST_CASE("Modulus validation in the element classes", "[Modulus]") {
+    REQUIRE_THROWS_AS(GFlinalg::BasicGFElem<uint8_t>(1, 0x15), std::invalid_argument);
+    REQUIRE_NOTHROW(GFlinalg::BasicGFElem<uint8_t>(1, 0x13));
+    REQUIRE_THROWS_AS(GFlinalg::LUTVectPair<uint16_t>(0x11b), std::invalid_argument);
+    REQUIRE_THROWS_AS(GFlinalg::LUTVectPair<uint16_t>(0x101), std::invalid_argument);
+}
@@ -0,0 +1,111 @@
+#include <random>
+#include <vector>
+
+#include "catch.hpp"
+#include "GFNetworkCoding.hpp"
+
+using Encoder = GFlinalg::RlncEncoder<uint16_t, 0x11d>;
+using Decoder = GFlinalg::RlncDecoder<uint16_t, 0x11d>;
+
+TEST_CASE("Region multiply-accumulate", "[NetworkCoding]") {
+    using Elem = GFlinalg::BasicBinPolynomial<uint16_t, 0x11d>;
+
+    const auto& field = GFlinalg::op::RegionField<Elem>::get();
+    std::mt19937 rd;
+    std::vector<uint8_t> in(77), out(77), expected(77);
+
+    for (size_t i = 0; i < in.size(); ++i) {
+        in[i] = static_cast<uint8_t>(rd());
+        out[i] = expected[i] = static_cast<uint8_t>(rd());
+    }
+
+    for (uint8_t c : {0, 1, 2, 0x53, 0xff}) {
+        for (size_t i = 0; i < in.size(); ++i)
+            expected[i] ^= static_cast<uint8_t>((Elem(c) * Elem(in[i])).val());
+
+        field.mulAdd(c, in.data(), out.data(), in.size());
+        REQUIRE(out == expected);
+
+        if (c)
+            REQUIRE((Elem(c) * Elem(field.inv[c])).val() == 1);
+    }
+}
+
+TEST_CASE("RLNC round trip", "[NetworkCoding]") {
+    for (size_t symbols : {1, 5, 32}) {
+        const size_t symbolSize = 100;
+
+        std::mt19937 rd(static_cast<unsigned>(symbols));
+        std::vector<uint8_t> data(symbols * symbolSize), packet, out(data.size());
+
+        for (auto& b : data)
+            b = static_cast<uint8_t>(rd());
+
+        Encoder enc(data.data(), symbols, symbolSize, symbols);
+        Decoder dec(symbols, symbolSize);
+
+        packet.resize(enc.packetSize());
+
+        REQUIRE_THROWS_AS(dec.copyTo(out.data()), std::logic_error);
+
+        size_t sent = 0;
+
+        while (!dec.complete()) {
+            enc.encode(packet.data());
+            ++sent;
+
+            size_t before = dec.rank();
+
+            bool innovative = dec.consume(packet.data());
+
+            REQUIRE(innovative == (dec.rank() == before + 1));
+            REQUIRE(!dec.consume(packet.data()));
+        }
+
+        REQUIRE(sent <= symbols + 3);
+
+        for (size_t i = 0; i < symbols; ++i)
+            REQUIRE(dec.decoded(i));
+
+        dec.copyTo(out.data());
+        REQUIRE(out == data);
+    }
+}
+
+TEST_CASE("RLNC partial decoding and dependent packets", "[NetworkCoding]") {
+    const size_t symbols = 6, symbolSize = 33;
+
+    std::vector<uint8_t> data(symbols * symbolSize);
+
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = static_cast<uint8_t>(i * 7 + 1);
+
+    Encoder enc(data.data(), symbols, symbolSize);
+    Decoder dec(symbols, symbolSize);
+    std::vector<uint8_t> a(enc.packetSize()), b(enc.packetSize()), sum(enc.packetSize());
+
+    // Packets mixing symbols 0 and 1 only
+    a[0] = 3;
+    a[1] = 1;
+    b[0] = 5;
+    b[1] = 9;
+    enc.encode(a.data(), a.data() + symbols);
+    enc.encode(b.data(), b.data() + symbols);
+
+    for (size_t i = 0; i < sum.size(); ++i)
+        sum[i] = a[i] ^ b[i];
+
+    REQUIRE(dec.consume(a.data()));
+    REQUIRE(!dec.decoded(0));
+    REQUIRE(dec.consume(b.data()));
+    REQUIRE(!dec.consume(sum.data()));
+    REQUIRE(dec.rank() == 2);
+
+    REQUIRE(dec.decoded(0));
+    REQUIRE(dec.decoded(1));
+    REQUIRE(!dec.decoded(2));
+    REQUIRE(std::equal(data.begin() + symbolSize, data.begin() + 2 * symbolSize, dec.symbol(1)));
+
+    REQUIRE_THROWS_AS(Decoder(0, 10), std::invalid_argument);
+    REQUIRE_THROWS_AS(Encoder(data.data(), 3, 0), std::invalid_argument);
+}
@@ -0,0 +1,84 @@
+#include <random>
+
+#include "catch.hpp"
+#include "GFNormalBasis.hpp"
+
+using Normal3 = GFlinalg::NormalBinPolynomial<uint8_t, 11>;
+using Normal4 = GFlinalg::NormalBinPolynomial<uint8_t, 19>;
+using Normal10 = GFlinalg::NormalBinPolynomial<uint16_t, 0x409>;
+using Normal14 = GFlinalg::NormalBinPolynomial<uint16_t, 0x4443>;
+
+TEST_CASE("Optimal normal basis existence", "[NormalBasis]") {
+    REQUIRE(GFlinalg::op::orderOfTwo(2) == 0);
+    REQUIRE(GFlinalg::op::orderOfTwo(11) == 10);
+    REQUIRE(GFlinalg::op::onbType(0) == 0);
+    REQUIRE(GFlinalg::op::onbType(1) == 0);
+    REQUIRE(GFlinalg::op::onbType(2) == 1);
+    REQUIRE(GFlinalg::op::onbType(3) == 2);
+    REQUIRE(GFlinalg::op::onbType(4) == 1);
+    REQUIRE(GFlinalg::op::onbType(5) == 2);
+    REQUIRE(GFlinalg::op::onbType(8) == 0);
+    REQUIRE(GFlinalg::op::onbType(10) == 1);
+    REQUIRE(GFlinalg::op::onbType(14) == 2);
+    REQUIRE(GFlinalg::op::onbType(16) == 0);
+}
+
+TEMPLATE_TEST_CASE("Normal basis arithmetic", "[NormalBinPolynomial]", Normal3, Normal4, Normal10, Normal14) {
+    using Pol = typename TestType::Polynomial;
+
+    const auto& basis = TestType::Basis::get();
+    REQUIRE(basis.terms().size() == 2 * TestType::gfDegree() - 1);
+
+    std::default_random_engine rd;
+    std::uniform_int_distribution<uint32_t> uid(0, TestType::gfOrder() - 1);
+
+    SECTION("Conversion") {
+        REQUIRE(TestType(Pol(1)) == TestType::one());
+        REQUIRE(TestType(Pol(basis.beta())).val() == 1);
+
+        for (size_t i = 0; i < 200; ++i) {
+            Pol a(uid(rd));
+            REQUIRE(TestType(a).toPolynomial() == a);
+        }
+    }
+    SECTION("Multiplication") {
+        for (size_t i = 0; i < 500; ++i) {
+            Pol a(uid(rd));
+            Pol b(uid(rd));
+            REQUIRE(TestType(a) * TestType(b) == TestType(a * b));
+            REQUIRE(TestType(a) + TestType(b) == TestType(a + b));
+        }
+    }
+    SECTION("Squaring is a rotation") {
+        for (size_t i = 0; i < 200; ++i) {
+            TestType a(uid(rd));
+            REQUIRE(a.square() == a * a);
+            REQUIRE(a.sqrt().square() == a);
+            REQUIRE(a.frobenius(TestType::gfDegree()) == a);
+            REQUIRE(GFlinalg::pow(a, 5) == a * a * a * a * a);
+        }
+    }
+    SECTION("Inversion") {
+        REQUIRE(TestType(0).getInverse() == TestType(0));
+        for (size_t i = 0; i < 200; ++i) {
+            TestType a(uid(rd));
+            if (a.val() != 0) {
+                REQUIRE(a * a.getInverse() == TestType::one());
+                REQUIRE(TestType::one() / a == a.getInverse());
+            }
+        }
+    }
+    SECTION("Bulk conversion") {
+        using T = decltype(TestType::getMod());
+        std::vector<T> in(64), normal(64), back(64);
+        for (auto& x : in)
+            x = static_cast<T>(uid(rd));
+
+        TestType::fromPolynomial(in.data(), normal.data(), in.size());
+        TestType::toPolynomial(normal.data(), back.data(), normal.size());
+
+        REQUIRE(back == in);
+        for (size_t i = 0; i < in.size(); ++i)
+            REQUIRE(normal[i] == TestType(Pol(in[i])).val());
+    }
+}
@@ -0,0 +1,149 @@
+#include <random>
+#include <vector>
+
+#include "catch.hpp"
+#include "GFRabin.hpp"
+
+using Rabin53 = GFlinalg::RabinFingerprint<uint64_t, 0x20000000000047>;
+using Rabin8 = GFlinalg::RabinFingerprint<uint16_t, 0x11b>;
+
+/**
+ * Remainder of the message polynomial by bitwise long division.
+ */
+template <class Engine>
+static uint64_t naiveFingerprint(const uint8_t* data, size_t size) {
+    constexpr size_t n = Engine::degree;
+    const uint64_t low = 0x20000000000047ULL & Engine::mask();
+    const uint64_t mod = n == 53 ? low : 0x1b;
+    uint64_t fp = 0;
+
+    for (size_t i = 0; i < size; ++i) {
+        for (size_t j = 8; j-- > 0;) {
+            uint64_t top = (fp >> (n - 1)) & 1;
+
+            fp = ((fp << 1) & Engine::mask()) | ((data[i] >> j) & 1);
+            fp ^= mod & (uint64_t(0) - top);
+        }
+    }
+
+    return fp;
+}
+
+static std::vector<uint8_t> randomBytes(size_t n, uint64_t seed) {
+    std::mt19937_64 rd(seed);
+    std::vector<uint8_t> res(n);
+
+    for (auto& b : res)
+        b = static_cast<uint8_t>(rd());
+
+    return res;
+}
+
+TEMPLATE_TEST_CASE("Rolling fingerprint", "[Rabin]", Rabin53, Rabin8) {
+    const auto data = randomBytes(2000, 1);
+
+    SECTION("Fingerprint of a message") {
+        const TestType rabin(16);
+
+        for (size_t size : {0, 1, 7, 8, 100, 2000})
+            REQUIRE(rabin.fingerprint(data.data(), size) == naiveFingerprint<TestType>(data.data(), size));
+
+        // Continuation
+        REQUIRE(rabin.fingerprint(data.data() + 100, 900, rabin.fingerprint(data.data(), 100)) ==
+                rabin.fingerprint(data.data(), 1000));
+    }
+    SECTION("Window") {
+        for (size_t window : {1, 7, 48, 64}) {
+            const TestType rabin(window);
+            GFlinalg::RabinWindow<TestType> win(rabin);
+
+            for (size_t i = 0; i < data.size(); ++i) {
+                size_t begin = i + 1 >= window ? i + 1 - window : 0;
+
+                REQUIRE(win.slide(data[i]) == rabin.fingerprint(data.data() + begin, i + 1 - begin));
+            }
+
+            win.reset();
+            REQUIRE(win.slide(data.data(), 500) == rabin.fingerprint(data.data() + 500 - window, window));
+        }
+    }
+
+    REQUIRE_THROWS_AS(TestType(0), std::invalid_argument);
+}
+
+TEST_CASE("Content-defined chunking", "[Rabin]") {
+    const Rabin53 rabin(48);
+    const auto data = randomBytes(1 << 20, 2);
+
+    GFlinalg::RabinChunker<Rabin53> chunker(rabin, 2048, 8192, 65536);
+    const auto chunks = chunker.split(data.data(), data.size());
+
+    SECTION("Chunk sizes") {
+        size_t total = 0;
+
+        for (size_t i = 0; i < chunks.size(); ++i) {
+            if (i + 1 < chunks.size())
+                REQUIRE(chunks[i] >= 2048);
+
+            REQUIRE(chunks[i] <= 65536);
+            total += chunks[i];
+        }
+
+        REQUIRE(total == data.size());
+        REQUIRE(chunks.size() > data.size() / 65536);
+        REQUIRE(chunks.size() < data.size() / 2048);
+    }
+    SECTION("Streaming over arbitrary buffers") {
+        std::mt19937_64 rd(3);
+        std::vector<size_t> streamed;
+        size_t pos = 0, begin = 0;
+
+        while (pos < data.size()) {
+            size_t piece = std::min<size_t>(1 + rd() % 5000, data.size() - pos);
+            size_t done = 0;
+
+            while (done < piece) {
+                bool boundary;
+
+                done += chunker.scan(data.data() + pos + done, piece - done, boundary);
+
+                if (boundary) {
+                    streamed.push_back(pos + done - begin);
+                    begin = pos + done;
+                }
+            }
+
+            pos += piece;
+        }
+
+        if (begin < data.size())
+            streamed.push_back(data.size() - begin);
+
+        REQUIRE(streamed == chunks);
+    }
+    SECTION("Boundaries resynchronise after an insertion") {
+        auto edited = data;
+        edited.insert(edited.begin() + 1000, 37, 0xAB);
+
+        auto shifted = chunker.split(edited.data(), edited.size());
+
+        std::vector<size_t> ends, editedEnds;
+        size_t pos = 0;
+
+        for (size_t c : chunks)
+            ends.push_back(pos += c);
+
+        pos = 0;
+        for (size_t c : shifted)
+            editedEnds.push_back((pos += c) - 37);
+
+        size_t common = 0;
+        for (size_t e : ends)
+            common += std::binary_search(editedEnds.begin(), editedEnds.end(), e);
+
+        REQUIRE(common + 3 >= ends.size());
+    }
+
+    REQUIRE_THROWS_AS(GFlinalg::RabinChunker<Rabin53>(rabin, 100, 1000, 5000), std::invalid_argument);
+    REQUIRE_THROWS_AS(GFlinalg::RabinChunker<Rabin53>(rabin, 100, 1024, 50), std::invalid_argument);
+}
@@ -0,0 +1,102 @@
+#include <random>
+#include <type_traits>
+
+#include "catch.hpp"
+#include "GFSPlinalg.hpp"
+#include "GFTPlinalg.hpp"
+
+using SparsePol8 = GFlinalg::BasicBinPolynomial<uint16_t, 0x11d>;
+using SparsePol13 = GFlinalg::BasicBinPolynomial<uint16_t, 0x201b>;
+using SparsePol17 = GFlinalg::BasicBinPolynomial<uint32_t, 0x20009>;
+using SparsePol31 = GFlinalg::BasicBinPolynomial<uint64_t, 0x80000009>;
+using SparsePol4 = GFlinalg::BasicBinPolynomial<uint8_t, 0x1f>;
+using DensePol7 = GFlinalg::BasicBinPolynomial<uint8_t, 0xf7>;
+using DensePol8 = GFlinalg::BasicBinPolynomial<uint16_t, 0x1f5>;
+
+static_assert(SparsePol8::sparse.sparse && SparsePol8::sparse.count == 4, "x^8 + x^4 + x^3 + x^2 + 1");
+static_assert(SparsePol17::sparse.sparse && SparsePol17::sparse.gap() == 14, "x^17 + x^3 + 1");
+static_assert(SparsePol4::sparse.sparse && SparsePol4::sparse.gap() == 1, "x^4 + x^3 + x^2 + x + 1");
+static_assert(!DensePol7::sparse.sparse, "x^7 + x^6 + x^5 + x^4 + x^2 + x + 1");
+static_assert(!GFlinalg::op::sparseModulus<uint16_t>(0x10b).sparse, "x^8 + x^3 + x + 1");
+
+/**
+ * Shift-and-add multiplication with bitwise reduction by the full modulus.
+ */
+template <class T>
+static T naiveMul(T a, T b, T modPol) {
+    size_t n = GFlinalg::op::modPolDegree<T>(modPol);
+    T res = 0;
+
+    for (size_t i = 0; i < n; ++i) {
+        if ((b >> i) & 1)
+            res ^= a;
+
+        a <<= 1;
+
+        if ((a >> n) & 1)
+            a ^= modPol;
+    }
+
+    return res;
+}
+
+TEMPLATE_TEST_CASE("Reduction by sparse and dense moduli", "[Reduce]", SparsePol8, SparsePol13, SparsePol17,
+                   SparsePol31, SparsePol4, DensePol7, DensePol8) {
+    using T = std::decay_t<decltype(TestType().val())>;
+
+    std::mt19937_64 rd;
+    std::uniform_int_distribution<uint64_t> uid(0, TestType::gfOrder() - 1);
+
+    SECTION("Fold and long division agree on the whole container") {
+        for (size_t i = 0; i < 20000; ++i) {
+            T v = static_cast<T>(rd());
+
+            TestType a(v);
+            REQUIRE(a.val() == GFlinalg::op::longReduce<T>(v, TestType::getMod(), TestType::gfDegree()));
+            REQUIRE(a.val() < TestType::gfOrder());
+        }
+    }
+    SECTION("Multiplication") {
+        for (size_t i = 0; i < 20000; ++i) {
+            TestType a(uid(rd));
+            TestType b(uid(rd));
+
+            REQUIRE((a * b).val() == naiveMul<T>(a.val(), b.val(), TestType::getMod()));
+        }
+    }
+    SECTION("Runtime modulus uses the same kernels") {
+        using Elem = GFlinalg::BasicGFElem<T>;
+
+        const T modPol = TestType::getMod();
+
+        for (size_t i = 0; i < 5000; ++i) {
+            T u = static_cast<T>(rd()), v = static_cast<T>(uid(rd));
+
+            Elem a(u, modPol);
+            Elem b(v, modPol);
+
+            REQUIRE(a.getState().reduction.sparse == TestType::sparse.sparse);
+            REQUIRE(a.val() == TestType(u).val());
+            REQUIRE((a * b).val() == (TestType(u) * TestType(v)).val());
+        }
+    }
+}
+
+TEST_CASE("Fold descriptor", "[Reduce]") {
+    // x^15 + x + 1
+    auto d = GFlinalg::op::sparseModulus<uint16_t>(0x8003);
+
+    REQUIRE(d.sparse);
+    REQUIRE(d.degree == 15);
+    REQUIRE(d.count == 2);
+    REQUIRE(d.taps[0] == 1);
+    REQUIRE(d.taps[1] == 0);
+
+    GFlinalg::GFElemState<uint32_t> state(0x20009);
+    REQUIRE(state.SZ == 17);
+    REQUIRE(state.order == (1U << 17));
+    REQUIRE(state.reduction.taps[0] == 3);
+
+    GFlinalg::GFElemState<uint32_t> copy(state);
+    REQUIRE(copy.reduction.gap() == state.reduction.gap());
+}
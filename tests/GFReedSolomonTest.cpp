@@ -0,0 +1,136 @@
+#include <random>
+#include <set>
+#include <vector>
+
+#include "catch.hpp"
+#include "GFReedSolomon.hpp"
+
+using RS = GFlinalg::ReedSolomon<uint16_t, 0x11d>;
+
+TEST_CASE("Reed-Solomon generator and encoding", "[ReedSolomon]") {
+    using Elem = GFlinalg::BasicBinPolynomial<uint16_t, 0x11d>;
+
+    const RS code(255, 223);
+    const auto& g = code.generator();
+
+    REQUIRE(g.size() == 33);
+    REQUIRE(g.back() == 1);
+
+    // Every root a^1..a^32 of the generator
+    Elem root(1);
+
+    for (size_t i = 1; i <= 32; ++i) {
+        root *= Elem(2);
+
+        Elem v(0);
+
+        for (size_t j = g.size(); j-- > 0;)
+            v = v * root + Elem(g[j]);
+
+        REQUIRE(v.val() == 0);
+    }
+
+    // Interleaved encoding agrees with one codeword at a time
+    const size_t width = 300, stride = 310;
+    std::mt19937 rd;
+    std::vector<uint8_t> rows(255 * stride);
+
+    for (size_t i = 0; i < 223; ++i)
+        for (size_t c = 0; c < width; ++c)
+            rows[i * stride + c] = static_cast<uint8_t>(rd());
+
+    code.encodeInterleaved(rows.data(), stride, width);
+
+    for (size_t c : {0, 1, 255, 256, 299}) {
+        std::vector<uint8_t> data(223), parity(32);
+
+        for (size_t i = 0; i < 223; ++i)
+            data[i] = rows[i * stride + c];
+
+        code.encode(data.data(), parity.data());
+
+        for (size_t m = 0; m < 32; ++m)
+            REQUIRE(rows[(223 + m) * stride + c] == parity[m]);
+    }
+
+    REQUIRE_THROWS_AS(RS(256, 200), std::invalid_argument);
+    REQUIRE_THROWS_AS(RS(20, 20), std::invalid_argument);
+    REQUIRE_THROWS_AS(RS(10, 20), std::invalid_argument);
+    REQUIRE_THROWS_AS((GFlinalg::ReedSolomon<uint16_t, 0x11b>(20, 10)), std::invalid_argument);
+}
+
+TEST_CASE("Reed-Solomon batch decoding", "[ReedSolomon]") {
+    for (auto [n, k] : {std::pair<size_t, size_t>{255, 223}, {40, 30}, {12, 11}}) {
+        const RS code(n, k);
+        const size_t t = code.correctable(), count = 600;
+
+        std::mt19937 rd(static_cast<unsigned>(n));
+        std::vector<uint8_t> words(count * n);
+
+        for (size_t c = 0; c < count; ++c) {
+            for (size_t i = 0; i < k; ++i)
+                words[c * n + i] = static_cast<uint8_t>(rd());
+
+            code.encode(words.data() + c * n, words.data() + c * n + k);
+        }
+
+        auto received = words;
+        std::vector<size_t> injected(count);
+
+        // Clean lanes, correctable lanes and lanes beyond the capability
+        for (size_t c = 0; c < count; ++c) {
+            size_t errors = 0;
+
+            if (c % 3 == 1 && t > 0)
+                errors = rd() % t + 1;
+            else if (c % 3 == 2)
+                errors = t + 1 + rd() % 3;
+
+            std::set<size_t> pos;
+
+            while (pos.size() < std::min(errors, n))
+                pos.insert(rd() % n);
+
+            for (size_t p : pos)
+                received[c * n + p] ^= static_cast<uint8_t>(rd() % 255 + 1);
+
+            injected[c] = pos.size();
+        }
+
+        std::vector<int> status(count);
+        auto before = received;
+        size_t failed = code.decode(received.data(), count, status.data());
+        size_t reported = 0;
+
+        for (size_t c = 0; c < count; ++c) {
+            bool same = std::equal(received.begin() + c * n, received.begin() + (c + 1) * n, words.begin() + c * n);
+
+            if (injected[c] <= t) {
+                REQUIRE(status[c] == static_cast<int>(injected[c]));
+                REQUIRE(same);
+            } else if (status[c] < 0) {
+                REQUIRE(std::equal(received.begin() + c * n, received.begin() + (c + 1) * n, before.begin() + c * n));
+            }
+
+            reported += status[c] < 0;
+        }
+
+        REQUIRE(failed == reported);
+
+        // Interleaved rows give the same result
+        std::vector<uint8_t> rows(n * count);
+
+        for (size_t c = 0; c < count; ++c)
+            for (size_t i = 0; i < n; ++i)
+                rows[i * count + c] = before[c * n + i];
+
+        std::vector<int> status2(count);
+
+        REQUIRE(code.decodeInterleaved(rows.data(), count, count, status2.data()) == failed);
+        REQUIRE(status2 == status);
+
+        for (size_t c = 0; c < count; ++c)
+            for (size_t i = 0; i < n; ++i)
+                REQUIRE(rows[i * count + c] == received[c * n + i]);
+    }
+}
@@ -0,0 +1,73 @@
+#include "catch.hpp"
+#include "GFScope.hpp"
+
+using Scope = GFlinalg::GFScope<uint8_t>;
+using Elem = GFlinalg::BasicGFElem<uint8_t>;
+
+TEST_CASE("Field scope arithmetic", "[GFScope]") {
+    Scope scope(11);
+
+    SECTION("Field parameters") {
+        REQUIRE(scope.gfDegree() == 3);
+        REQUIRE(scope.gfOrder() == 8);
+        REQUIRE(scope.getMod() == 11);
+    }
+    SECTION("Agrees with BasicGFElem") {
+        for (uint8_t a = 0; a < 8; ++a) {
+            for (uint8_t b = 0; b < 8; ++b) {
+                REQUIRE(scope.add(a, b) == (Elem(a, 11) + Elem(b, 11)).val());
+                REQUIRE(scope.mul(a, b) == (Elem(a, 11) * Elem(b, 11)).val());
+                if (b != 0)
+                    REQUIRE(scope.div(a, b) == (Elem(a, 11) / Elem(b, 11)).val());
+            }
+            REQUIRE(scope.pow(a, 3) == GFlinalg::pow(Elem(a, 11), 3).val());
+        }
+    }
+    SECTION("Division sentinel") {
+        REQUIRE(scope.inv(0) == 0);
+        if (!Scope::checked)
+            REQUIRE(scope.div(5, 0) == 0);
+        REQUIRE(scope.pow(0, 0) == 1);
+        REQUIRE(scope.pow(0, 5) == 0);
+    }
+    SECTION("Elements") {
+        REQUIRE(scope.mul(Elem(3, 11), Elem(3, 11)) == Elem(5, 11));
+        REQUIRE(scope.div(Elem(10, 11), Elem(7, 11)) == Elem(4, 11));
+        REQUIRE(scope.inv(scope.elem(6)).val() == scope.inv(6));
+    }
+    SECTION("Batch") {
+        uint8_t a[] = {1, 2, 3, 4, 5, 6, 7};
+        uint8_t b[] = {7, 6, 5, 4, 3, 2, 1};
+        uint8_t out[7];
+
+        scope.mul(a, b, out, 7);
+        for (size_t i = 0; i < 7; ++i)
+            REQUIRE(out[i] == scope.mul(a[i], b[i]));
+
+        scope.div(out, b, out, 7);
+        for (size_t i = 0; i < 7; ++i)
+            REQUIRE(out[i] == a[i]);
+    }
+}
+
+TEST_CASE("Field scope validation", "[GFScope]") {
+    REQUIRE_THROWS_AS(Scope(1), std::invalid_argument);
+    // x^3 + x^2 + x + 1 = (x + 1)^3
+    REQUIRE_THROWS_AS(Scope(15), std::invalid_argument);
+    // x^8 + x^4 + x^3 + x + 1 is irreducible, but x is not primitive
+    REQUIRE_THROWS_AS(GFlinalg::GFScope<uint16_t>(0x11b), std::invalid_argument);
+
+    GFlinalg::GFScope<uint16_t> gf256(0x11d);
+    for (uint16_t a = 1; a < 256; ++a)
+        REQUIRE(gf256.mul(a, gf256.inv(a)) == 1);
+}
+
+#ifdef GFLINALG_DEBUG
+TEST_CASE("Field scope debug checks", "[GFScope]") {
+    Scope scope(11);
+
+    REQUIRE_THROWS_AS(scope.div(5, 0), std::out_of_range);
+    REQUIRE_THROWS_AS(scope.mul(8, 1), std::runtime_error);
+    REQUIRE_THROWS_AS(scope.mul(Elem(3, 11), Elem(3, 13)), std::runtime_error);
+}
+#endif
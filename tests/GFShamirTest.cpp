@@ -0,0 +1,124 @@
+#include <random>
+#include <vector>
+
+#include "catch.hpp"
+#include "GFShamir.hpp"
+
+using Sharing = GFlinalg::ShamirSharing<uint16_t, 0x11b>;
+
+TEST_CASE("Shamir split and combine", "[Shamir]") {
+    std::mt19937_64 rd;
+
+    for (size_t threshold : {1, 3, 5}) {
+        const size_t size = 5000, n = 7;
+        const uint8_t ids[n] = {1, 2, 3, 50, 77, 200, 255};
+
+        Sharing sharing(threshold);
+        std::vector<uint8_t> secret(size), shares(n * size), out(size);
+
+        for (auto& b : secret)
+            b = static_cast<uint8_t>(rd());
+
+        sharing.split(secret.data(), size, ids, n, shares.data(), rd);
+
+        // Every subset of threshold shares, in any order
+        for (size_t first = 0; first + threshold <= n; ++first) {
+            std::vector<uint8_t> subIds, subShares;
+
+            for (size_t j = first + threshold; j-- > first;) {
+                subIds.push_back(ids[j]);
+                subShares.insert(subShares.end(), shares.begin() + j * size, shares.begin() + (j + 1) * size);
+            }
+
+            out.assign(size, 0);
+            sharing.combine(subIds.data(), subIds.size(), subShares.data(), size, out.data());
+            REQUIRE(out == secret);
+        }
+
+        REQUIRE(sharing.cached() == n + 1 - threshold);
+
+        // The coefficients of a known set are reused
+        sharing.combine(ids, n, shares.data(), size, out.data());
+        const size_t cached = sharing.cached();
+
+        sharing.combine(ids, n, shares.data(), size, out.data());
+        REQUIRE(sharing.cached() == cached);
+        REQUIRE(out == secret);
+    }
+}
+
+TEST_CASE("Shamir Lagrange coefficients", "[Shamir]") {
+    using Elem = GFlinalg::BasicBinPolynomial<uint16_t, 0x11b>;
+
+    std::mt19937_64 rd;
+    Sharing sharing(4);
+    const uint8_t secret[2] = {0x42, 0x00};
+    std::vector<uint8_t> ids(255), shares(255 * 2);
+
+    for (size_t j = 0; j < ids.size(); ++j)
+        ids[j] = static_cast<uint8_t>(j + 1);
+
+    sharing.split(secret, 2, ids.data(), ids.size(), shares.data(), rd);
+
+    // Any four consecutive shares interpolate to the secret at zero
+    for (size_t lane = 0; lane < 2; ++lane) {
+        std::vector<uint8_t> sub(4);
+
+        for (size_t j = 0; j < 4; ++j)
+            sub[j] = shares[(j + 10) * 2 + lane];
+
+        auto lambda = sharing.lagrange(ids.data() + 10);
+        Elem value(0);
+
+        for (size_t j = 0; j < 4; ++j)
+            value += Elem(lambda[j]) * Elem(sub[j]);
+
+        REQUIRE(value.val() == secret[lane]);
+    }
+}
+
+TEST_CASE("Shamir Lagrange cache", "[Shamir]") {
+    Sharing sharing(3);
+    const uint8_t ids[3] = {7, 200, 31}, permuted[3] = {31, 7, 200};
+
+    // One entry per set of IDs, the coefficients follow the order of the call
+    auto lambda = sharing.lagrange(ids), other = sharing.lagrange(permuted);
+
+    REQUIRE(sharing.cached() == 1);
+    REQUIRE(other == std::vector<uint8_t>{lambda[2], lambda[0], lambda[1]});
+
+    // The cache does not grow beyond its limit
+    for (size_t x = 1; x <= Sharing::cacheLimit + 100; ++x) {
+        const uint8_t set[3] = {static_cast<uint8_t>(x), 254, 255};
+        sharing.lagrange(set);
+    }
+
+    REQUIRE(sharing.cached() == Sharing::cacheLimit);
+    REQUIRE(sharing.lagrange(permuted) == other);
+}
+
+TEST_CASE("Shamir with a generator of partial range", "[Shamir]") {
+    std::minstd_rand rd;
+    Sharing sharing(2);
+    const uint8_t secret[5] = {1, 2, 3, 4, 5}, ids[2] = {9, 4};
+    uint8_t shares[10], out[5];
+
+    sharing.split(secret, 5, ids, 2, shares, rd);
+    sharing.combine(ids, 2, shares, 5, out);
+
+    REQUIRE(std::equal(out, out + 5, secret));
+}
+
+TEST_CASE("Shamir argument checks", "[Shamir]") {
+    std::mt19937_64 rd;
+    Sharing sharing(3);
+    uint8_t secret[4] = {}, shares[12];
+    const uint8_t dup[3] = {1, 2, 1}, zero[3] = {0, 1, 2}, ok[3] = {1, 2, 3};
+
+    REQUIRE_THROWS_AS(Sharing(0), std::invalid_argument);
+    REQUIRE_THROWS_AS(Sharing(256), std::invalid_argument);
+    REQUIRE_THROWS_AS(sharing.split(secret, 4, ok, 2, shares, rd), std::invalid_argument);
+    REQUIRE_THROWS_AS(sharing.split(secret, 4, dup, 3, shares, rd), std::invalid_argument);
+    REQUIRE_THROWS_AS(sharing.combine(zero, 3, shares, 4, secret), std::invalid_argument);
+    REQUIRE_THROWS_AS(sharing.combine(ok, 2, shares, 4, secret), std::invalid_argument);
+}
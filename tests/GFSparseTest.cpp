@@ -0,0 +1,111 @@
+#include <random>
+#include <vector>
+
+#include "catch.hpp"
+#include "GFSparse.hpp"
+
+using Elem = GFlinalg::BasicBinPolynomial<uint16_t, 0x11d>;
+using Csr = GFlinalg::CsrMatrix<Elem>;
+using Csc = GFlinalg::CscMatrix<Elem>;
+
+static std::vector<Elem> randomDense(std::mt19937& rd, size_t rows, size_t cols, unsigned percent) {
+    std::vector<Elem> res(rows * cols, Elem(0));
+
+    for (auto& e : res)
+        if (rd() % 100 < percent)
+            e = Elem(static_cast<uint16_t>(rd() % 255 + 1));
+
+    return res;
+}
+
+static std::vector<Elem> denseMultiply(const std::vector<Elem>& a, size_t rows, size_t cols, const std::vector<Elem>& x) {
+    std::vector<Elem> y(rows, Elem(0));
+
+    for (size_t i = 0; i < rows; ++i)
+        for (size_t j = 0; j < cols; ++j)
+            y[i] += a[i * cols + j] * x[j];
+
+    return y;
+}
+
+// Vectors of elements are compared in double parentheses, the stream operator of the elements is too greedy
+TEST_CASE("Sparse matrix construction", "[Sparse]") {
+    std::mt19937 rd;
+    const size_t rows = 37, cols = 53;
+    auto dense = randomDense(rd, rows, cols, 10);
+
+    Csr a = Csr::fromDense(dense, rows, cols);
+    Csc b = Csc::fromDense(dense, rows, cols);
+
+    REQUIRE(a.rows() == rows);
+    REQUIRE(a.columns() == cols);
+    REQUIRE(a.nonzeros() == b.nonzeros());
+    REQUIRE((a.toDense() == dense));
+    REQUIRE((b.toDense() == dense));
+    REQUIRE((a.convert().toDense() == dense));
+    REQUIRE((b.convert().toDense() == dense));
+    REQUIRE(a.convert().indices() == b.indices());
+
+    for (size_t i = 0; i < rows; ++i)
+        for (size_t j = 0; j < cols; ++j)
+            REQUIRE(a(i, j) == dense[i * cols + j]);
+
+    SECTION("Triplets are summed") {
+        Csr t = Csr::fromTriplets(3, 4, {{2, 1, Elem(5)}, {0, 3, Elem(7)}, {2, 1, Elem(6)}, {1, 0, Elem(9)}, {1, 0, Elem(9)}});
+
+        REQUIRE(t.nonzeros() == 2);
+        REQUIRE(t(2, 1) == Elem(3));
+        REQUIRE(t(0, 3) == Elem(7));
+        REQUIRE(t(1, 0) == Elem(0));
+        REQUIRE(t.offsets() == std::vector<size_t>{0, 1, 1, 2});
+
+        REQUIRE_THROWS_AS(Csr::fromTriplets(3, 4, {{3, 0, Elem(1)}}), std::out_of_range);
+        REQUIRE_THROWS_AS(t(0, 4), std::out_of_range);
+        REQUIRE_THROWS_AS(Csr::fromDense(dense, rows, cols + 1), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Sparse matrix products", "[Sparse]") {
+    std::mt19937 rd(3);
+
+    for (unsigned percent : {0, 2, 30, 100}) {
+        const size_t rows = 40, cols = 29, width = 70;
+        auto dense = randomDense(rd, rows, cols, percent);
+        Csr a = Csr::fromDense(dense, rows, cols);
+        Csc b = a.convert();
+
+        std::vector<Elem> x;
+
+        for (size_t j = 0; j < cols; ++j)
+            x.push_back(Elem(static_cast<uint16_t>(rd() % 256)));
+
+        auto y = denseMultiply(dense, rows, cols, x);
+
+        REQUIRE((a.multiply(x) == y));
+        REQUIRE((b.multiply(x) == y));
+        REQUIRE_THROWS_AS(a.multiply(std::vector<Elem>(cols + 1, Elem(0))), std::invalid_argument);
+
+        // Every byte column of the block is an independent vector
+        std::vector<uint8_t> block(cols * width), outA(rows * width, 0xff), outB(rows * width, 0xff);
+
+        for (auto& v : block)
+            v = static_cast<uint8_t>(rd());
+
+        a.multiplyBlock(block.data(), width, outA.data());
+        b.multiplyBlock(block.data(), width, outB.data());
+
+        REQUIRE(outA == outB);
+
+        for (size_t c : {0, 1, 33, 69}) {
+            std::vector<Elem> column;
+
+            for (size_t j = 0; j < cols; ++j)
+                column.push_back(Elem(block[j * width + c]));
+
+            auto expected = denseMultiply(dense, rows, cols, column);
+
+            for (size_t i = 0; i < rows; ++i)
+                REQUIRE(outA[i * width + c] == expected[i].val());
+        }
+    }
+}
@@ -1,5 +1,8 @@
 #include "catch.hpp"
+#include "GFBitMatrix.hpp"
+#include "GFSparse.hpp"
 #include "GFStorage.h"
+#include "GFStrassen.hpp"
 
 using T = uint8_t;
 using Elem = GFlinalg::BasicGFElem<T>;
@@ -84,4 +87,92 @@ TEST_CASE("Matrix engine", "[MatrixEngine]") {
 
         REQUIRE(m(0, 0) == a);
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Views of a matrix engine", "[MatrixEngine]") {
+    Elem a(10, 11);
+    Matrix<3, 4> m(a.getState());
+
+    for (size_t i = 0; i < 3; ++i)
+        for (size_t j = 0; j < 4; ++j)
+            m(i, j).val() = static_cast<T>(4 * i + j);
+
+    SECTION("Whole engine") {
+        auto v = GFlinalg::makeView(m);
+
+        REQUIRE(v.rows() == 3);
+        REQUIRE(v.columns() == 4);
+        REQUIRE(v(2, 1).val() == 9);
+
+        // Zero-copy selection of rows, written through to the engine
+        const std::vector<size_t> rows{2, 0};
+        auto g = GFlinalg::gatherRows(v.columnBlock(1, 3), rows);
+
+        REQUIRE(g(0, 0).val() == 9);
+        REQUIRE(g(1, 2).val() == 3);
+
+        g(1, 2) = a;
+
+        REQUIRE(m(0, 3) == a);
+        REQUIRE(GFlinalg::transpose(v)(3, 1).val() == 7);
+    }
+
+    SECTION("Matrix algorithms") {
+        // The same field with a compile time modulus
+        using P     = GFlinalg::BasicBinPolynomial<T, 11>;
+        using Dense = GFlinalg::DenseMatrix<P>;
+
+        Matrix<6, 3> generator(a.getState());
+        Matrix<3, 3> product(a.getState());
+        Dense data(3, 5), square(3, 3);
+
+        for (size_t i = 0; i < 6; ++i)
+            for (size_t j = 0; j < 3; ++j)
+                generator(i, j).val() = static_cast<T>((5 * i + 3 * j + 1) % 8);
+
+        for (size_t i = 0; i < 3; ++i) {
+            for (size_t j = 0; j < 5; ++j)
+                data.set(i, j, P(static_cast<T>((i * 7 + j * 3) % 8)));
+
+            for (size_t j = 0; j < 3; ++j)
+                square.set(i, j, P(static_cast<T>((i + 2 * j + 3) % 8)));
+        }
+
+        // Surviving rows of the engine, without copying them
+        const std::vector<size_t> rows{5, 1, 3};
+        auto survivors = GFlinalg::gatherRows(GFlinalg::makeView(generator), rows);
+        const Dense copy = Dense::fromView(survivors);
+
+        for (size_t i = 0; i < 3; ++i)
+            for (size_t j = 0; j < 3; ++j)
+                REQUIRE(copy(i, j).val() == generator(rows[i], j).val());
+
+        REQUIRE((GFlinalg::CsrMatrix<P>::fromDense(survivors).toDense() == copy.toElements()));
+        REQUIRE((GFlinalg::BitMatrix::expand<P>(survivors) == GFlinalg::BitMatrix::expand(copy.toElements(), 3, 3)));
+
+        Dense c(3, 5);
+
+        GFlinalg::multiply<P>(survivors, data.view(), c.view());
+
+        REQUIRE((c == copy * data));
+
+        // Products written into an engine
+        GFlinalg::op::Arena arena(GFlinalg::op::strassenWorkspace<T>(3, 3, 3, 1));
+        GFlinalg::strassen<P>(survivors, square.view(), GFlinalg::makeView(product), arena, 1);
+
+        REQUIRE((Dense::fromView(GFlinalg::makeView(product)) == copy * square));
+    }
+
+    SECTION("AccessorBasic") {
+        Matrix<12, 1> column(a.getState());
+
+        for (size_t i = 0; i < 12; ++i)
+            column(i, 0).val() = static_cast<T>(i);
+
+        // The column vector seen as a 3 x 4 matrix
+        GFlinalg::StridedView<GFlinalg::AccessorBasic::Accessor<Elem, 12>> v(&column, 3, 4, {4, 1});
+
+        REQUIRE(v(1, 2).val() == 6);
+        REQUIRE(v.submatrix(1, 1, 2, 2)(1, 0).val() == 9);
+    }
+}
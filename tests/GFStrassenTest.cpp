@@ -0,0 +1,66 @@
+#include <random>
+#include <vector>
+
+#include "catch.hpp"
+#include "GFStrassen.hpp"
+
+using Elem = GFlinalg::BasicBinPolynomial<uint16_t, 0x11d>;
+using Elem4 = GFlinalg::BasicBinPolynomial<uint8_t, 0x13>;
+
+template <class E>
+static GFlinalg::DenseMatrix<E> randomMatrix(std::mt19937& rd, size_t rows, size_t cols, unsigned order) {
+    GFlinalg::DenseMatrix<E> res(rows, cols);
+
+    for (size_t i = 0; i < rows; ++i)
+        for (size_t j = 0; j < cols; ++j)
+            res.set(i, j, E(static_cast<uint8_t>(rd() % order)));
+
+    return res;
+}
+
+// Matrices are compared in double parentheses, the stream operator of the elements is too greedy
+TEST_CASE("Strassen-Winograd product", "[Strassen]") {
+    std::mt19937 rd;
+
+    SECTION("Dimensions and cutoffs") {
+        // Odd dimensions are peeled at every level
+        for (auto [m, k, n] : {std::tuple<size_t, size_t, size_t>{2, 2, 2}, {8, 8, 8}, {33, 17, 45}, {64, 127, 96},
+                               {100, 100, 3}, {1, 50, 50}}) {
+            auto a = randomMatrix<Elem>(rd, m, k, 256), b = randomMatrix<Elem>(rd, k, n, 256);
+            auto expected = a * b;
+
+            for (size_t cutoff : {0, 1, 2, 7, 32})
+                REQUIRE((GFlinalg::strassen(a, b, cutoff) == expected));
+        }
+    }
+
+    SECTION("GF(2^4)") {
+        auto a = randomMatrix<Elem4>(rd, 41, 30, 16), b = randomMatrix<Elem4>(rd, 30, 52, 16);
+
+        REQUIRE((GFlinalg::strassen(a, b, 4) == a * b));
+    }
+
+    SECTION("Arena") {
+        const size_t n = 150, cutoff = 16;
+        auto a = randomMatrix<Elem>(rd, n, n, 256), b = randomMatrix<Elem>(rd, n, n, 256);
+        GFlinalg::DenseMatrix<Elem> c(n, n);
+        const size_t bytes = GFlinalg::op::strassenWorkspace<uint8_t>(n, n, n, cutoff);
+
+        GFlinalg::op::Arena arena(bytes);
+        GFlinalg::strassen(a, b, c, arena, cutoff);
+
+        REQUIRE((c == a * b));
+        REQUIRE(arena.peak() == bytes);
+        REQUIRE(arena.used() == 0);
+
+        // Reused without any allocation
+        GFlinalg::strassen(b, a, c, arena, cutoff);
+
+        REQUIRE((c == b * a));
+
+        GFlinalg::op::Arena small(bytes / 2);
+
+        REQUIRE_THROWS_AS(GFlinalg::strassen(a, b, c, small, cutoff), std::logic_error);
+        REQUIRE_THROWS_AS(GFlinalg::strassen(a, GFlinalg::DenseMatrix<Elem>(n + 1, n), c, arena), std::invalid_argument);
+    }
+}
@@ -0,0 +1,125 @@
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "catch.hpp"
+#include "GFStructuredGauss.hpp"
+
+using Elem = GFlinalg::BasicBinPolynomial<uint16_t, 0x11b>;
+using Csr = GFlinalg::CsrMatrix<Elem>;
+
+// LT-like equations: most rows have 1..4 random unknowns, a few are dense
+static Csr ltSystem(std::mt19937& rd, size_t rows, size_t cols) {
+    std::vector<std::tuple<size_t, size_t, Elem>> entries;
+
+    for (size_t i = 0; i < rows; ++i) {
+        size_t degree = i % 10 == 9 ? cols / 3 : 1 + rd() % 4;
+
+        for (size_t q = 0; q < degree; ++q)
+            entries.emplace_back(i, rd() % cols, Elem(static_cast<uint16_t>(rd() % 255 + 1)));
+    }
+
+    return Csr::fromTriplets(rows, cols, entries);
+}
+
+// Vectors of elements are compared in double parentheses, the stream operator of the elements is too greedy
+TEST_CASE("Structured Gaussian elimination", "[StructuredGauss]") {
+    std::mt19937 rd(7);
+
+    SECTION("Triangular system needs no remainder") {
+        const size_t n = 50;
+        std::vector<std::tuple<size_t, size_t, Elem>> entries;
+
+        for (size_t i = 0; i < n; ++i)
+            for (size_t j = 0; j <= i; j += 1 + rd() % 3)
+                entries.emplace_back(i, j == 0 ? i : j - 1, Elem(static_cast<uint16_t>(rd() % 255 + 1)));
+
+        Csr a = Csr::fromTriplets(n, n, entries);
+        GFlinalg::StructuredGauss<Elem> sge(a);
+
+        REQUIRE(sge.remainderColumnIds().empty());
+        REQUIRE(sge.pivots() == n);
+
+        std::vector<Elem> x0, x;
+
+        for (size_t j = 0; j < n; ++j)
+            x0.push_back(Elem(static_cast<uint16_t>(rd() % 256)));
+
+        REQUIRE(sge.solve(a.multiply(x0), x));
+        REQUIRE((x == x0));
+    }
+
+    SECTION("LT-like system") {
+        const size_t rows = 420, cols = 400;
+        Csr a = ltSystem(rd, rows, cols);
+        GFlinalg::StructuredGauss<Elem> sge(a);
+
+        REQUIRE(sge.remainderColumnIds().size() < cols / 2);
+        REQUIRE(sge.remainder().size() == sge.remainderRowIds().size() * sge.remainderColumnIds().size());
+
+        std::vector<Elem> x0, x;
+
+        for (size_t j = 0; j < cols; ++j)
+            x0.push_back(Elem(static_cast<uint16_t>(rd() % 256)));
+
+        auto b = a.multiply(x0);
+
+        REQUIRE(sge.solve(b, x));
+        REQUIRE((a.multiply(x) == b));
+
+        // Inconsistent right hand side
+        auto bad = b;
+        bool rejected = false;
+
+        for (size_t i = 0; i < rows && !rejected; ++i) {
+            bad[i] += Elem(1);
+            rejected = !sge.solve(bad, x);
+            bad[i] += Elem(1);
+        }
+
+        REQUIRE(rejected);
+
+        // Blocks of symbols follow the same plan
+        const size_t width = 37;
+        std::vector<uint8_t> symbols(cols * width), block(rows * width), out(cols * width), check(rows * width);
+
+        for (auto& v : symbols)
+            v = static_cast<uint8_t>(rd());
+
+        a.multiplyBlock(symbols.data(), width, block.data());
+
+        REQUIRE(sge.solveBlock(block.data(), width, out.data()));
+
+        a.multiplyBlock(out.data(), width, check.data());
+        a.multiplyBlock(symbols.data(), width, block.data());
+
+        REQUIRE(check == block);
+    }
+
+    SECTION("Reduction and back substitution by hand") {
+        const size_t rows = 120, cols = 100;
+        Csr a = ltSystem(rd, rows, cols);
+        GFlinalg::StructuredGauss<Elem> sge(a, 0);
+
+        std::vector<Elem> x0, x;
+
+        for (size_t j = 0; j < cols; ++j)
+            x0.push_back(Elem(static_cast<uint16_t>(rd() % 256)));
+
+        auto b = a.multiply(x0);
+        std::vector<Elem> solved;
+
+        REQUIRE(sge.solve(b, solved));
+
+        // The remainder unknowns from any solution give a consistent completion
+        sge.reduce(b);
+        x.assign(cols, Elem(0));
+
+        for (uint32_t j : sge.remainderColumnIds())
+            x[j] = solved[j];
+
+        sge.backSubstitute(b, x);
+
+        REQUIRE((x == solved));
+    }
+}
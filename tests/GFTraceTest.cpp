@@ -0,0 +1,168 @@
+#include <random>
+#include <vector>
+
+#include "catch.hpp"
+#include "GFTrace.hpp"
+
+using TracePol3 = GFlinalg::BasicBinPolynomial<uint8_t, 11>;
+using TracePol8 = GFlinalg::TableBinPolynomial<uint16_t, 0x11d>;
+using TracePol13 = GFlinalg::BasicBinPolynomial<uint16_t, 0x201b>;
+using TraceNormal5 = GFlinalg::NormalBinPolynomial<uint8_t, 37>;
+using TraceNormal10 = GFlinalg::NormalBinPolynomial<uint16_t, 0x409>;
+
+template<>
+const TracePol8::GFtable TracePol8::mulTable = TracePol8::makeMulTable();
+template<>
+const TracePol8::GFtable TracePol8::divTable = TracePol8::makeInvMulTable();
+
+/**
+ * Trace by its definition a + a^2 + ... + a^(2^(n-1)).
+ */
+template <class Elem>
+static Elem naiveTrace(const Elem& a) {
+    Elem res = a;
+    Elem p = a;
+
+    for (size_t i = 1; i < a.gfDegree(); ++i) {
+        p = p * p;
+        res = res + p;
+    }
+
+    return res;
+}
+
+TEMPLATE_TEST_CASE("Trace, square root and quadratic equation", "[Trace]", TracePol3, TracePol8, TracePol13,
+                   TraceNormal5, TraceNormal10) {
+    std::default_random_engine rd;
+    std::uniform_int_distribution<uint32_t> uid(0, TestType::gfOrder() - 1);
+
+    SECTION("Trace") {
+        for (size_t i = 0; i < 1000; ++i) {
+            TestType a(uid(rd));
+            TestType b(uid(rd));
+            TestType tr = naiveTrace(a);
+
+            // Tr(a) is either 0 or 1, and 1 is the only nonzero idempotent
+            REQUIRE((tr.val() != 0) == (GFlinalg::trace(a) == 1));
+            REQUIRE(tr * tr == tr);
+            REQUIRE(GFlinalg::trace(a) == GFlinalg::trace(a * a));
+            REQUIRE(GFlinalg::trace(a + b) == (GFlinalg::trace(a) ^ GFlinalg::trace(b)));
+        }
+    }
+    SECTION("Square root") {
+        for (size_t i = 0; i < 1000; ++i) {
+            TestType a(uid(rd));
+            TestType r = GFlinalg::sqrt(a);
+
+            REQUIRE(r * r == a);
+            REQUIRE(GFlinalg::sqrt(a * a) == a);
+        }
+    }
+    SECTION("Quadratic equation") {
+        size_t solvable = 0;
+
+        for (size_t i = 0; i < 1000; ++i) {
+            TestType c(uid(rd));
+            TestType x;
+
+            bool ok = GFlinalg::solveQuadratic(c, x);
+
+            REQUIRE(ok == (GFlinalg::trace(c) == 0));
+
+            if (ok) {
+                REQUIRE(x * x + x == c);
+                ++solvable;
+            }
+        }
+
+        REQUIRE(solvable > 0);
+        REQUIRE(solvable < 1000);
+    }
+    SECTION("Half trace") {
+        if (TestType::gfDegree() % 2 == 1) {
+            for (size_t i = 0; i < 1000; ++i) {
+                TestType c(uid(rd));
+                TestType h = GFlinalg::halfTrace(c);
+
+                // H(c)^2 + H(c) = c + Tr(c)
+                REQUIRE(h * h + h + c == (GFlinalg::trace(c) ? naiveTrace(c) : TestType()));
+            }
+        } else {
+            REQUIRE_THROWS_AS(GFlinalg::halfTrace(TestType(1)), std::invalid_argument);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("Constant time and batch trace kernels", "[Trace]", TracePol3, TracePol8, TracePol13) {
+    std::default_random_engine rd;
+    std::uniform_int_distribution<uint32_t> uid(0, TestType::gfOrder() - 1);
+
+    std::vector<TestType> a;
+    for (size_t i = 0; i < 500; ++i)
+        a.emplace_back(uid(rd));
+
+    std::vector<TestType> out(a.size()), x(a.size());
+    std::vector<uint8_t> bits(a.size()), ok(a.size());
+
+    SECTION("Square root") {
+        GFlinalg::sqrt(a.data(), out.data(), a.size());
+
+        for (size_t i = 0; i < a.size(); ++i) {
+            REQUIRE(out[i] == GFlinalg::sqrt(a[i]));
+            REQUIRE(out[i] == GFlinalg::sqrtConstTime(a[i]));
+        }
+    }
+    SECTION("Trace and quadratic equation") {
+        GFlinalg::trace(a.data(), bits.data(), a.size());
+        GFlinalg::solveQuadratic(a.data(), x.data(), ok.data(), a.size());
+
+        for (size_t i = 0; i < a.size(); ++i) {
+            TestType y, z;
+
+            REQUIRE(bits[i] == GFlinalg::trace(a[i]));
+            REQUIRE(ok[i] == GFlinalg::solveQuadratic(a[i], y));
+            REQUIRE(ok[i] == GFlinalg::solveQuadraticConstTime(a[i], z));
+            REQUIRE(x[i] == y);
+            REQUIRE(x[i] == z);
+        }
+    }
+    SECTION("Half trace") {
+        if (TestType::gfDegree() % 2 == 1) {
+            GFlinalg::halfTrace(a.data(), out.data(), a.size());
+
+            for (size_t i = 0; i < a.size(); ++i) {
+                REQUIRE(out[i] == GFlinalg::halfTrace(a[i]));
+                REQUIRE(out[i] == GFlinalg::halfTraceConstTime(a[i]));
+            }
+        }
+    }
+}
+
+TEST_CASE("Trace kernels with a runtime modulus", "[Trace]") {
+    using Elem = GFlinalg::BasicGFElem<uint32_t>;
+
+    const uint32_t modPol = 0x201b;
+    std::default_random_engine rd;
+    std::uniform_int_distribution<uint32_t> uid(0, (1U << 13) - 1);
+
+    for (size_t i = 0; i < 1000; ++i) {
+        Elem c(uid(rd), modPol);
+        Elem x(0, modPol);
+
+        REQUIRE(GFlinalg::sqrt(c * c) == c);
+
+        if (GFlinalg::solveQuadratic(c, x))
+            REQUIRE(x * x + x == c);
+        else
+            REQUIRE(GFlinalg::trace(c) == 1);
+
+        Elem h = GFlinalg::halfTrace(c);
+        REQUIRE((h * h + h + c).val() == GFlinalg::trace(c));
+    }
+
+    REQUIRE(GFlinalg::op::FieldMaps<uint32_t>::get(modPol).traceMask() ==
+            GFlinalg::op::fieldMapsOf(TracePol13()).traceMask());
+    REQUIRE_THROWS_AS(GFlinalg::op::FieldMaps<uint32_t>(0x15), std::invalid_argument);
+    // (x^3 + x + 1)(x^3 + x^2 + 1) is squarefree, so x^(2^6) = x still holds
+    REQUIRE_THROWS_AS(GFlinalg::op::FieldMaps<uint32_t>(0x7f), std::invalid_argument);
+}
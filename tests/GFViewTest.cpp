@@ -0,0 +1,139 @@
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "catch.hpp"
+#include "GFBitMatrix.hpp"
+#include "GFSparse.hpp"
+#include "GFStrassen.hpp"
+#include "GFView.hpp"
+
+using Elem = GFlinalg::BasicBinPolynomial<uint16_t, 0x11d>;
+using Dense = GFlinalg::DenseMatrix<Elem>;
+
+static Dense randomMatrix(std::mt19937& rd, size_t rows, size_t cols) {
+    Dense res(rows, cols);
+
+    for (size_t i = 0; i < rows * cols; ++i)
+        res.data()[i] = static_cast<uint8_t>(rd());
+
+    return res;
+}
+
+TEST_CASE("Strided and gathered views", "[View]") {
+    std::vector<int> data(6 * 8);
+    std::iota(data.begin(), data.end(), 0);
+
+    // 5 x 7 part of a 6 x 8 array
+    auto v = GFlinalg::makeView(data.data(), 5, 7, 8);
+
+    REQUIRE(v(2, 3) == 19);
+    REQUIRE(v.contiguousRows());
+
+    SECTION("Submatrices") {
+        auto s = v.submatrix(1, 2, 3, 4);
+
+        REQUIRE(s.rows() == 3);
+        REQUIRE(s.columns() == 4);
+        REQUIRE(s(0, 0) == 10);
+        REQUIRE(s(2, 3) == 29);
+        REQUIRE(s.submatrix(1, 1, 2, 2)(1, 1) == 28);
+        REQUIRE(v.columnBlock(5, 2)(4, 1) == 38);
+
+        s(1, 1) = -1;
+
+        REQUIRE(data[19] == -1);
+        REQUIRE_THROWS_AS(v.submatrix(3, 0, 3, 1), std::out_of_range);
+        REQUIRE_THROWS_AS(v.submatrix(0, 6, 1, 2), std::out_of_range);
+    }
+
+    SECTION("Transpose") {
+        auto t = GFlinalg::transpose(v.submatrix(1, 2, 3, 4));
+
+        REQUIRE(t.rows() == 4);
+        REQUIRE(t.columns() == 3);
+        REQUIRE_FALSE(t.contiguousRows());
+        REQUIRE(t(3, 2) == 29);
+        REQUIRE(t.submatrix(1, 1, 2, 2)(0, 0) == 19);
+    }
+
+    SECTION("Gathered rows") {
+        const std::vector<size_t> rows{4, 0, 2};
+        auto g = GFlinalg::gatherRows(v.columnBlock(1, 5), rows);
+
+        REQUIRE(g.rows() == 3);
+        REQUIRE(g.columns() == 5);
+        REQUIRE(g(0, 0) == 33);
+        REQUIRE(g(1, 4) == 5);
+        REQUIRE(g(2, 2) == 19);
+
+        auto s = g.submatrix(1, 2, 2, 3);
+
+        REQUIRE(s(0, 0) == 3);
+        REQUIRE(s(1, 2) == 21);
+        REQUIRE_THROWS_AS(GFlinalg::gatherRows(v, {0, 5}), std::out_of_range);
+    }
+}
+
+TEST_CASE("Matrix algorithms on views", "[View]") {
+    std::mt19937 rd;
+
+    // Surviving rows of a generator times a column block of the data
+    Dense generator = randomMatrix(rd, 40, 24), data = randomMatrix(rd, 24, 300);
+    const std::vector<size_t> survivors{3, 39, 0, 17, 8, 22, 31, 5, 11, 12, 13, 36, 2, 7, 25, 28, 30, 1, 9, 33, 34, 21, 19, 38};
+    auto rows = GFlinalg::gatherRows(generator.view(), survivors);
+    auto block = data.view().columnBlock(100, 150);
+    const Dense expected = Dense::fromView(rows) * Dense::fromView(block);
+
+    REQUIRE(Dense::fromView(rows)(1, 5) == generator(39, 5));
+
+    SECTION("Product") {
+        Dense c(24, 150);
+
+        GFlinalg::multiply<Elem>(rows, block, c.view());
+
+        REQUIRE((c == expected));
+        REQUIRE_THROWS_AS(GFlinalg::multiply<Elem>(rows, block, c.view().columnBlock(0, 149)), std::invalid_argument);
+    }
+
+    SECTION("Strassen-Winograd into a submatrix") {
+        Dense big = randomMatrix(rd, 30, 160);
+        const Dense before = big;
+        auto target = big.view().submatrix(3, 5, 24, 150);
+
+        GFlinalg::op::Arena arena(GFlinalg::op::strassenWorkspace<uint8_t>(24, 24, 150, 4));
+        GFlinalg::strassen<Elem>(rows, block, target, arena, 4);
+
+        REQUIRE((Dense::fromView(target) == expected));
+
+        for (size_t i = 0; i < 30; ++i)
+            for (size_t j = 0; j < 160; ++j)
+                if (i < 3 || i >= 27 || j < 5 || j >= 155)
+                    REQUIRE(big(i, j) == before(i, j));
+    }
+
+    SECTION("Rows that are not contiguous") {
+        Dense bt = Dense::fromView(GFlinalg::transpose(block));
+        Dense c(24, 150);
+
+        GFlinalg::multiply<Elem>(rows, GFlinalg::transpose(bt.view()), c.view());
+
+        REQUIRE((c == expected));
+
+        // C^T = B^T * A^T, written through a transposed view
+        Dense copy = Dense::fromView(rows);
+
+        GFlinalg::multiply<Elem>(bt.view(), GFlinalg::transpose(copy.view()), GFlinalg::transpose(c.view()));
+
+        REQUIRE((c == expected));
+    }
+
+    SECTION("Sparse and bit matrices") {
+        auto csr = GFlinalg::CsrMatrix<Elem>::fromDense(rows);
+        auto csc = GFlinalg::CscMatrix<Elem>::fromDense(rows);
+
+        REQUIRE((csr.toDense() == Dense::fromView(rows).toElements()));
+        REQUIRE((csc.toDense() == Dense::fromView(rows).toElements()));
+        REQUIRE((GFlinalg::BitMatrix::expand<Elem>(rows) == GFlinalg::BitMatrix::expand(Dense::fromView(rows).toElements(), 24, 24)));
+    }
+}
@@ -0,0 +1,142 @@
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "catch.hpp"
+#include "GFWide.hpp"
+
+/**
+ * Shift-and-add multiplication with bitwise reduction by the full modulus.
+ */
+template <class Elem>
+static Elem naiveMul(const Elem& a, const Elem& b) {
+    constexpr size_t m = Elem::gfDegree();
+    constexpr size_t L = Elem::limbs;
+
+    typename Elem::Limbs res{}, cur = a.val();
+    typename Elem::Limbs mod{};
+
+    mod[0] = 1;
+    for (size_t k : Elem::getTaps())
+        mod[k / 64] ^= uint64_t(1) << (k % 64);
+
+    for (size_t bit = 0; bit < m; ++bit) {
+        if ((b.val()[bit / 64] >> (bit % 64)) & 1)
+            for (size_t i = 0; i < L; ++i)
+                res[i] ^= cur[i];
+
+        // cur *= x
+        bool carry = (cur[(m - 1) / 64] >> ((m - 1) % 64)) & 1;
+
+        for (size_t i = L; i-- > 1;)
+            cur[i] = (cur[i] << 1) | (cur[i - 1] >> 63);
+        cur[0] <<= 1;
+
+        if (m % 64)
+            cur[L - 1] &= (uint64_t(1) << (m % 64)) - 1;
+
+        if (carry)
+            for (size_t i = 0; i < L; ++i)
+                cur[i] ^= mod[i];
+    }
+
+    return Elem(res, false);
+}
+
+template <class Elem>
+static Elem randomWide(std::mt19937_64& rd) {
+    typename Elem::Limbs v;
+
+    for (auto& x : v)
+        x = rd();
+
+    if (Elem::gfDegree() % 64)
+        v[Elem::limbs - 1] &= (uint64_t(1) << (Elem::gfDegree() % 64)) - 1;
+
+    return Elem(v, false);
+}
+
+TEMPLATE_TEST_CASE("Multi-limb binary fields", "[WideBinPolynomial]", GFlinalg::GF2m163, GFlinalg::GF2m233,
+                   GFlinalg::GF2m283, GFlinalg::GF2m409, GFlinalg::GF2m571) {
+    std::mt19937_64 rd;
+    const TestType one(1);
+
+    SECTION("Multiplication") {
+        for (size_t i = 0; i < 100; ++i) {
+            TestType a = randomWide<TestType>(rd);
+            TestType b = randomWide<TestType>(rd);
+            TestType c = randomWide<TestType>(rd);
+
+            REQUIRE(a * b == naiveMul(a, b));
+            REQUIRE(a * b == b * a);
+            REQUIRE(a * (b + c) == a * b + a * c);
+            REQUIRE(a.square() == a * a);
+            REQUIRE(a * one == a);
+        }
+    }
+    SECTION("Reduction") {
+        // x^m = x^k1 + ... + 1
+        typename TestType::Limbs low{};
+
+        low[0] = 1;
+        for (size_t k : TestType::getTaps())
+            low[k / 64] ^= uint64_t(1) << (k % 64);
+
+        TestType xm = pow(TestType(2), TestType::gfDegree());
+        REQUIRE(xm == TestType(low, false));
+        REQUIRE(TestType(2).frobenius(TestType::gfDegree()) == TestType(2));
+    }
+    SECTION("Inversion") {
+        for (size_t i = 0; i < 20; ++i) {
+            TestType a = randomWide<TestType>(rd);
+
+            if (a.isZero())
+                continue;
+
+            REQUIRE(a * a.getInverse() == one);
+            REQUIRE((a / a) == one);
+        }
+
+        REQUIRE(TestType().getInverse() == TestType());
+        REQUIRE_THROWS_AS(one / TestType(), std::out_of_range);
+    }
+}
+
+TEST_CASE("Portable carry-less multiplication", "[WideBinPolynomial]") {
+    std::mt19937_64 rd;
+
+    for (size_t i = 0; i < 10000; ++i) {
+        uint64_t a = rd(), b = rd();
+        uint64_t lo = 0, hi = 0, plo, phi;
+
+        for (size_t j = 0; j < 64; ++j) {
+            if ((b >> j) & 1) {
+                lo ^= a << j;
+                hi ^= j ? a >> (64 - j) : 0;
+            }
+        }
+
+        GFlinalg::op::ClmulPortable::mul(a, b, plo, phi);
+        REQUIRE(plo == lo);
+        REQUIRE(phi == hi);
+
+        GFlinalg::op::clmul64(a, b, plo, phi);
+        REQUIRE(plo == lo);
+        REQUIRE(phi == hi);
+    }
+}
+
+TEST_CASE("Multi-limb element construction and output", "[WideBinPolynomial]") {
+    // x^163 reduces to x^7 + x^6 + x^3 + 1
+    std::vector<int> coefs(164, 0);
+    coefs[0] = 1;
+
+    GFlinalg::GF2m163 a(coefs.begin(), coefs.end());
+    REQUIRE(a == GFlinalg::GF2m163(0xC9));
+    REQUIRE(a.degree() == 7);
+
+    std::ostringstream out;
+    out << GFlinalg::GF2m163(0xC9);
+    REQUIRE(out.str() == "0x" + std::string(46, '0') + "c9");
+}
@@ -0,0 +1,140 @@
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "catch.hpp"
+#include "GFWiedemann.hpp"
+
+using Elem = GFlinalg::PowBinPolynomial<uint16_t, 0x11d>;
+using Csr = GFlinalg::CsrMatrix<Elem>;
+using Status = GFlinalg::WiedemannStatus;
+
+template <>
+const GFlinalg::LUTArrPair<uint16_t, 0x11d> Elem::alphaToIndex{};
+
+// Diagonal plus a few random entries per row, columns in skip are left empty; the status enum and
+// vectors of elements are compared in double parentheses, the stream operator of the elements is too greedy
+static Csr randomSparse(std::mt19937& rd, size_t n, size_t perRow, bool binary, const std::vector<size_t>& skip = {}) {
+    std::vector<std::tuple<size_t, size_t, Elem>> entries;
+
+    auto value = [&] { return Elem(static_cast<uint16_t>(binary ? 1 : rd() % 255 + 1)); };
+
+    for (size_t i = 0; i < n; ++i) {
+        entries.emplace_back(i, i, value());
+
+        for (size_t q = 0; q < perRow; ++q)
+            entries.emplace_back(i, rd() % n, value());
+    }
+
+    std::vector<std::tuple<size_t, size_t, Elem>> kept;
+
+    for (const auto& e : entries)
+        if (std::find(skip.begin(), skip.end(), std::get<1>(e)) == skip.end())
+            kept.push_back(e);
+
+    return Csr::fromTriplets(n, n, kept);
+}
+
+static std::vector<Elem> randomVector(std::mt19937& rd, size_t n, bool binary) {
+    std::vector<Elem> res;
+
+    for (size_t i = 0; i < n; ++i)
+        res.push_back(Elem(static_cast<uint16_t>(binary ? rd() & 1 : rd() % 256)));
+
+    return res;
+}
+
+TEST_CASE("Polynomial helpers", "[Wiedemann]") {
+    using GFlinalg::op::polyGcd;
+    using GFlinalg::op::polyLcm;
+    using GFlinalg::op::polyMul;
+
+    std::vector<Elem> a{Elem(3), Elem(1)}, b{Elem(5), Elem(1)}, c{Elem(7), Elem(9), Elem(1)};
+
+    auto ab = polyMul(a, b), ac = polyMul(a, c);
+
+    REQUIRE((polyGcd(ab, ac) == a));
+    REQUIRE((polyLcm(ab, ac) == polyMul(ab, c)));
+    REQUIRE((polyLcm(a, a) == a));
+}
+
+TEST_CASE("Wiedemann solver", "[Wiedemann]") {
+    std::mt19937 rd(11);
+    const size_t n = 200;
+
+    SECTION("Nonsingular system") {
+        Csr a = randomSparse(rd, n, 4, false);
+        auto x = randomVector(rd, n, false);
+        auto b = a.multiply(x);
+
+        GFlinalg::WiedemannSolver<Elem> solver(a);
+        auto res = solver.solve(b);
+
+        REQUIRE((res.status == Status::Solution));
+        REQUIRE((a.multiply(res.vector) == b));
+        REQUIRE((solver.nullspace().status == Status::Failed));
+    }
+
+    SECTION("Singular system") {
+        Csr a = randomSparse(rd, n, 4, false, {7, 100});
+        GFlinalg::WiedemannSolver<Elem> solver(a, 2);
+        auto res = solver.nullspace();
+
+        REQUIRE((res.status == Status::Nullspace));
+        REQUIRE(std::any_of(res.vector.begin(), res.vector.end(), [](const Elem& e) { return e.val() != 0; }));
+        REQUIRE((a.multiply(res.vector) == std::vector<Elem>(n, Elem(0))));
+
+        // A consistent right hand side still gives a solution or a null vector
+        auto b = a.multiply(randomVector(rd, n, false));
+        auto sol = solver.solve(b);
+
+        REQUIRE((sol.status != Status::Failed));
+        REQUIRE((a.multiply(sol.vector) == (sol.status == Status::Solution ? b : std::vector<Elem>(n, Elem(0)))));
+    }
+
+    SECTION("Binary system") {
+        Csr a = randomSparse(rd, n, 3, true);
+        auto b = a.multiply(randomVector(rd, n, true));
+
+        GFlinalg::WiedemannSolver<Elem> solver(a, 4, 1);
+        auto res = solver.solveBinary(b);
+
+        REQUIRE((res.status != Status::Failed));
+
+        for (const auto& e : res.vector)
+            REQUIRE(e.val() <= 1);
+
+        REQUIRE((a.multiply(res.vector) == (res.status == Status::Solution ? b : std::vector<Elem>(n, Elem(0)))));
+
+        REQUIRE_THROWS_AS(solver.solveBinary(std::vector<Elem>(n, Elem(2))), std::invalid_argument);
+    }
+
+    SECTION("Threads") {
+        Csr a = randomSparse(rd, n, 4, false);
+        auto b = a.multiply(randomVector(rd, n, false));
+
+        // A small matrix only runs on several threads with a lower threshold
+        REQUIRE(GFlinalg::WiedemannSolver<Elem>(a, 4, 4).threads() == 1);
+
+        GFlinalg::WiedemannSolver<Elem> serial(a, 4, 1), threaded(a, 4, 4, 1, 1);
+
+        REQUIRE(threaded.threads() == 4);
+
+        auto res = threaded.solve(b);
+
+        REQUIRE((res.status == Status::Solution));
+        REQUIRE((a.multiply(res.vector) == b));
+        REQUIRE((res.vector == serial.solve(b).vector));
+
+        Csr singular = randomSparse(rd, n, 4, false, {3, 150});
+        GFlinalg::WiedemannSolver<Elem> nullspace(singular, 4, 3, 1, 1);
+        auto null = nullspace.nullspace();
+
+        REQUIRE(nullspace.threads() == 3);
+        REQUIRE((null.status == Status::Nullspace));
+        REQUIRE((singular.multiply(null.vector) == std::vector<Elem>(n, Elem(0))));
+    }
+
+    REQUIRE_THROWS_AS(GFlinalg::WiedemannSolver<Elem>(Csr(3, 4)), std::invalid_argument);
+    REQUIRE_THROWS_AS(GFlinalg::WiedemannSolver<Elem>(Csr(3, 3), 0), std::invalid_argument);
+}
@@ -5,6 +5,29 @@
 #include <string>
 #include "GFSPlinalg.hpp"
 #include "GFTPlinalg.hpp"
+#include "GFScope.hpp"
+#include "GFBitslice.hpp"
+#include "GFComposite.hpp"
+#include "GFNormalBasis.hpp"
+#include "GFTrace.hpp"
+#include "GFModulus.hpp"
+#include "GFWide.hpp"
+#include "GFGhash.hpp"
+#include "GFCrc.hpp"
+#include "GFRabin.hpp"
+#include "GFLfsr.hpp"
+#include "GFBerlekampMassey.hpp"
+#include "GFNetworkCoding.hpp"
+#include "GFShamir.hpp"
+#include "GFBch.hpp"
+#include "GFChien.hpp"
+#include "GFReedSolomon.hpp"
+#include "GFSparse.hpp"
+#include "GFStructuredGauss.hpp"
+#include "GFWiedemann.hpp"
+#include "GFBitMatrix.hpp"
+#include "GFCauchy.hpp"
+#include "GFStrassen.hpp"
 
 typedef GFlinalg::BasicBinPolynomial<uint8_t, 11> basicPol8;
 typedef GFlinalg::PowBinPolynomial<uint8_t, 11> powPol8;
@@ -40,6 +63,25 @@ const tablePol32::GFtable tablePol32::mulTable = tablePol32::makeMulTable();
 template<>                                     
 const tablePol32::GFtable tablePol32::divTable = tablePol32::makeInvMulTable();
 
+typedef GFlinalg::PowBinPolynomial<uint16_t, 0x11d> powPol256;
+template<>
+const GFlinalg::LUTArrPair<uint16_t, 0x11d> powPol256::alphaToIndex{};
+
+typedef GFlinalg::TableBinPolynomial<uint16_t, 0x11d> tablePol256;
+template<>
+const tablePol256::GFtable tablePol256::mulTable = tablePol256::makeMulTable();
+template<>
+const tablePol256::GFtable tablePol256::divTable = tablePol256::makeInvMulTable();
+
+typedef GFlinalg::TableBinPolynomial<uint8_t, 19> tablePol16x;
+template<>
+const tablePol16x::GFtable tablePol16x::mulTable = tablePol16x::makeMulTable();
+template<>
+const tablePol16x::GFtable tablePol16x::divTable = tablePol16x::makeInvMulTable();
+
+typedef GFlinalg::CompositeGFElem<GFlinalg::BasicBinPolynomial<uint8_t, 19>, 8> compositeBasic;
+typedef GFlinalg::CompositeGFElem<tablePol16x, 8> compositeTable;
+
 template <class Pol>
 static void BM_Reduction(benchmark::State& state) {
     Pol testVal(0);
@@ -153,6 +195,961 @@ BENCHMARK_TEMPLATE(BM_Div, basicPol32);
 BENCHMARK_TEMPLATE(BM_Div, powPol32);
 BENCHMARK_TEMPLATE(BM_Div, tablePol32);
 
+static void BM_ElemMulBatch(benchmark::State& state) {
+    GFlinalg::LUTVectPair<uint16_t> lut(0x11d);
+    std::vector<GFlinalg::PowGFElem<uint16_t>> a, b;
+    std::uniform_int_distribution<uint16_t> uid(0, 255);
+    std::default_random_engine rd;
+    for (size_t i = 0; i < 4096; ++i) {
+        a.emplace_back(uid(rd), 0x11d, &lut);
+        b.emplace_back(uid(rd), 0x11d, &lut);
+    }
+    for (auto _ : state) {
+        for (size_t i = 0; i < a.size(); ++i)
+            a[i] = a[i] * b[i];
+        benchmark::DoNotOptimize(a.data());
+    }
+    state.SetItemsProcessed(state.iterations() * a.size());
+}
+BENCHMARK(BM_ElemMulBatch);
+
+static void BM_ScopeMulBatch(benchmark::State& state) {
+    GFlinalg::GFScope<uint16_t> scope(0x11d);
+    std::vector<uint16_t> a(4096), b(4096);
+    std::uniform_int_distribution<uint16_t> uid(0, 255);
+    std::default_random_engine rd;
+    for (size_t i = 0; i < a.size(); ++i) {
+        a[i] = uid(rd);
+        b[i] = uid(rd);
+    }
+    for (auto _ : state) {
+        scope.mul(a.data(), b.data(), a.data(), a.size());
+        benchmark::DoNotOptimize(a.data());
+    }
+    state.SetItemsProcessed(state.iterations() * a.size());
+}
+BENCHMARK(BM_ScopeMulBatch);
+
+static std::vector<uint8_t> randomBytes(size_t n, uint8_t min = 0) {
+    std::vector<uint8_t> out(n);
+    std::uniform_int_distribution<uint16_t> uid(min, 255);
+    std::default_random_engine rd;
+    for (auto& x : out)
+        x = static_cast<uint8_t>(uid(rd));
+    return out;
+}
+
+static void BM_LUTMulBytes(benchmark::State& state) {
+    auto a = randomBytes(1 << 16);
+    auto b = randomBytes(1 << 16);
+    std::vector<uint8_t> out(a.size());
+    for (auto _ : state) {
+        for (size_t i = 0; i < a.size(); ++i)
+            out[i] = static_cast<uint8_t>((powPol256(a[i]) * powPol256(b[i])).val());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetBytesProcessed(state.iterations() * a.size());
+}
+BENCHMARK(BM_LUTMulBytes);
+
+static void BM_LUTInverseBytes(benchmark::State& state) {
+    auto a = randomBytes(1 << 16, 1);
+    std::vector<uint8_t> out(a.size());
+    for (auto _ : state) {
+        for (size_t i = 0; i < a.size(); ++i)
+            out[i] = static_cast<uint8_t>((powPol256(1) / powPol256(a[i])).val());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetBytesProcessed(state.iterations() * a.size());
+}
+BENCHMARK(BM_LUTInverseBytes);
+
+template <size_t Lanes>
+static void BM_BitsliceMulBytes(benchmark::State& state) {
+    auto a = randomBytes(1 << 16);
+    auto b = randomBytes(1 << 16);
+    std::vector<uint8_t> out(a.size());
+    for (auto _ : state) {
+        GFlinalg::BitsliceGF256<0x11d, Lanes>::mul(a.data(), b.data(), out.data(), a.size());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetBytesProcessed(state.iterations() * a.size());
+}
+BENCHMARK_TEMPLATE(BM_BitsliceMulBytes, 64);
+BENCHMARK_TEMPLATE(BM_BitsliceMulBytes, 128);
+BENCHMARK_TEMPLATE(BM_BitsliceMulBytes, 256);
+
+template <size_t Lanes>
+static void BM_BitsliceInverseBytes(benchmark::State& state) {
+    auto a = randomBytes(1 << 16, 1);
+    std::vector<uint8_t> out(a.size());
+    for (auto _ : state) {
+        GFlinalg::BitsliceGF256<0x11d, Lanes>::inverse(a.data(), out.data(), a.size());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetBytesProcessed(state.iterations() * a.size());
+}
+BENCHMARK_TEMPLATE(BM_BitsliceInverseBytes, 64);
+BENCHMARK_TEMPLATE(BM_BitsliceInverseBytes, 128);
+BENCHMARK_TEMPLATE(BM_BitsliceInverseBytes, 256);
+
+template <class Elem>
+static std::vector<Elem> randomElems(size_t n, uint8_t min = 0) {
+    std::vector<Elem> out;
+    for (uint8_t x : randomBytes(n, min))
+        out.emplace_back(x);
+    return out;
+}
+
+template <class Elem>
+static void BM_Mul256(benchmark::State& state) {
+    auto a = randomElems<Elem>(4096);
+    auto b = randomElems<Elem>(4096);
+    std::vector<Elem> out(a);
+    for (auto _ : state) {
+        for (size_t i = 0; i < a.size(); ++i)
+            out[i] = a[i] * b[i];
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * a.size());
+}
+BENCHMARK_TEMPLATE(BM_Mul256, powPol256);
+BENCHMARK_TEMPLATE(BM_Mul256, tablePol256);
+BENCHMARK_TEMPLATE(BM_Mul256, compositeBasic);
+BENCHMARK_TEMPLATE(BM_Mul256, compositeTable);
+
+template <class Elem>
+static void BM_Inverse256(benchmark::State& state) {
+    auto a = randomElems<Elem>(4096, 1);
+    std::vector<Elem> out(a);
+    Elem one(static_cast<uint8_t>(1));
+    for (auto _ : state) {
+        for (size_t i = 0; i < a.size(); ++i)
+            out[i] = one / a[i];
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * a.size());
+}
+BENCHMARK_TEMPLATE(BM_Inverse256, powPol256);
+BENCHMARK_TEMPLATE(BM_Inverse256, tablePol256);
+BENCHMARK_TEMPLATE(BM_Inverse256, compositeBasic);
+BENCHMARK_TEMPLATE(BM_Inverse256, compositeTable);
+
+static void BM_CompositeConversion(benchmark::State& state) {
+    const auto& iso = GFlinalg::CompositeIsomorphism<compositeTable, 0x11d>::get();
+    auto a = randomBytes(1 << 16);
+    std::vector<uint8_t> out(a.size());
+    for (auto _ : state) {
+        iso.toComposite(a.data(), out.data(), a.size());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetBytesProcessed(state.iterations() * a.size());
+}
+BENCHMARK(BM_CompositeConversion);
+
+typedef GFlinalg::BasicBinPolynomial<uint16_t, 0x409> basicPol10;
+typedef GFlinalg::NormalBinPolynomial<uint16_t, 0x409> normalPol10;
+
+BENCHMARK_TEMPLATE(BM_Mul, basicPol10);
+BENCHMARK_TEMPLATE(BM_Mul, normalPol10);
+
+template <class Pol>
+static void BM_Square(benchmark::State& state) {
+    Pol temp(0);
+    std::uniform_int_distribution<uint32_t> uid(0, (1 << Pol::gfDegree()) - 1);
+    std::default_random_engine rd;
+    for (auto _ : state) {
+        Pol a(uid(rd));
+        if constexpr (std::is_same_v<Pol, normalPol10>)
+            benchmark::DoNotOptimize(temp = a.square());
+        else
+            benchmark::DoNotOptimize(temp = a * a);
+    }
+}
+BENCHMARK_TEMPLATE(BM_Square, basicPol10);
+BENCHMARK_TEMPLATE(BM_Square, normalPol10);
+
+typedef GFlinalg::BasicBinPolynomial<uint16_t, 0x201b> basicPol13;
+
+template <class Pol>
+static std::vector<Pol> randomField(size_t n) {
+    std::uniform_int_distribution<uint32_t> uid(0, Pol::gfOrder() - 1);
+    std::default_random_engine rd;
+    std::vector<Pol> out;
+    for (size_t i = 0; i < n; ++i)
+        out.emplace_back(uid(rd));
+    return out;
+}
+
+template <class Pol>
+static void BM_Trace(benchmark::State& state) {
+    auto a = randomField<Pol>(4096);
+    std::vector<uint8_t> out(a.size());
+    for (auto _ : state) {
+        for (size_t i = 0; i < a.size(); ++i)
+            out[i] = GFlinalg::trace(a[i]);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * a.size());
+}
+BENCHMARK_TEMPLATE(BM_Trace, basicPol13);
+BENCHMARK_TEMPLATE(BM_Trace, normalPol10);
+
+// Square root as a^(2^(n-1)) with field multiplications, the baseline for the linear map
+static void BM_SqrtPow(benchmark::State& state) {
+    auto a = randomField<basicPol13>(4096);
+    std::vector<basicPol13> out(a);
+    for (auto _ : state) {
+        for (size_t i = 0; i < a.size(); ++i) {
+            basicPol13 r = a[i];
+            for (size_t k = 1; k < basicPol13::gfDegree(); ++k)
+                r = r * r;
+            out[i] = r;
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * a.size());
+}
+BENCHMARK(BM_SqrtPow);
+
+static void BM_SqrtBatch(benchmark::State& state) {
+    auto a = randomField<basicPol13>(4096);
+    std::vector<basicPol13> out(a);
+    for (auto _ : state) {
+        GFlinalg::sqrt(a.data(), out.data(), a.size());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * a.size());
+}
+BENCHMARK(BM_SqrtBatch);
+
+static void BM_SqrtConstTime(benchmark::State& state) {
+    auto a = randomField<basicPol13>(4096);
+    std::vector<basicPol13> out(a);
+    for (auto _ : state) {
+        for (size_t i = 0; i < a.size(); ++i)
+            out[i] = GFlinalg::sqrtConstTime(a[i]);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * a.size());
+}
+BENCHMARK(BM_SqrtConstTime);
+
+static void BM_HalfTraceBatch(benchmark::State& state) {
+    auto a = randomField<basicPol13>(4096);
+    std::vector<basicPol13> out(a);
+    for (auto _ : state) {
+        GFlinalg::halfTrace(a.data(), out.data(), a.size());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * a.size());
+}
+BENCHMARK(BM_HalfTraceBatch);
+
+template <class Pol>
+static void BM_SolveQuadratic(benchmark::State& state) {
+    auto c = randomField<Pol>(4096);
+    std::vector<Pol> x(c);
+    std::vector<uint8_t> ok(c.size());
+    for (auto _ : state) {
+        for (size_t i = 0; i < c.size(); ++i)
+            ok[i] = GFlinalg::solveQuadratic(c[i], x[i]);
+        benchmark::DoNotOptimize(x.data());
+        benchmark::DoNotOptimize(ok.data());
+    }
+    state.SetItemsProcessed(state.iterations() * c.size());
+}
+BENCHMARK_TEMPLATE(BM_SolveQuadratic, basicPol13);
+BENCHMARK_TEMPLATE(BM_SolveQuadratic, normalPol10);
+
+static void BM_SolveQuadraticBatch(benchmark::State& state) {
+    auto c = randomField<basicPol13>(4096);
+    std::vector<basicPol13> x(c);
+    std::vector<uint8_t> ok(c.size());
+    for (auto _ : state) {
+        GFlinalg::solveQuadratic(c.data(), x.data(), ok.data(), c.size());
+        benchmark::DoNotOptimize(x.data());
+    }
+    state.SetItemsProcessed(state.iterations() * c.size());
+}
+BENCHMARK(BM_SolveQuadraticBatch);
+
+static void BM_IsIrreducible64(benchmark::State& state) {
+    std::mt19937_64 rd;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(GFlinalg::op::isIrreducible(rd() | 1, 64));
+}
+BENCHMARK(BM_IsIrreducible64);
+
+static void BM_IsPrimitive64(benchmark::State& state) {
+    for (auto _ : state)
+        benchmark::DoNotOptimize(GFlinalg::op::isPrimitive(0x1b, 64));
+}
+BENCHMARK(BM_IsPrimitive64);
+
+static void BM_LowestWeightSearch(benchmark::State& state) {
+    for (auto _ : state)
+        benchmark::DoNotOptimize(GFlinalg::op::findLowestWeightModuli(
+            64, GFlinalg::op::ModulusKind::Primitive, 16, static_cast<unsigned>(state.range(0))));
+}
+BENCHMARK(BM_LowestWeightSearch)->Arg(1)->Arg(4)->Unit(benchmark::kMillisecond);
+
+static void BM_RuntimeElemConstruction(benchmark::State& state) {
+    uint8_t v = 0;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(GFlinalg::BasicGFElem<uint8_t>(++v & 7, 11));
+}
+BENCHMARK(BM_RuntimeElemConstruction);
+
+template <class Elem>
+static std::vector<Elem> randomWide(size_t n) {
+    std::mt19937_64 rd;
+    std::vector<Elem> out;
+    for (size_t i = 0; i < n; ++i) {
+        typename Elem::Limbs v;
+        for (auto& x : v)
+            x = rd();
+        out.emplace_back(v);
+    }
+    return out;
+}
+
+template <class Elem>
+static void BM_WideMul(benchmark::State& state) {
+    auto a = randomWide<Elem>(256);
+    auto b = randomWide<Elem>(256);
+    std::vector<Elem> out(a);
+    for (auto _ : state) {
+        for (size_t i = 0; i < a.size(); ++i)
+            out[i] = a[i] * b[i];
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * a.size());
+}
+BENCHMARK_TEMPLATE(BM_WideMul, GFlinalg::GF2m163);
+BENCHMARK_TEMPLATE(BM_WideMul, GFlinalg::GF2m233);
+BENCHMARK_TEMPLATE(BM_WideMul, GFlinalg::GF2m283);
+BENCHMARK_TEMPLATE(BM_WideMul, GFlinalg::GF2m409);
+BENCHMARK_TEMPLATE(BM_WideMul, GFlinalg::GF2m571);
+
+template <class Elem>
+static void BM_WideSquare(benchmark::State& state) {
+    auto a = randomWide<Elem>(256);
+    std::vector<Elem> out(a);
+    for (auto _ : state) {
+        for (size_t i = 0; i < a.size(); ++i)
+            out[i] = a[i].square();
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * a.size());
+}
+BENCHMARK_TEMPLATE(BM_WideSquare, GFlinalg::GF2m163);
+BENCHMARK_TEMPLATE(BM_WideSquare, GFlinalg::GF2m571);
+
+template <class Elem>
+static void BM_WideInverse(benchmark::State& state) {
+    auto a = randomWide<Elem>(16);
+    std::vector<Elem> out(a);
+    for (auto _ : state) {
+        for (size_t i = 0; i < a.size(); ++i)
+            out[i] = a[i].getInverse();
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * a.size());
+}
+BENCHMARK_TEMPLATE(BM_WideInverse, GFlinalg::GF2m163);
+BENCHMARK_TEMPLATE(BM_WideInverse, GFlinalg::GF2m233);
+BENCHMARK_TEMPLATE(BM_WideInverse, GFlinalg::GF2m283);
+BENCHMARK_TEMPLATE(BM_WideInverse, GFlinalg::GF2m409);
+BENCHMARK_TEMPLATE(BM_WideInverse, GFlinalg::GF2m571);
+
+static void BM_ClmulPortable(benchmark::State& state) {
+    std::mt19937_64 rd;
+    uint64_t a = rd(), b = rd(), lo, hi;
+    for (auto _ : state) {
+        GFlinalg::op::ClmulPortable::mul(a, b, lo, hi);
+        benchmark::DoNotOptimize(a = lo ^ hi);
+    }
+}
+BENCHMARK(BM_ClmulPortable);
+
+static void BM_Clmul(benchmark::State& state) {
+    std::mt19937_64 rd;
+    uint64_t a = rd(), b = rd(), lo, hi;
+    for (auto _ : state) {
+        GFlinalg::op::clmul64(a, b, lo, hi);
+        benchmark::DoNotOptimize(a = lo ^ hi);
+    }
+}
+BENCHMARK(BM_Clmul);
+
+typedef GFlinalg::BasicBinPolynomial<uint32_t, 0x20009> sparsePol17;
+typedef GFlinalg::BasicBinPolynomial<uint32_t, 0x27fef> densePol17;
+
+template <class Pol>
+static void BM_ReduceWord(benchmark::State& state) {
+    std::mt19937 rd;
+    std::vector<uint32_t> v(1024);
+    for (auto& x : v)
+        x = rd();
+    Pol a(0);
+    for (auto _ : state) {
+        for (uint32_t x : v) {
+            a.val() = x;
+            benchmark::DoNotOptimize(a.reduce());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * v.size());
+}
+BENCHMARK_TEMPLATE(BM_ReduceWord, sparsePol17);
+BENCHMARK_TEMPLATE(BM_ReduceWord, densePol17);
+
+template <class Pol>
+static void BM_MulBatch(benchmark::State& state) {
+    auto a = randomField<Pol>(1024);
+    auto b = randomField<Pol>(1024);
+    std::vector<Pol> out(a);
+    for (auto _ : state) {
+        for (size_t i = 0; i < a.size(); ++i)
+            out[i] = a[i] * b[i];
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * a.size());
+}
+BENCHMARK_TEMPLATE(BM_MulBatch, sparsePol17);
+BENCHMARK_TEMPLATE(BM_MulBatch, densePol17);
+
+static void BM_RuntimeMulBatch(benchmark::State& state) {
+    using Elem = GFlinalg::BasicGFElem<uint32_t>;
+    const uint32_t modPol = state.range(0);
+    std::mt19937 rd;
+    std::vector<Elem> a, b;
+    for (size_t i = 0; i < 1024; ++i) {
+        a.emplace_back(rd(), modPol);
+        b.emplace_back(rd(), modPol);
+    }
+    std::vector<Elem> out(a);
+    for (auto _ : state) {
+        for (size_t i = 0; i < a.size(); ++i)
+            out[i] = a[i] * b[i];
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * a.size());
+}
+BENCHMARK(BM_RuntimeMulBatch)->Arg(0x20009)->Arg(0x27fef);
+
+static void BM_Ghash(benchmark::State& state) {
+    std::mt19937_64 rd;
+    std::vector<uint8_t> data(state.range(0));
+    for (auto& b : data)
+        b = static_cast<uint8_t>(rd());
+    GFlinalg::GhashHasher hasher(GFlinalg::GcmBinPolynomial(rd(), rd()));
+    for (auto _ : state) {
+        hasher.reset();
+        benchmark::DoNotOptimize(hasher.update(data).digest());
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_Ghash)->Arg(1 << 10)->Arg(1 << 16);
+
+static void BM_GhashSerial(benchmark::State& state) {
+    std::mt19937_64 rd;
+    std::vector<uint8_t> data(state.range(0));
+    for (auto& b : data)
+        b = static_cast<uint8_t>(rd());
+    GFlinalg::GcmBinPolynomial h(rd(), rd());
+    for (auto _ : state) {
+        GFlinalg::GcmBinPolynomial y;
+        for (size_t i = 0; i < data.size(); i += 16)
+            y = (y + GFlinalg::GcmBinPolynomial::fromBytes(data.data() + i)) * h;
+        benchmark::DoNotOptimize(y);
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_GhashSerial)->Arg(1 << 16);
+
+static void BM_Crc32(benchmark::State& state) {
+    static const GFlinalg::CrcEngine<uint64_t, 0x104C11DB7> crc(true, 0xFFFFFFFF, 0xFFFFFFFF);
+    std::mt19937_64 rd;
+    std::vector<uint8_t> data(1 << 16);
+    for (auto& b : data)
+        b = static_cast<uint8_t>(rd());
+    auto method = static_cast<GFlinalg::CrcMethod>(state.range(0));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(crc.checksum(data.data(), data.size(), method));
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_Crc32)->DenseRange(0, 2);
+
+typedef GFlinalg::RabinFingerprint<uint64_t, 0x20000000000047> rabin53;
+
+static void BM_RabinRoll(benchmark::State& state) {
+    static const rabin53 rabin(48);
+    std::mt19937_64 rd;
+    std::vector<uint8_t> data(1 << 16);
+    for (auto& b : data)
+        b = static_cast<uint8_t>(rd());
+    GFlinalg::RabinWindow<rabin53> window(rabin);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(window.slide(data.data(), data.size()));
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_RabinRoll);
+
+static void BM_RabinChunking(benchmark::State& state) {
+    static const rabin53 rabin(48);
+    std::mt19937_64 rd;
+    std::vector<uint8_t> data(1 << 22);
+    for (auto& b : data)
+        b = static_cast<uint8_t>(rd());
+    GFlinalg::RabinChunker<rabin53> chunker(rabin, state.range(0), 8192, 65536);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(chunker.split(data.data(), data.size()));
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_RabinChunking)->Arg(64)->Arg(2048);
+
+template <class Gen>
+static void BM_LfsrGenerate(benchmark::State& state) {
+    Gen gen(1);
+    std::vector<uint8_t> out(1 << 16);
+    for (auto _ : state) {
+        gen.generate(out.data(), out.size());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetBytesProcessed(state.iterations() * out.size());
+}
+BENCHMARK_TEMPLATE(BM_LfsrGenerate, GFlinalg::Lfsr<uint64_t, 0x900000000000f12d>);
+BENCHMARK_TEMPLATE(BM_LfsrGenerate, GFlinalg::Lfsr<uint64_t, 0x8000000000000003>);
+
+static void BM_LfsrJump(benchmark::State& state) {
+    GFlinalg::Lfsr<uint64_t, 0x8000000000000003> gen(1);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(gen.jump(0x123456789abcdefULL).state());
+}
+BENCHMARK(BM_LfsrJump);
+
+static void BM_BerlekampMasseyGF2(benchmark::State& state) {
+    std::mt19937 rd;
+    std::vector<uint8_t> bits(state.range(0) / 8);
+    for (auto& b : bits)
+        b = static_cast<uint8_t>(rd());
+    for (auto _ : state) {
+        GFlinalg::BerlekampMasseyGF2 bm;
+        bm.update(bits.data(), state.range(0));
+        benchmark::DoNotOptimize(bm.complexity());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BerlekampMasseyGF2)->Arg(1 << 10)->Arg(1 << 14);
+
+static void BM_BerlekampMasseyField(benchmark::State& state) {
+    using Elem = GFlinalg::BasicBinPolynomial<uint8_t, 0x3>;
+    std::mt19937 rd;
+    std::vector<Elem> bits;
+    for (int64_t i = 0; i < state.range(0); ++i)
+        bits.emplace_back(rd() & 1);
+    for (auto _ : state) {
+        GFlinalg::BerlekampMassey<Elem> bm;
+        bm.update(bits.begin(), bits.end());
+        benchmark::DoNotOptimize(bm.complexity());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BerlekampMasseyField)->Arg(1 << 10);
+
+static void BM_RlncEncode(benchmark::State& state) {
+    const size_t symbols = state.range(0), symbolSize = 1024;
+    std::vector<uint8_t> data(symbols * symbolSize, 0x5a);
+    GFlinalg::RlncEncoder<uint16_t, 0x11d> enc(data.data(), symbols, symbolSize);
+    std::vector<uint8_t> packet(enc.packetSize());
+    for (auto _ : state) {
+        enc.encode(packet.data());
+        benchmark::DoNotOptimize(packet.data());
+    }
+    state.SetBytesProcessed(state.iterations() * symbolSize);
+}
+BENCHMARK(BM_RlncEncode)->Arg(16)->Arg(64)->Arg(256);
+
+static void BM_RlncDecode(benchmark::State& state) {
+    const size_t symbols = state.range(0), symbolSize = 1024;
+    std::mt19937 rd;
+    std::vector<uint8_t> data(symbols * symbolSize);
+    for (auto& b : data)
+        b = static_cast<uint8_t>(rd());
+    GFlinalg::RlncEncoder<uint16_t, 0x11d> enc(data.data(), symbols, symbolSize);
+    std::vector<uint8_t> packets(enc.packetSize() * (symbols + 8));
+    for (size_t i = 0; i < symbols + 8; ++i)
+        enc.encode(packets.data() + i * enc.packetSize());
+    for (auto _ : state) {
+        GFlinalg::RlncDecoder<uint16_t, 0x11d> dec(symbols, symbolSize);
+        for (size_t i = 0; !dec.complete(); ++i)
+            dec.consume(packets.data() + i * enc.packetSize());
+        benchmark::DoNotOptimize(dec.symbol(0));
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_RlncDecode)->Arg(16)->Arg(64)->Arg(256);
+
+static void BM_ShamirSplit(benchmark::State& state) {
+    const size_t size = 1 << 16, n = 5;
+    const uint8_t ids[n] = {1, 2, 3, 4, 5};
+    GFlinalg::ShamirSharing<uint16_t, 0x11b> sharing(state.range(0));
+    std::mt19937_64 rd;
+    std::vector<uint8_t> secret(size, 0x17), shares(n * size);
+    for (auto _ : state) {
+        sharing.split(secret.data(), size, ids, n, shares.data(), rd);
+        benchmark::DoNotOptimize(shares.data());
+    }
+    state.SetBytesProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_ShamirSplit)->Arg(2)->Arg(5);
+
+static void BM_ShamirCombine(benchmark::State& state) {
+    const size_t size = 1 << 16, n = 5;
+    const uint8_t ids[n] = {1, 2, 3, 4, 5};
+    GFlinalg::ShamirSharing<uint16_t, 0x11b> sharing(state.range(0));
+    std::mt19937_64 rd;
+    std::vector<uint8_t> secret(size, 0x17), shares(n * size);
+    sharing.split(secret.data(), size, ids, n, shares.data(), rd);
+    for (auto _ : state) {
+        sharing.combine(ids, n, shares.data(), size, secret.data());
+        benchmark::DoNotOptimize(secret.data());
+    }
+    state.SetBytesProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_ShamirCombine)->Arg(2)->Arg(5);
+
+template <class Code>
+static void BM_BchEncode(benchmark::State& state) {
+    const Code code(state.range(0), state.range(1));
+    std::vector<uint8_t> data(code.dataBytes(), 0x3c), parity(code.parityBytes());
+    for (auto _ : state) {
+        code.encode(data.data(), parity.data());
+        benchmark::DoNotOptimize(parity.data());
+    }
+    state.counters["bits"] = benchmark::Counter(8.0 * data.size() * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK_TEMPLATE(BM_BchEncode, GFlinalg::BchCode<uint16_t, 0x201b>)->Args({8, 512});
+BENCHMARK_TEMPLATE(BM_BchEncode, GFlinalg::BchCode<uint16_t, 0x4443>)->Args({40, 1024});
+
+/**
+ * Decoding with range(2) bit errors at fixed positions, restored after every iteration.
+ */
+template <class Code>
+static void BM_BchDecode(benchmark::State& state) {
+    const Code code(state.range(0), state.range(1));
+    std::vector<uint8_t> data(code.dataBytes(), 0x3c), parity(code.parityBytes());
+    code.encode(data.data(), parity.data());
+    for (auto _ : state) {
+        for (int64_t i = 0; i < state.range(2); ++i)
+            data[(i * 97) % data.size()] ^= 1;
+        benchmark::DoNotOptimize(code.decode(data.data(), parity.data()));
+    }
+    state.counters["bits"] = benchmark::Counter(8.0 * data.size() * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK_TEMPLATE(BM_BchDecode, GFlinalg::BchCode<uint16_t, 0x201b>)->Args({8, 512, 0})->Args({8, 512, 8});
+BENCHMARK_TEMPLATE(BM_BchDecode, GFlinalg::BchCode<uint16_t, 0x4443>)->Args({40, 1024, 0})->Args({40, 1024, 40});
+
+static std::vector<uint16_t> randomLocator(std::mt19937& rd, size_t degree, size_t order) {
+    std::vector<uint16_t> res(degree + 1);
+    for (auto& c : res)
+        c = static_cast<uint16_t>(rd() % order + 1);
+    return res;
+}
+
+static void BM_ChienSearch(benchmark::State& state) {
+    GFlinalg::ChienSearch search(0x201b, 64);
+    std::mt19937 rd;
+    auto locator = randomLocator(rd, state.range(0), search.order());
+    for (auto _ : state)
+        benchmark::DoNotOptimize(search.roots(locator.data(), locator.size(), 0, search.order()));
+    state.SetItemsProcessed(state.iterations() * search.order());
+}
+BENCHMARK(BM_ChienSearch)->Arg(8)->Arg(40);
+
+static void BM_ChienSearchBatch(benchmark::State& state) {
+    GFlinalg::ChienSearch search(0x201b, 64);
+    std::mt19937 rd;
+    std::vector<std::vector<uint16_t>> locators;
+    for (int64_t i = 0; i < state.range(1); ++i)
+        locators.push_back(randomLocator(rd, state.range(0), search.order()));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(search.rootsBatch(locators, 0, search.order()));
+    state.SetItemsProcessed(state.iterations() * search.order() * locators.size());
+}
+BENCHMARK(BM_ChienSearchBatch)->Args({8, 64})->Args({40, 64});
+
+/**
+ * Decoding 4096 interleaved RS(255, 223) codewords, every range(0)-th lane with range(1) symbol errors.
+ */
+static void BM_ReedSolomonDecode(benchmark::State& state) {
+    const GFlinalg::ReedSolomon<uint16_t, 0x11d> code(255, 223);
+    const size_t width = 4096;
+    std::mt19937 rd;
+    std::vector<uint8_t> rows(255 * width);
+    for (size_t i = 0; i < 223 * width; ++i)
+        rows[i] = static_cast<uint8_t>(rd());
+    code.encodeInterleaved(rows.data(), width, width);
+    const auto clean = rows;
+    for (auto _ : state) {
+        state.PauseTiming();
+        rows = clean;
+        for (size_t c = 0; state.range(0) && c < width; c += state.range(0))
+            for (int64_t e = 0; e < state.range(1); ++e)
+                rows[((c + e * 37) % 255) * width + c] ^= 0x5a;
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(code.decodeInterleaved(rows.data(), width, width));
+    }
+    state.SetBytesProcessed(state.iterations() * rows.size());
+}
+BENCHMARK(BM_ReedSolomonDecode)->Args({0, 0})->Args({64, 8})->Args({1, 16});
+
+static void BM_ReedSolomonEncode(benchmark::State& state) {
+    const GFlinalg::ReedSolomon<uint16_t, 0x11d> code(255, 223);
+    const size_t width = 4096;
+    std::vector<uint8_t> rows(255 * width, 0x3c);
+    for (auto _ : state) {
+        code.encodeInterleaved(rows.data(), width, width);
+        benchmark::DoNotOptimize(rows.data());
+    }
+    state.SetBytesProcessed(state.iterations() * 223 * width);
+}
+BENCHMARK(BM_ReedSolomonEncode);
+
+static std::vector<powPol256> randomSparseDense(size_t n, int64_t permille) {
+    std::mt19937 rd;
+    std::vector<powPol256> res(n * n, powPol256(0));
+    for (auto& e : res)
+        if (static_cast<int64_t>(rd() % 1000) < permille)
+            e = powPol256(static_cast<uint16_t>(rd() % 255 + 1));
+    return res;
+}
+
+/**
+ * 512 x 512 matrix over GF(2^8) with range(0) nonzeros per mille times a block of 4096 byte columns;
+ * the dense baseline does one region step per entry, the counter "memory" is the storage in bytes.
+ */
+template <GFlinalg::SparseOrder order>
+static void BM_SparseBlock(benchmark::State& state) {
+    const size_t n = 512, width = 4096;
+    auto a = GFlinalg::SparseMatrix<powPol256, order>::fromDense(randomSparseDense(n, state.range(0)), n, n);
+    std::vector<uint8_t> x(n * width, 0x3c), y(n * width);
+    for (auto _ : state) {
+        a.multiplyBlock(x.data(), width, y.data());
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetBytesProcessed(state.iterations() * x.size());
+    state.counters["memory"] = static_cast<double>(a.memory());
+}
+BENCHMARK_TEMPLATE(BM_SparseBlock, GFlinalg::SparseOrder::Row)->Arg(5)->Arg(50)->Arg(500);
+BENCHMARK_TEMPLATE(BM_SparseBlock, GFlinalg::SparseOrder::Column)->Arg(5)->Arg(50)->Arg(500);
+
+static void BM_DenseBlock(benchmark::State& state) {
+    using Field = GFlinalg::op::RegionField<powPol256>;
+    const size_t n = 512, width = 4096;
+    const auto& field = Field::get();
+    auto a = randomSparseDense(n, state.range(0));
+    std::vector<uint8_t> x(n * width, 0x3c), y(n * width);
+    for (auto _ : state) {
+        for (size_t i = 0; i < n; ++i) {
+            uint8_t* out = y.data() + i * width;
+            std::memset(out, 0, width);
+            for (size_t j = 0; j < n; ++j)
+                GFlinalg::op::addNibbleMap(field.mul[a[i * n + j].val()], x.data() + j * width, out, width);
+        }
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetBytesProcessed(state.iterations() * x.size());
+    state.counters["memory"] = static_cast<double>(n * n);
+}
+BENCHMARK(BM_DenseBlock)->Arg(5)->Arg(500);
+
+static void BM_SparseVector(benchmark::State& state) {
+    const size_t n = 4096;
+    auto a = GFlinalg::CsrMatrix<powPol256>::fromDense(randomSparseDense(n, state.range(0)), n, n);
+    std::vector<powPol256> x(n, powPol256(0x3c));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(a.multiply(x));
+    state.SetItemsProcessed(state.iterations() * a.nonzeros());
+    state.counters["memory"] = static_cast<double>(a.memory());
+}
+BENCHMARK(BM_SparseVector)->Arg(5)->Arg(50);
+
+/**
+ * Wiedemann solve of a range(0) x range(0) system with 8 nonzeros per row, threads as available.
+ */
+static void BM_WiedemannSolve(benchmark::State& state) {
+    const size_t n = state.range(0);
+    std::mt19937 rd;
+    std::vector<std::tuple<size_t, size_t, powPol256>> entries;
+    for (size_t i = 0; i < n; ++i)
+        for (size_t q = 0; q < 8; ++q)
+            entries.emplace_back(i, q ? rd() % n : i, powPol256(static_cast<uint16_t>(rd() % 255 + 1)));
+    auto a = GFlinalg::CsrMatrix<powPol256>::fromTriplets(n, n, entries);
+    std::vector<powPol256> b;
+    for (size_t i = 0; i < n; ++i)
+        b.push_back(powPol256(static_cast<uint16_t>(rd() % 256)));
+    GFlinalg::WiedemannSolver<powPol256> solver(a);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(solver.solve(b));
+    state.counters["threads"] = solver.threads();
+}
+BENCHMARK(BM_WiedemannSolve)->Arg(1000)->Arg(4096)->Unit(benchmark::kMillisecond)->Iterations(1);
+
+/**
+ * LT-like system with range(0) unknowns and 5% overhead, rows of 1..4 unknowns and every tenth row dense
+ * over 1% of them. Elimination with the remainder size as a counter, then solving 1024 byte symbols.
+ */
+static GFlinalg::CsrMatrix<powPol256> ltSystem(size_t cols) {
+    std::mt19937 rd;
+    const size_t rows = cols + cols / 20;
+    std::vector<std::tuple<size_t, size_t, powPol256>> entries;
+    for (size_t i = 0; i < rows; ++i) {
+        size_t degree = i % 10 == 9 ? cols / 100 : 1 + rd() % 4;
+        for (size_t q = 0; q < degree; ++q)
+            entries.emplace_back(i, rd() % cols, powPol256(static_cast<uint16_t>(rd() % 255 + 1)));
+    }
+    return GFlinalg::CsrMatrix<powPol256>::fromTriplets(rows, cols, entries);
+}
+
+static void BM_StructuredGauss(benchmark::State& state) {
+    auto a = ltSystem(state.range(0));
+    size_t remainder = 0;
+    for (auto _ : state) {
+        GFlinalg::StructuredGauss<powPol256> sge(a);
+        remainder = sge.remainderColumnIds().size();
+        benchmark::DoNotOptimize(sge.pivots());
+    }
+    state.counters["remainder"] = static_cast<double>(remainder);
+}
+BENCHMARK(BM_StructuredGauss)->Arg(2000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+static void BM_StructuredGaussSolveBlock(benchmark::State& state) {
+    const size_t width = 1024;
+    auto a = ltSystem(state.range(0));
+    GFlinalg::StructuredGauss<powPol256> sge(a);
+    std::vector<uint8_t> symbols(a.columns() * width, 0x3c), block(a.rows() * width), out(a.columns() * width);
+    a.multiplyBlock(symbols.data(), width, block.data());
+    const auto received = block;
+    for (auto _ : state) {
+        state.PauseTiming();
+        block = received;
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(sge.solveBlock(block.data(), width, out.data()));
+    }
+    state.SetBytesProcessed(state.iterations() * out.size());
+    state.counters["remainder"] = static_cast<double>(sge.remainderColumnIds().size());
+}
+BENCHMARK(BM_StructuredGaussSolveBlock)->Arg(2000)->Unit(benchmark::kMillisecond);
+
+static GFlinalg::BitMatrix randomBitMatrix(size_t rows, size_t cols) {
+    std::mt19937_64 rd;
+    GFlinalg::BitMatrix res(rows, cols);
+    for (size_t i = 0; i < rows; ++i)
+        for (size_t w = 0; w < res.words(); ++w)
+            res.row(i)[w] = rd() & (w + 1 < res.words() || cols % 64 == 0 ? ~uint64_t(0) : (uint64_t(1) << (cols % 64)) - 1);
+    return res;
+}
+
+static void BM_BitMatrixMultiply(benchmark::State& state) {
+    const size_t n = state.range(0);
+    auto a = randomBitMatrix(n, n), b = randomBitMatrix(n, n);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a * b);
+    }
+    state.SetBytesProcessed(state.iterations() * n * n / 8);
+}
+BENCHMARK(BM_BitMatrixMultiply)->Arg(1024)->Arg(4096)->Unit(benchmark::kMillisecond);
+
+static void BM_BitMatrixEchelonize(benchmark::State& state) {
+    const size_t n = state.range(0);
+    const auto a = randomBitMatrix(n, n);
+    size_t rank = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto e = a;
+        state.ResumeTiming();
+        rank = e.echelonize();
+    }
+    state.SetBytesProcessed(state.iterations() * n * n / 8);
+    state.counters["rank"] = static_cast<double>(rank);
+}
+BENCHMARK(BM_BitMatrixEchelonize)->Arg(1024)->Arg(4096)->Unit(benchmark::kMillisecond);
+
+static void BM_BitMatrixTranspose(benchmark::State& state) {
+    const size_t n = state.range(0);
+    const auto a = randomBitMatrix(n, n);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a.transpose());
+    }
+    state.SetBytesProcessed(state.iterations() * n * n / 8);
+}
+BENCHMARK(BM_BitMatrixTranspose)->Arg(4096)->Unit(benchmark::kMillisecond);
+
+static void BM_CauchyEncode(benchmark::State& state) {
+    const size_t k = 10, m = 4, size = 1 << 20;
+    GFlinalg::CauchyCode<uint16_t, 0x11d> code(k, m, state.range(1), state.range(0));
+    std::vector<std::vector<uint8_t>> devices(k + m, std::vector<uint8_t>(size));
+    std::vector<uint8_t*> ptr;
+    for (size_t d = 0; d < k + m; ++d) {
+        std::fill(devices[d].begin(), devices[d].end(), static_cast<uint8_t>(d * 37 + 1));
+        ptr.push_back(devices[d].data());
+    }
+    for (auto _ : state) {
+        code.encode(ptr.data(), ptr.data() + k, size);
+        benchmark::DoNotOptimize(ptr[k][0]);
+    }
+    state.SetBytesProcessed(state.iterations() * k * size);
+    state.counters["xors"] = static_cast<double>(code.schedule().xors());
+}
+BENCHMARK(BM_CauchyEncode)->Args({0, 2048})->Args({1, 2048})->Args({1, 256})->Args({1, 16384})->Unit(benchmark::kMillisecond);
+
+static GFlinalg::DenseMatrix<powPol256> randomDenseMatrix(size_t rows, size_t cols) {
+    std::mt19937 rd;
+    GFlinalg::DenseMatrix<powPol256> res(rows, cols);
+    for (size_t i = 0; i < rows * cols; ++i)
+        res.data()[i] = static_cast<uint8_t>(rd());
+    return res;
+}
+
+static void BM_DenseMultiply(benchmark::State& state) {
+    const size_t n = state.range(0);
+    auto a = randomDenseMatrix(n, n), b = randomDenseMatrix(n, n);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a * b);
+    }
+    state.SetBytesProcessed(state.iterations() * n * n);
+}
+BENCHMARK(BM_DenseMultiply)->Arg(1024)->Arg(2048)->Unit(benchmark::kMillisecond);
+
+static void BM_StrassenMultiply(benchmark::State& state) {
+    const size_t n = state.range(0), cutoff = state.range(1);
+    auto a = randomDenseMatrix(n, n), b = randomDenseMatrix(n, n);
+    GFlinalg::DenseMatrix<powPol256> c(n, n);
+    GFlinalg::op::Arena arena(GFlinalg::op::strassenWorkspace<uint8_t>(n, n, n, cutoff));
+    for (auto _ : state) {
+        GFlinalg::strassen(a, b, c, arena, cutoff);
+        benchmark::DoNotOptimize(c.data());
+    }
+    state.SetBytesProcessed(state.iterations() * n * n);
+}
+BENCHMARK(BM_StrassenMultiply)->Args({1024, 128})->Args({2048, 128})->Args({2048, 512})->Unit(benchmark::kMillisecond);
+
+static void BM_DenseMultiplyGathered(benchmark::State& state) {
+    const size_t k = state.range(0), width = 4096;
+    auto generator = randomDenseMatrix(2 * k, k), data = randomDenseMatrix(k, width);
+    GFlinalg::DenseMatrix<powPol256> out(k, width);
+    std::vector<size_t> survivors;
+    for (size_t i = 0; i < k; ++i)
+        survivors.push_back(2 * i + (i & 1));
+    for (auto _ : state) {
+        GFlinalg::multiply<powPol256>(GFlinalg::gatherRows(generator.view(), survivors), data.view(), out.view());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetBytesProcessed(state.iterations() * k * width);
+}
+BENCHMARK(BM_DenseMultiplyGathered)->Arg(64)->Unit(benchmark::kMillisecond);
 
 static void BM_RandomTime(benchmark::State& state) {
     std::uniform_int_distribution<uint32_t> uid(0, 255);
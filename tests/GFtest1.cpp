@@ -76,6 +76,9 @@ TEMPLATE_TEST_CASE("Basic arithmetic", "[template]", basicPol, powPol, tablePol)
         REQUIRE(TestType(5) * TestType(3) == TestType(4));
         REQUIRE((a *= TestType(40)) == TestType(4));
         REQUIRE(a.val() == 4);
+        TestType z(0);
+        REQUIRE((z *= a) == TestType(0));
+        REQUIRE((a *= TestType(0)) == TestType(0));
     }
     SECTION("Multiplication chaining") {
         TestType a(3);